@@ -0,0 +1,723 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Benchmark executable. Generates synthetic files, measures parsing, first
+// update, steady state updating under scripted gaze paths, drawing, resizing
+// and brick insertion and writes results as JSON, which can be compared
+// between commits. Runs headless with OpenGL via EGL or, if no context can
+// be created, with the recording render backend.
+
+#include "eyeGUI.h"
+#include "HeadlessContext.h"
+#include "SyntheticFiles.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace benchmarks
+{
+    // Typedefs
+    typedef std::chrono::steady_clock Clock;
+
+    // Options given via command line
+    struct Options
+    {
+        SyntheticConfig synthetic;
+        int width = 1280;
+        int height = 720;
+        int frames = 600; // Frames per gaze path
+        int iterations = 100; // Repetitions of parsing, resizing and brick operations
+        std::string backend = "auto"; // auto, opengl or recording
+        bool batching = true; // Batch rendering of elements
+        bool stateCaching = true; // Skipping of redundant state changes
+        bool stateRestoration = true; // Saving and restoring of OpenGL state around drawing
+        bool layerCaching = false; // Rendering of layouts and floating frames into offscreen layers
+        std::string font = "";
+        bool distanceFieldFonts = false; // Scaling of one distance field atlas per font
+        std::string fontAtlasCache = ""; // Directory keeping font atlases across runs
+        std::string directory = "eyeGUIBenchmarkData";
+        std::string archive = ""; // Asset archive packed out of directory
+        std::string output = "";
+        std::string label = "";
+    };
+
+    // Summary of measured samples in milliseconds
+    struct Summary
+    {
+        int count = 0;
+        double mean = 0;
+        double min = 0;
+        double median = 0;
+        double p95 = 0;
+        double p99 = 0;
+        double max = 0;
+    };
+
+    // Milliseconds since given time point
+    double millisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Summarize samples
+    Summary summarize(std::vector<double> samples)
+    {
+        Summary summary;
+        if (samples.empty())
+        {
+            return summary;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p)
+        {
+            int rank = (int)std::ceil(p / 100.0 * samples.size()) - 1;
+            return samples[std::max(0, std::min(rank, (int)samples.size() - 1))];
+        };
+        double sum = 0;
+        for (double sample : samples)
+        {
+            sum += sample;
+        }
+        summary.count = (int)samples.size();
+        summary.mean = sum / samples.size();
+        summary.min = samples.front();
+        summary.median = percentile(50);
+        summary.p95 = percentile(95);
+        summary.p99 = percentile(99);
+        summary.max = samples.back();
+        return summary;
+    }
+
+    // Minimal writer of JSON objects
+    class JsonWriter
+    {
+    public:
+
+        JsonWriter(std::ostream& rStream) : mrStream(rStream), mFirst(true), mDepth(0) {}
+
+        void beginObject(std::string key = "")
+        {
+            writeKey(key);
+            mrStream << "{";
+            mFirst = true;
+            mDepth++;
+        }
+
+        void endObject()
+        {
+            mDepth--;
+            mrStream << "\n" << std::string(mDepth * 2, ' ') << "}";
+            mFirst = false;
+        }
+
+        void value(std::string key, std::string value)
+        {
+            writeKey(key);
+            mrStream << "\"" << escape(value) << "\"";
+        }
+
+        void value(std::string key, double value)
+        {
+            writeKey(key);
+            mrStream << value;
+        }
+
+        void value(std::string key, int value)
+        {
+            writeKey(key);
+            mrStream << value;
+        }
+
+        void value(std::string key, bool value)
+        {
+            writeKey(key);
+            mrStream << (value ? "true" : "false");
+        }
+
+        void value(std::string key, const Summary& rSummary)
+        {
+            beginObject(key);
+            value("count", rSummary.count);
+            value("mean_ms", rSummary.mean);
+            value("min_ms", rSummary.min);
+            value("median_ms", rSummary.median);
+            value("p95_ms", rSummary.p95);
+            value("p99_ms", rSummary.p99);
+            value("max_ms", rSummary.max);
+            endObject();
+        }
+
+    private:
+
+        void writeKey(std::string key)
+        {
+            if (!mFirst)
+            {
+                mrStream << ",";
+            }
+            mFirst = false;
+            if (mDepth > 0)
+            {
+                mrStream << "\n" << std::string(mDepth * 2, ' ');
+            }
+            if (!key.empty())
+            {
+                mrStream << "\"" << escape(key) << "\": ";
+            }
+        }
+
+        std::string escape(std::string value) const
+        {
+            std::string escaped;
+            for (char c : value)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    escaped += '\\';
+                }
+                escaped += c;
+            }
+            return escaped;
+        }
+
+        std::ostream& mrStream;
+        bool mFirst;
+        int mDepth;
+    };
+
+    // Scripted gaze path, returns gaze position for given frame
+    class GazePath
+    {
+    public:
+
+        GazePath(std::string name, int width, int height) : mName(name), mWidth(width), mHeight(height), mGenerator(42)
+        {
+            mFixationX = width / 2;
+            mFixationY = height / 2;
+        }
+
+        std::string getName() const { return mName; }
+
+        eyegui::Input getInput(int frame)
+        {
+            eyegui::Input input;
+            if (mName == "circle")
+            {
+                // Smooth pursuit on circle around center
+                float angle = frame * 0.02f;
+                input.gazeX = (int)(mWidth / 2 + std::cos(angle) * mWidth * 0.4f);
+                input.gazeY = (int)(mHeight / 2 + std::sin(angle) * mHeight * 0.4f);
+            }
+            else if (mName == "sweep")
+            {
+                // Line by line scanning like reading
+                int lines = 16;
+                int framesPerLine = 60;
+                int line = (frame / framesPerLine) % lines;
+                input.gazeX = (int)((frame % framesPerLine) / (float)framesPerLine * mWidth);
+                input.gazeY = (int)((line + 0.5f) / lines * mHeight);
+            }
+            else
+            {
+                // Fixations at random positions with small jitter
+                if (frame % 30 == 0)
+                {
+                    std::uniform_int_distribution<int> distributionX(0, mWidth - 1);
+                    std::uniform_int_distribution<int> distributionY(0, mHeight - 1);
+                    mFixationX = distributionX(mGenerator);
+                    mFixationY = distributionY(mGenerator);
+                }
+                std::uniform_int_distribution<int> jitter(-3, 3);
+                input.gazeX = mFixationX + jitter(mGenerator);
+                input.gazeY = mFixationY + jitter(mGenerator);
+            }
+            return input;
+        }
+
+    private:
+
+        std::string mName;
+        int mWidth;
+        int mHeight;
+        std::mt19937 mGenerator;
+        int mFixationX;
+        int mFixationY;
+    };
+
+    // Callbacks of library
+    void printError(std::string message)
+    {
+        std::cerr << "[eyeGUI error] " << message << std::endl;
+    }
+
+    void printWarning(std::string message)
+    {
+        std::cerr << "[eyeGUI warning] " << message << std::endl;
+    }
+
+    // Create directory if not existing
+    void createDirectory(std::string directory)
+    {
+#ifdef _WIN32
+        _mkdir(directory.c_str());
+#else
+        mkdir(directory.c_str(), 0755);
+#endif
+    }
+
+    // Reset peak of resident memory, only available on Linux
+    void resetPeakMemory()
+    {
+        std::ofstream clearRefs("/proc/self/clear_refs");
+        clearRefs << "5";
+    }
+
+    // Get peak of resident memory in kilobytes since start or last reset, -1 if not available
+    int getPeakMemory()
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+            {
+                return std::atoi(line.c_str() + 6);
+            }
+        }
+        return -1;
+    }
+
+    // Copy file, returns whether successful
+    bool copyFile(std::string source, std::string destination)
+    {
+        std::ifstream in(source.c_str(), std::ios::binary);
+        std::ofstream out(destination.c_str(), std::ios::binary | std::ios::trunc);
+        if (!in.is_open() || !out.is_open())
+        {
+            return false;
+        }
+        out << in.rdbuf();
+        return out.good();
+    }
+
+    // Print usage
+    void printUsage()
+    {
+        std::cout
+            << "Usage: eyeGUIBenchmarks [options]\n"
+            << "  --nesting N       levels of nested stacks and grids (default 4)\n"
+            << "  --buttons M       count of buttons and sensors (default 32)\n"
+            << "  --texts K         count of text blocks (default 16)\n"
+            << "  --images N        count of png images loaded (default 4)\n"
+            << "  --image-size S    width and height of png images (default 1024)\n"
+            << "  --frames F        frames per gaze path (default 600)\n"
+            << "  --iterations I    repetitions of parsing, resizing and brick operations (default 100)\n"
+            << "  --size W H        size of GUI (default 1280 720)\n"
+            << "  --backend B       auto, opengl or recording (default auto)\n"
+            << "  --no-batching     draw each element on its own instead of instanced batches\n"
+            << "  --no-state-cache  issue every bind even if state is already set\n"
+            << "  --no-restore      neither query nor restore OpenGL state around drawing\n"
+            << "  --layer-caching   render layouts and floating frames into offscreen layers\n"
+            << "  --font PATH       font file used for text (default none)\n"
+            << "  --distance-field-fonts  draw text from distance fields instead of bitmaps per size\n"
+            << "  --font-atlas-cache PATH  directory keeping font atlases across runs (default none)\n"
+            << "  --directory PATH  directory for generated files (default eyeGUIBenchmarkData)\n"
+            << "  --archive PATH    read files from asset archive packed out of directory (default none)\n"
+            << "  --output PATH     file for JSON results (default standard output)\n"
+            << "  --label TEXT      label written into results, e.g. commit hash\n";
+    }
+
+    // Parse command line, returns false if program should exit
+    bool parseOptions(int argc, char** argv, Options& rOptions)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string argument = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (argument == "--nesting" && hasValue) { rOptions.synthetic.nesting = std::atoi(argv[++i]); }
+            else if (argument == "--buttons" && hasValue) { rOptions.synthetic.buttons = std::atoi(argv[++i]); }
+            else if (argument == "--texts" && hasValue) { rOptions.synthetic.textBlocks = std::atoi(argv[++i]); }
+            else if (argument == "--images" && hasValue) { rOptions.synthetic.images = std::atoi(argv[++i]); }
+            else if (argument == "--image-size" && hasValue) { rOptions.synthetic.imageSize = std::atoi(argv[++i]); }
+            else if (argument == "--frames" && hasValue) { rOptions.frames = std::atoi(argv[++i]); }
+            else if (argument == "--iterations" && hasValue) { rOptions.iterations = std::atoi(argv[++i]); }
+            else if (argument == "--size" && i + 2 < argc)
+            {
+                rOptions.width = std::atoi(argv[++i]);
+                rOptions.height = std::atoi(argv[++i]);
+            }
+            else if (argument == "--backend" && hasValue) { rOptions.backend = argv[++i]; }
+            else if (argument == "--no-batching") { rOptions.batching = false; }
+            else if (argument == "--no-state-cache") { rOptions.stateCaching = false; }
+            else if (argument == "--no-restore") { rOptions.stateRestoration = false; }
+            else if (argument == "--layer-caching") { rOptions.layerCaching = true; }
+            else if (argument == "--font" && hasValue) { rOptions.font = argv[++i]; }
+            else if (argument == "--distance-field-fonts") { rOptions.distanceFieldFonts = true; }
+            else if (argument == "--font-atlas-cache" && hasValue) { rOptions.fontAtlasCache = argv[++i]; }
+            else if (argument == "--directory" && hasValue) { rOptions.directory = argv[++i]; }
+            else if (argument == "--archive" && hasValue) { rOptions.archive = argv[++i]; }
+            else if (argument == "--output" && hasValue) { rOptions.output = argv[++i]; }
+            else if (argument == "--label" && hasValue) { rOptions.label = argv[++i]; }
+            else
+            {
+                printUsage();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Update and draw one frame
+    void runFrame(eyegui::GUI* pGUI, float tpf, eyegui::Input input)
+    {
+        eyegui::updateGUI(pGUI, tpf, input);
+        eyegui::drawGUI(pGUI);
+    }
+
+    int run(int argc, char** argv)
+    {
+        Options options;
+        if (!parseOptions(argc, argv, options))
+        {
+            return 1;
+        }
+
+        // Generate files
+        createDirectory(options.directory);
+        if (!synthetic_files::generate(options.directory, options.synthetic))
+        {
+            std::cerr << "Could not write synthetic files into " << options.directory << std::endl;
+            return 1;
+        }
+        std::string fontFilepath = "";
+        if (!options.font.empty())
+        {
+            fontFilepath = "benchmark_font.ttf";
+            if (!copyFile(options.font, options.directory + "/" + fontFilepath))
+            {
+                std::cerr << "Could not copy font " << options.font << std::endl;
+                return 1;
+            }
+        }
+
+        // Create context if wished
+        HeadlessContext context;
+        bool useOpenGL = false;
+        if (options.backend != "recording")
+        {
+            useOpenGL = context.create(options.width, options.height);
+            if (!useOpenGL && options.backend == "opengl")
+            {
+                std::cerr << "Could not create headless OpenGL context" << std::endl;
+                return 1;
+            }
+        }
+
+        // Create GUI
+        eyegui::setErrorCallback(&printError);
+        eyegui::setWarningCallback(&printWarning);
+        eyegui::setRootFilepath(options.directory + "/");
+        if (!options.archive.empty())
+        {
+            eyegui::setArchiveFilepath(options.archive);
+        }
+        eyegui::GUI* pGUI = eyegui::createGUI(
+            options.width,
+            options.height,
+            fontFilepath,
+            eyegui::CharacterSet::US_ENGLISH,
+            "",
+            useOpenGL ? eyegui::RenderBackendType::OPENGL : eyegui::RenderBackendType::RECORDING,
+            options.fontAtlasCache);
+        eyegui::setFrameStatisticsCollection(pGUI, true);
+        eyegui::setBatchRendering(pGUI, options.batching);
+        eyegui::setRenderStateCaching(pGUI, options.stateCaching);
+        if (!options.stateRestoration)
+        {
+            eyegui::StateRestoration restoration;
+            restoration.viewport = false;
+            restoration.blending = false;
+            restoration.depthMask = false;
+            restoration.culling = false;
+            restoration.shaderProgram = false;
+            restoration.vertexArray = false;
+            restoration.activeTexture = false;
+            restoration.uniformBuffer = false;
+            restoration.arrayBuffer = false;
+            restoration.unpackAlignment = false;
+            eyegui::setStateRestoration(pGUI, restoration);
+        }
+        eyegui::setOffscreenCaching(pGUI, options.layerCaching, options.layerCaching);
+        eyegui::setDistanceFieldFonts(pGUI, options.distanceFieldFonts);
+        const float tpf = 1.0f / 60.0f;
+        eyegui::Input noInput;
+
+        // *** PARSING ***
+        std::vector<double> parseSamples;
+        for (int i = 0; i < options.iterations; i++)
+        {
+            Clock::time_point start = Clock::now();
+            eyegui::Layout* pLayout = eyegui::addLayout(pGUI, SYNTHETIC_LAYOUT, false);
+            parseSamples.push_back(millisecondsSince(start));
+            eyegui::removeLayout(pGUI, pLayout);
+            eyegui::updateGUI(pGUI, tpf, noInput); // executes jobs
+        }
+
+        // *** FIRST UPDATE ***
+        // Frames get their initial layouting once they are visible, which may take some updates
+        eyegui::Layout* pLayout = eyegui::addLayout(pGUI, SYNTHETIC_LAYOUT, true);
+        double firstUpdate = 0;
+        int firstUpdateFrames = 0;
+        eyegui::FrameStatistics firstStatistics;
+        while (firstStatistics.relayouts == 0 && firstUpdateFrames < 10)
+        {
+            Clock::time_point updateStart = Clock::now();
+            eyegui::updateGUI(pGUI, tpf, noInput);
+            firstUpdate += millisecondsSince(updateStart);
+            firstUpdateFrames++;
+            firstStatistics = eyegui::getFrameStatistics(pGUI);
+            eyegui::drawGUI(pGUI);
+        }
+
+        // Let layout fade in
+        for (int i = 0; i < 120; i++)
+        {
+            runFrame(pGUI, tpf, noInput);
+        }
+
+        // *** STEADY STATE ***
+        std::vector<std::string> pathNames = { "fixations", "circle", "sweep" };
+        std::map<std::string, std::vector<double> > updateSamples;
+        std::map<std::string, std::vector<double> > drawSamples;
+        std::map<std::string, std::vector<double> > finishSamples;
+        eyegui::FrameStatistics steadyStatistics;
+        for (const std::string& rName : pathNames)
+        {
+            GazePath path(rName, options.width, options.height);
+            for (int frame = 0; frame < options.frames; frame++)
+            {
+                eyegui::Input input = path.getInput(frame);
+
+                Clock::time_point updateStart = Clock::now();
+                eyegui::updateGUI(pGUI, tpf, input);
+                updateSamples[rName].push_back(millisecondsSince(updateStart));
+
+                Clock::time_point drawStart = Clock::now();
+                eyegui::drawGUI(pGUI);
+                drawSamples[rName].push_back(millisecondsSince(drawStart));
+
+                // Time until graphics driver has finished (only meaningful for OpenGL)
+                if (useOpenGL)
+                {
+                    Clock::time_point finishStart = Clock::now();
+                    context.finish();
+                    finishSamples[rName].push_back(millisecondsSince(finishStart));
+                }
+            }
+            steadyStatistics = eyegui::getFrameStatisticsPercentile(pGUI, 50);
+        }
+
+        // *** RESIZING ***
+        std::vector<double> resizeSamples;
+        std::vector<double> fontAtlasSamples;
+        for (int i = 0; i < options.iterations; i++)
+        {
+            // Alternate between two sizes
+            bool small = (i % 2 == 0);
+            eyegui::resizeGUI(
+                pGUI,
+                small ? (options.width * 3) / 4 : options.width,
+                small ? (options.height * 3) / 4 : options.height);
+
+            // Time per frame exceeds waiting duration, so resizing is executed in this update
+            Clock::time_point resizeStart = Clock::now();
+            eyegui::updateGUI(pGUI, 1.0f, noInput);
+            resizeSamples.push_back(millisecondsSince(resizeStart));
+            fontAtlasSamples.push_back(eyegui::getFrameStatistics(pGUI).fontAtlasTime);
+            eyegui::drawGUI(pGUI);
+        }
+        eyegui::FontAtlasStatistics atlasStatistics = eyegui::getFontAtlasStatistics(pGUI);
+
+        // *** BRICK REPLACEMENT ***
+        std::map<std::string, std::string> idMapper;
+        idMapper[SYNTHETIC_BRICK_ROOT] = SYNTHETIC_BRICK_TARGET;
+        std::vector<double> replaceSamples;
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < options.iterations; i++)
+        {
+            // Include update, which relayouts frame and deletes replaced element
+            Clock::time_point replaceStart = Clock::now();
+            eyegui::replaceElementWithBrick(pLayout, SYNTHETIC_BRICK_TARGET, SYNTHETIC_BRICK, idMapper, false);
+            runFrame(pGUI, tpf, noInput);
+            replaceSamples.push_back(millisecondsSince(replaceStart));
+        }
+        double replaceTotal = millisecondsSince(start);
+
+        // *** FLOATING FRAMES ***
+        std::vector<double> floatingSamples;
+        start = Clock::now();
+        for (int i = 0; i < options.iterations; i++)
+        {
+            Clock::time_point floatingStart = Clock::now();
+            std::map<std::string, std::string> floatingIdMapper;
+            floatingIdMapper[SYNTHETIC_BRICK_ROOT] = "floating_" + std::to_string(i);
+            unsigned int frameIndex = eyegui::addFloatingFrameWithBrick(
+                pLayout, SYNTHETIC_BRICK, 0.25f, 0.25f, 0.5f, 0.5f, floatingIdMapper, true, false);
+            runFrame(pGUI, tpf, noInput);
+            eyegui::removeFloatingFrame(pLayout, frameIndex, false);
+            runFrame(pGUI, tpf, noInput);
+            floatingSamples.push_back(millisecondsSince(floatingStart));
+        }
+        double floatingTotal = millisecondsSince(start);
+
+        // *** IMAGE LOADING ***
+        // Decoding happens in background, upload while updating, until memory of textures contains image
+        std::vector<double> imageSamples;
+        unsigned int imageBytes = (unsigned int)(options.synthetic.imageSize * options.synthetic.imageSize * 4);
+        resetPeakMemory();
+        for (int i = 0; i < options.synthetic.images; i++)
+        {
+            unsigned int expectedBytes = eyegui::getResidentTextureBytes(pGUI) + imageBytes;
+            Clock::time_point imageStart = Clock::now();
+            eyegui::prefetchImage(pGUI, synthetic_files::imageFilepath(i));
+            while (eyegui::getResidentTextureBytes(pGUI) < expectedBytes && millisecondsSince(imageStart) < 10000)
+            {
+                eyegui::updateGUI(pGUI, tpf, noInput);
+            }
+            imageSamples.push_back(millisecondsSince(imageStart));
+        }
+        int imagePeakMemory = getPeakMemory();
+        double megapixels = options.synthetic.imageSize * options.synthetic.imageSize / 1000000.0;
+
+        eyegui::terminateGUI(pGUI);
+
+        // *** OUTPUT ***
+        std::ofstream file;
+        if (!options.output.empty())
+        {
+            file.open(options.output.c_str(), std::ios::out | std::ios::trunc);
+            if (!file.is_open())
+            {
+                std::cerr << "Could not open output file " << options.output << std::endl;
+                return 1;
+            }
+        }
+        std::ostream& rStream = options.output.empty() ? std::cout : file;
+
+        JsonWriter writer(rStream);
+        writer.beginObject();
+        writer.value("label", options.label);
+        writer.value("backend", useOpenGL ? std::string("opengl") : std::string("recording"));
+        writer.value("renderer", context.getRenderer());
+
+        writer.beginObject("config");
+        writer.value("nesting", options.synthetic.nesting);
+        writer.value("buttons", options.synthetic.buttons);
+        writer.value("text_blocks", options.synthetic.textBlocks);
+        writer.value("images", options.synthetic.images);
+        writer.value("image_size", options.synthetic.imageSize);
+        writer.value("width", options.width);
+        writer.value("height", options.height);
+        writer.value("batching", options.batching);
+        writer.value("state_caching", options.stateCaching);
+        writer.value("state_restoration", options.stateRestoration);
+        writer.value("layer_caching", options.layerCaching);
+        writer.value("frames", options.frames);
+        writer.value("iterations", options.iterations);
+        writer.value("font", options.font);
+        writer.value("distance_field_fonts", options.distanceFieldFonts);
+        writer.value("font_atlas_cache", !options.fontAtlasCache.empty());
+        writer.endObject();
+
+        writer.value("parse", summarize(parseSamples));
+
+        writer.beginObject("first_update");
+        writer.value("total_ms", firstUpdate);
+        writer.value("updates", firstUpdateFrames);
+        writer.value("relayout_update_ms", (double)firstStatistics.updateTime);
+        writer.value("frame_update_ms", (double)firstStatistics.frameUpdateTime);
+        writer.value("relayouts", (int)firstStatistics.relayouts);
+        writer.value("text_mesh_calculations", (int)firstStatistics.textMeshCalculations);
+        writer.endObject();
+
+        writer.beginObject("steady_state");
+        for (const std::string& rName : pathNames)
+        {
+            writer.beginObject(rName);
+            writer.value("update", summarize(updateSamples[rName]));
+            writer.value("draw", summarize(drawSamples[rName]));
+            if (useOpenGL)
+            {
+                writer.value("finish", summarize(finishSamples[rName]));
+            }
+            writer.endObject();
+        }
+        writer.beginObject("median_counters");
+        writer.value("updated_elements", (int)steadyStatistics.updatedElements);
+        writer.value("relayouts", (int)steadyStatistics.relayouts);
+        writer.value("text_mesh_calculations", (int)steadyStatistics.textMeshCalculations);
+        writer.value("draw_calls", (int)steadyStatistics.drawCalls);
+        writer.value("shader_binds", (int)steadyStatistics.shaderBinds);
+        writer.value("texture_binds", (int)steadyStatistics.textureBinds);
+        writer.value("issued_state_changes", (int)steadyStatistics.issuedStateChanges);
+        writer.value("skipped_state_changes", (int)steadyStatistics.skippedStateChanges);
+        writer.value("state_queries", (int)steadyStatistics.stateQueries);
+        writer.value("avoided_state_queries", (int)steadyStatistics.avoidedStateQueries);
+        writer.value("rendered_layers", (int)steadyStatistics.renderedLayers);
+        writer.value("composited_layers", (int)steadyStatistics.compositedLayers);
+        writer.endObject();
+        writer.endObject();
+
+        writer.beginObject("resize");
+        writer.value("update", summarize(resizeSamples));
+        writer.value("font_atlases", summarize(fontAtlasSamples));
+        writer.value("font_atlas_kb", (int)(atlasStatistics.atlasBytes / 1024));
+        writer.value("font_atlas_occupancy", atlasStatistics.atlasBytes > 0 ? (double)atlasStatistics.glyphBytes / atlasStatistics.atlasBytes : 0.0);
+        writer.endObject();
+
+        writer.beginObject("replace_element_with_brick");
+        writer.value("operation", summarize(replaceSamples));
+        writer.value("per_second", replaceTotal > 0 ? options.iterations / (replaceTotal / 1000.0) : 0.0);
+        writer.endObject();
+
+        writer.beginObject("add_floating_frame_with_brick");
+        writer.value("operation", summarize(floatingSamples));
+        writer.value("per_second", floatingTotal > 0 ? options.iterations / (floatingTotal / 1000.0) : 0.0);
+        writer.endObject();
+
+        writer.beginObject("image_loading");
+        Summary imageSummary = summarize(imageSamples);
+        writer.value("operation", imageSummary);
+        writer.value("per_megapixel_ms", megapixels > 0 ? imageSummary.mean / megapixels : 0.0);
+        writer.value("peak_resident_kb", imagePeakMemory);
+        writer.endObject();
+
+        writer.endObject();
+        rStream << std::endl;
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return benchmarks::run(argc, argv);
+}
@@ -0,0 +1,162 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "HeadlessContext.h"
+
+#ifdef EYEGUI_BENCHMARKS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+#endif
+
+namespace benchmarks
+{
+#ifdef EYEGUI_BENCHMARKS_EGL
+    // Few OpenGL functions are used here, so fetch them via EGL instead of including a loader
+    typedef void (*FinishFunction)();
+    typedef unsigned char const * (*GetStringFunction)(unsigned int);
+    static const unsigned int GL_RENDERER_ENUM = 0x1F01;
+#endif
+
+    HeadlessContext::HeadlessContext()
+    {
+        // Initialize members
+        mDisplay = NULL;
+        mSurface = NULL;
+        mContext = NULL;
+    }
+
+    HeadlessContext::~HeadlessContext()
+    {
+#ifdef EYEGUI_BENCHMARKS_EGL
+        if (mDisplay != NULL)
+        {
+            EGLDisplay display = (EGLDisplay)mDisplay;
+            eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            if (mContext != NULL)
+            {
+                eglDestroyContext(display, (EGLContext)mContext);
+            }
+            if (mSurface != NULL)
+            {
+                eglDestroySurface(display, (EGLSurface)mSurface);
+            }
+            eglTerminate(display);
+        }
+#endif
+    }
+
+    bool HeadlessContext::create(int width, int height)
+    {
+#ifdef EYEGUI_BENCHMARKS_EGL
+        // Prefer surfaceless platform of Mesa, which needs neither X11 nor DRM device
+        EGLDisplay display = EGL_NO_DISPLAY;
+        char const * pExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        if (pExtensions != NULL && std::strstr(pExtensions, "EGL_MESA_platform_surfaceless") != NULL)
+        {
+            PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+                (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            if (getPlatformDisplay != NULL)
+            {
+                display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            }
+        }
+        if (display == EGL_NO_DISPLAY)
+        {
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+        {
+            return false;
+        }
+        mDisplay = display;
+
+        // Choose configuration with pbuffer, so default framebuffer exists
+        EGLint configAttributes[] =
+        {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_ALPHA_SIZE, 8,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE
+        };
+        EGLConfig config;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0)
+        {
+            return false;
+        }
+
+        // Create surface
+        EGLint surfaceAttributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        EGLSurface surface = eglCreatePbufferSurface(display, config, surfaceAttributes);
+        if (surface == EGL_NO_SURFACE)
+        {
+            return false;
+        }
+        mSurface = surface;
+
+        // Create OpenGL 3.3 core context
+        if (!eglBindAPI(EGL_OPENGL_API))
+        {
+            return false;
+        }
+        EGLint contextAttributes[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+        if (context == EGL_NO_CONTEXT)
+        {
+            return false;
+        }
+        mContext = context;
+
+        return eglMakeCurrent(display, surface, surface, context) == EGL_TRUE;
+#else
+        return false;
+#endif
+    }
+
+    void HeadlessContext::finish() const
+    {
+#ifdef EYEGUI_BENCHMARKS_EGL
+        if (mContext != NULL)
+        {
+            FinishFunction finish = (FinishFunction)eglGetProcAddress("glFinish");
+            if (finish != NULL)
+            {
+                finish();
+            }
+        }
+#endif
+    }
+
+    std::string HeadlessContext::getRenderer() const
+    {
+#ifdef EYEGUI_BENCHMARKS_EGL
+        if (mContext != NULL)
+        {
+            GetStringFunction getString = (GetStringFunction)eglGetProcAddress("glGetString");
+            if (getString != NULL)
+            {
+                unsigned char const * pRenderer = getString(GL_RENDERER_ENUM);
+                if (pRenderer != NULL)
+                {
+                    return std::string((char const *)pRenderer);
+                }
+            }
+        }
+#endif
+        return "";
+    }
+}
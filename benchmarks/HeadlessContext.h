@@ -0,0 +1,47 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Headless OpenGL 3.3 core context for benchmarks. Uses EGL with the
+// surfaceless platform of Mesa if available (e.g. llvmpipe), so no window
+// system is necessary. Without EGL support at compile time, creation fails
+// and benchmarks fall back to the recording render backend.
+
+#ifndef HEADLESS_CONTEXT_H_
+#define HEADLESS_CONTEXT_H_
+
+#include <string>
+
+namespace benchmarks
+{
+    class HeadlessContext
+    {
+    public:
+
+        // Constructor
+        HeadlessContext();
+
+        // Destructor
+        virtual ~HeadlessContext();
+
+        // Create context with pbuffer of given size and make it current, returns whether successful
+        bool create(int width, int height);
+
+        // Wait until all submitted commands are executed
+        void finish() const;
+
+        // Name of renderer as reported by OpenGL
+        std::string getRenderer() const;
+
+    private:
+
+        // Members (opaque to keep EGL out of header)
+        void* mDisplay;
+        void* mSurface;
+        void* mContext;
+    };
+}
+
+#endif // HEADLESS_CONTEXT_H_
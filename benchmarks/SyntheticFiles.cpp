@@ -0,0 +1,287 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "SyntheticFiles.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace benchmarks
+{
+    namespace synthetic_files
+    {
+        // Text used for text blocks
+        static const std::string TEXT_CONTENT =
+            "Lorem ipsum dolor sit amet, consetetur sadipscing elitr, sed diam nonumy eirmod tempor invidunt ut labore.";
+
+        // Write string to file
+        bool writeFile(std::string filepath, std::string content)
+        {
+            std::ofstream file(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                return false;
+            }
+            file << content;
+            return file.good();
+        }
+
+        // Indentation for given depth
+        std::string indent(int depth)
+        {
+            return std::string(depth, '\t');
+        }
+
+        // Create xml of single leaf element
+        std::string createLeaf(int index, int buttonCount)
+        {
+            std::ostringstream stream;
+            if (index < buttonCount)
+            {
+                // Alternate between the kinds of interactive elements
+                switch (index % 3)
+                {
+                case 0:
+                    stream << "<circlebutton id=\"button_" << index << "\" icon=\"" << SYNTHETIC_ICON << "\"/>";
+                    break;
+                case 1:
+                    stream << "<boxbutton id=\"button_" << index << "\" icon=\"" << SYNTHETIC_ICON << "\" style=\"highlight\"/>";
+                    break;
+                default:
+                    stream << "<sensor id=\"button_" << index << "\" icon=\"" << SYNTHETIC_ICON << "\"/>";
+                    break;
+                }
+            }
+            else
+            {
+                stream << "<textblock id=\"text_" << (index - buttonCount) << "\" content=\"" << TEXT_CONTENT << "\"/>";
+            }
+            return stream.str();
+        }
+
+        // Create xml of subtree with given leaves (stacks at even levels, grids at odd)
+        void createSubtree(std::ostringstream& rStream, const std::vector<std::string>& rLeaves, int level, int depth)
+        {
+            if (level <= 0 || rLeaves.size() <= 1)
+            {
+                // Stack as container of leaves
+                rStream << indent(depth) << "<stack showbackground=\"true\" separator=\"2%\">\n";
+                if (rLeaves.empty())
+                {
+                    rStream << indent(depth + 1) << "<block/>\n";
+                }
+                for (const std::string& rLeaf : rLeaves)
+                {
+                    rStream << indent(depth + 1) << rLeaf << "\n";
+                }
+                rStream << indent(depth) << "</stack>\n";
+                return;
+            }
+
+            // Split leaves into two halves
+            std::vector<std::string> first(rLeaves.begin(), rLeaves.begin() + rLeaves.size() / 2);
+            std::vector<std::string> second(rLeaves.begin() + rLeaves.size() / 2, rLeaves.end());
+
+            if (level % 2 == 0)
+            {
+                rStream << indent(depth) << "<stack innerborder=\"2%\">\n";
+                createSubtree(rStream, first, level - 1, depth + 1);
+                createSubtree(rStream, second, level - 1, depth + 1);
+                rStream << indent(depth) << "</stack>\n";
+            }
+            else
+            {
+                rStream << indent(depth) << "<grid innerborder=\"2%\">\n";
+                rStream << indent(depth + 1) << "<row size=\"100%\">\n";
+                rStream << indent(depth + 2) << "<column size=\"50%\">\n";
+                createSubtree(rStream, first, level - 1, depth + 3);
+                rStream << indent(depth + 2) << "</column>\n";
+                rStream << indent(depth + 2) << "<column size=\"50%\">\n";
+                createSubtree(rStream, second, level - 1, depth + 3);
+                rStream << indent(depth + 2) << "</column>\n";
+                rStream << indent(depth + 1) << "</row>\n";
+                rStream << indent(depth) << "</grid>\n";
+            }
+        }
+
+        std::string createLayout(SyntheticConfig config)
+        {
+            // Collect leaves
+            std::vector<std::string> leaves;
+            for (int i = 0; i < config.buttons + config.textBlocks; i++)
+            {
+                leaves.push_back(createLeaf(i, config.buttons));
+            }
+
+            // Main grid with synthetic tree and target for bricks
+            std::ostringstream stream;
+            stream << "<layout stylesheet=\"" << SYNTHETIC_STYLESHEET << "\">\n";
+            stream << "\t<grid>\n";
+            stream << "\t\t<row size=\"80%\">\n";
+            stream << "\t\t\t<column size=\"100%\">\n";
+            createSubtree(stream, leaves, config.nesting, 4);
+            stream << "\t\t\t</column>\n";
+            stream << "\t\t</row>\n";
+            stream << "\t\t<row size=\"20%\">\n";
+            stream << "\t\t\t<column size=\"100%\">\n";
+            stream << "\t\t\t\t<block id=\"" << SYNTHETIC_BRICK_TARGET << "\"/>\n";
+            stream << "\t\t\t</column>\n";
+            stream << "\t\t</row>\n";
+            stream << "\t</grid>\n";
+            stream << "</layout>\n";
+            return stream.str();
+        }
+
+        std::string createBrick()
+        {
+            std::ostringstream stream;
+            stream << "<stack id=\"" << SYNTHETIC_BRICK_ROOT << "\" showbackground=\"true\" separator=\"5%\">\n";
+            stream << "\t<circlebutton icon=\"" << SYNTHETIC_ICON << "\"/>\n";
+            stream << "\t<textblock content=\"" << TEXT_CONTENT << "\"/>\n";
+            stream << "\t<sensor icon=\"" << SYNTHETIC_ICON << "\"/>\n";
+            stream << "</stack>\n";
+            return stream.str();
+        }
+
+        std::string createStylesheet()
+        {
+            return
+                "default\n"
+                "{\n"
+                "\tbackground-color = 0x303030FF\n"
+                "\tcolor = 0xA0A0A0FF\n"
+                "\tseparator-color = 0x606060FF\n"
+                "}\n"
+                "\n"
+                "highlight\n"
+                "{\n"
+                "\tcolor = 0xFFD000FF\n"
+                "}\n";
+        }
+
+        std::string createIcon()
+        {
+            return
+                "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"64\" height=\"64\">\n"
+                "\t<circle cx=\"32\" cy=\"32\" r=\"24\" fill=\"#FFFFFF\"/>\n"
+                "\t<rect x=\"20\" y=\"20\" width=\"24\" height=\"24\" fill=\"#000000\"/>\n"
+                "</svg>\n";
+        }
+
+        // Append big endian number
+        void appendNumber(std::string& rData, uint32_t value)
+        {
+            for (int shift = 24; shift >= 0; shift -= 8)
+            {
+                rData += (char)((value >> shift) & 0xFF);
+            }
+        }
+
+        // Append png chunk with checksum
+        void appendChunk(std::string& rData, std::string type, const std::string& rContent)
+        {
+            static std::vector<uint32_t> table;
+            if (table.empty())
+            {
+                for (uint32_t n = 0; n < 256; n++)
+                {
+                    uint32_t c = n;
+                    for (int k = 0; k < 8; k++)
+                    {
+                        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                    }
+                    table.push_back(c);
+                }
+            }
+            std::string checked = type + rContent;
+            uint32_t crc = 0xFFFFFFFFu;
+            for (char c : checked)
+            {
+                crc = table[(crc ^ (uint8_t)c) & 0xFF] ^ (crc >> 8);
+            }
+            appendNumber(rData, (uint32_t)rContent.size());
+            rData += checked;
+            appendNumber(rData, crc ^ 0xFFFFFFFFu);
+        }
+
+        // Create rgba png with pattern varying by index, zlib stream uses stored blocks only
+        std::string createImage(int size, int index)
+        {
+            // Rows of pixels, each starting with filter type
+            std::string pixels;
+            pixels.reserve((size_t)size * (size * 4 + 1));
+            for (int y = 0; y < size; y++)
+            {
+                pixels += (char)0;
+                for (int x = 0; x < size; x++)
+                {
+                    pixels += (char)((x + index * 32) & 0xFF);
+                    pixels += (char)(y & 0xFF);
+                    pixels += (char)(((x ^ y) + index * 64) & 0xFF);
+                    pixels += (char)(((x + y) / 4) & 0xFF);
+                }
+            }
+
+            // Zlib stream
+            std::string compressed = "\x78\x01";
+            size_t position = 0;
+            do
+            {
+                size_t length = std::min(pixels.size() - position, (size_t)65535);
+                bool last = position + length == pixels.size();
+                compressed += (char)(last ? 1 : 0);
+                compressed += (char)(length & 0xFF);
+                compressed += (char)(length >> 8);
+                compressed += (char)(~length & 0xFF);
+                compressed += (char)((~length >> 8) & 0xFF);
+                compressed.append(pixels, position, length);
+                position += length;
+            } while (position < pixels.size());
+            uint32_t a = 1, b = 0;
+            for (char c : pixels)
+            {
+                a = (a + (uint8_t)c) % 65521;
+                b = (b + a) % 65521;
+            }
+            appendNumber(compressed, (b << 16) | a);
+
+            // Chunks
+            std::string header;
+            appendNumber(header, (uint32_t)size);
+            appendNumber(header, (uint32_t)size);
+            header += "\x08\x06";
+            header += std::string(3, '\0');
+            std::string png = "\x89PNG\r\n\x1a\n";
+            appendChunk(png, "IHDR", header);
+            appendChunk(png, "IDAT", compressed);
+            appendChunk(png, "IEND", "");
+            return png;
+        }
+
+        bool generate(std::string directory, SyntheticConfig config)
+        {
+            bool success = true;
+            success &= writeFile(directory + "/" + SYNTHETIC_LAYOUT, createLayout(config));
+            success &= writeFile(directory + "/" + SYNTHETIC_BRICK, createBrick());
+            success &= writeFile(directory + "/" + SYNTHETIC_STYLESHEET, createStylesheet());
+            success &= writeFile(directory + "/" + SYNTHETIC_ICON, createIcon());
+            for (int i = 0; i < config.images; i++)
+            {
+                success &= writeFile(directory + "/" + imageFilepath(i), createImage(config.imageSize, i));
+            }
+            return success;
+        }
+
+        std::string imageFilepath(int index)
+        {
+            return "synthetic_image_" + std::to_string(index) + ".png";
+        }
+    }
+}
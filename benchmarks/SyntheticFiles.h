@@ -0,0 +1,51 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Generator of synthetic layout, brick and stylesheet files of configurable
+// size. Elements are distributed over nested stacks and grids, so depth and
+// width of the element tree can be varied independently. Png images are
+// stored without compression, so decoding measures mostly the library.
+
+#ifndef SYNTHETIC_FILES_H_
+#define SYNTHETIC_FILES_H_
+
+#include <string>
+
+namespace benchmarks
+{
+    // Configuration of generated files
+    struct SyntheticConfig
+    {
+        int nesting = 4; // Levels of nested stacks and grids
+        int buttons = 32; // Count of buttons and sensors
+        int textBlocks = 16; // Count of text blocks
+        int imageSize = 1024; // Width and height of png images in pixels
+        int images = 4; // Count of distinct png images
+    };
+
+    // Names of generated files, relative to directory
+    static const std::string SYNTHETIC_LAYOUT = "synthetic.xeyegui";
+    static const std::string SYNTHETIC_BRICK = "synthetic.beyegui";
+    static const std::string SYNTHETIC_STYLESHEET = "synthetic.seyegui";
+    static const std::string SYNTHETIC_ICON = "synthetic.svg";
+
+    // Id of element in layout which is replaced by bricks
+    static const std::string SYNTHETIC_BRICK_TARGET = "brick_target";
+
+    // Id of root element of brick, to be mapped at insertion
+    static const std::string SYNTHETIC_BRICK_ROOT = "brick_root";
+
+    namespace synthetic_files
+    {
+        // Write all files into existing directory, returns whether successful
+        bool generate(std::string directory, SyntheticConfig config);
+
+        // Filepath of png image with index, relative to directory
+        std::string imageFilepath(int index);
+    }
+}
+
+#endif // SYNTHETIC_FILES_H_
@@ -23,6 +23,9 @@
 /*!
  *  \brief     Interface to access eyeGUI functions.
  *  \details   This interface provides multiply functions and abstract class declarations to create, render and manipulate the eyeGUI user interface.
+ *             Functions without return value, which manipulate the GUI or its layouts, may be called from any thread. Called by the thread
+ *             updating the GUI, they take effect immediately. Called by other threads, they are queued and executed at the begin of next
+ *             update. All other functions must be called by the thread updating and drawing the GUI.
  *  \author    Raphael Menges
  *  \version   0.5
  *  \license   This project is released under the MIT License (MIT)
@@ -34,6 +37,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
+#include <future>
 
 namespace eyegui
 {
@@ -57,6 +62,10 @@ namespace eyegui
     /*! This enum is defined directly in the interface because it is needed by some functions. */
     enum class TextFlowVerticalAlignment { TOP, CENTER, BOTTOM };
 
+    //! Enumeration of available render backends.
+    /*! OpenGL needs a current OpenGL 3.3 core context. Recording needs no context at all and captures the draw commands into memory. */
+    enum class RenderBackendType { OPENGL, RECORDING };
+
     //! Enumeration of possible picture alignments.
     /*! This enum is defined directly in the interface because it is needed by the replacing funtions. */
     enum class PictureAlignment { ORIGINAL, STRETCHED };
@@ -140,6 +149,71 @@ namespace eyegui
         bool gazeUsed = false;
     };
 
+    //! Struct for draw command captured by recording render backend
+    struct DrawCommand
+    {
+        unsigned int shaderProgram = 0;
+        unsigned int texture = 0;
+        unsigned int vertexCount = 0;
+        unsigned int instanceCount = 1;
+        std::map<std::string, std::vector<float> > uniforms;
+    };
+
+    //! Struct for OpenGL state which is saved before drawing and restored afterwards.
+    /*! Saving costs queries of the driver each frame, which may force a sync on drivers running in a separate thread.
+        State which is not saved is left as set by eyeGUI: viewport of GUI, blending enabled with source alpha and one
+        minus source alpha, depth mask disabled, culling enabled, first texture slot active, program, vertex array
+        object, array buffer and uniform buffer of eyeGUI bound, unpack alignment of one. Uploads while updating save
+        and restore the array buffer, vertex array object and unpack alignment the same way. With nothing saved,
+        eyeGUI updates and renders without any query and the application has to set its own state afterwards.
+        Default saves everything. */
+    struct StateRestoration
+    {
+        bool viewport = true;
+        bool blending = true; // Enabling and function
+        bool depthMask = true;
+        bool culling = true;
+        bool shaderProgram = true;
+        bool vertexArray = true;
+        bool activeTexture = true; // Active slot, bound textures are never restored
+        bool uniformBuffer = true; // Binding at point zero
+        bool arrayBuffer = true;
+        bool unpackAlignment = true;
+    };
+
+    //! Struct for statistics of one frame, i.e. one update and one drawing of GUI.
+    /*! Times are in milliseconds. Times of phases inside update are contained in update time. */
+    struct FrameStatistics
+    {
+        float jobsTime = 0;
+        float resizingTime = 0;
+        float fontAtlasTime = 0;
+        float notificationTime = 0;
+        float frameUpdateTime = 0;
+        float updateTime = 0;
+        float drawTime = 0;
+        unsigned int updatedElements = 0;
+        unsigned int relayouts = 0;
+        unsigned int textMeshCalculations = 0;
+        unsigned int drawCalls = 0;
+        unsigned int shaderBinds = 0;
+        unsigned int textureBinds = 0;
+        unsigned int issuedStateChanges = 0; // Binds of program, vertex array object, texture slot or texture
+        unsigned int skippedStateChanges = 0; // Binds skipped because state was already set
+        unsigned int stateQueries = 0; // Queries of OpenGL state to restore it after updating and drawing
+        unsigned int avoidedStateQueries = 0; // Queries avoided because state is not restored
+        unsigned int renderedLayers = 0; // Offscreen layers whose content was rendered again
+        unsigned int compositedLayers = 0; // Offscreen layers drawn as one quad
+    };
+
+    //! Struct for memory of font atlases, which contain glyphs of the character set.
+    /*! Atlases have one byte per pixel. Occupancy is glyph bytes divided by atlas bytes. */
+    struct FontAtlasStatistics
+    {
+        unsigned int atlasBytes = 0; // Pixels of atlases of all fonts and sizes
+        unsigned int glyphBytes = 0; // Pixels covered by glyphs, without padding
+    };
+
     //! Creates GUI and returns pointer to it.
     /*!
       \param width of GUI as integer.
@@ -147,6 +221,10 @@ namespace eyegui
       \param fontFilepath is path to a .ttf font file
       \param characterSet used to initialize font rendering.
       \param localizationFilepath is path to a .leyegui file
+      \param renderBackend used for drawing. Recording backend needs no OpenGL context.
+      \param fontAtlasCacheDirectory is path to directory where font atlases are stored across runs,
+             created if not existing. Atlases found there are not rasterized again at start or when
+             resizing. Not relative to root filepath. Empty string disables it.
       \return pointer to created GUI.
     */
     GUI* createGUI(
@@ -154,7 +232,9 @@ namespace eyegui
         int height,
         std::string fontFilepath = "",
         CharacterSet characterSet = CharacterSet::US_ENGLISH,
-        std::string localizationFilepath = "");
+        std::string localizationFilepath = "",
+        RenderBackendType renderBackend = RenderBackendType::OPENGL,
+        std::string fontAtlasCacheDirectory = "");
 
     //! Creates layout inside GUI and returns pointer to it.
     /*!
@@ -165,6 +245,18 @@ namespace eyegui
     */
     Layout* addLayout(GUI* pGUI, std::string filepath, bool visible = true);
 
+    //! Creates layout inside GUI in background and returns future of pointer to it.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to layout xml file.
+      \param visible shall added layout be visible.
+      \return future of pointer to added layout. Xml and stylesheet are read and images are decoded by a worker thread.
+               Textures are created during following updates of the GUI, limited to a few milliseconds per update. Elements
+               are created at once in a single update, which may exceed that limit for large layouts. Future becomes
+               ready in the update which adds the layout, so do not wait for it on the thread updating the GUI.
+    */
+    std::shared_future<Layout*> addLayoutAsync(GUI* pGUI, std::string filepath, bool visible = true);
+
     //! Removes layout in GUI by pointer.
     /*!
       \param pGUI pointer to GUI.
@@ -172,7 +264,7 @@ namespace eyegui
     */
     void removeLayout(GUI* pGUI, Layout const * pLayout);
 
-    //! Update whole GUI.
+    //! Update whole GUI. Executes calls queued by other threads first.
     /*!
       \param pGUI pointer to GUI.
       \param tpf passed time since last rendering in seconds as float.
@@ -187,6 +279,118 @@ namespace eyegui
     */
     void drawGUI(GUI* pGUI);
 
+    //! Check whether anything visible has changed since last drawing.
+    /*!
+      \param pGUI pointer to GUI.
+      \return true if GUI looks different than at last drawing. When false, drawing can be skipped and previous frame be reused.
+    */
+    bool isRedrawNeeded(GUI const * pGUI);
+
+    //! Get draw commands of last drawing.
+    /*!
+      \param pGUI pointer to GUI.
+      \return vector of draw commands in order of execution. Empty if GUI does not use recording render backend.
+    */
+    std::vector<DrawCommand> getRecordedDrawCommands(GUI const * pGUI);
+
+    //! Set whether statistics of frames are collected. Collection is disabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param collect indicates whether statistics should be collected.
+    */
+    void setFrameStatisticsCollection(GUI* pGUI, bool collect);
+
+    //! Get statistics of last collected frame.
+    /*!
+      \param pGUI pointer to GUI.
+      \return statistics of last frame. Filled with zeros if nothing was collected.
+    */
+    FrameStatistics getFrameStatistics(GUI const * pGUI);
+
+    //! Get statistics of recently collected frames.
+    /*!
+      \param pGUI pointer to GUI.
+      \return vector of statistics ordered from oldest to newest frame.
+    */
+    std::vector<FrameStatistics> getFrameStatisticsHistory(GUI const * pGUI);
+
+    //! Get percentile of statistics over recently collected frames.
+    /*!
+      \param pGUI pointer to GUI.
+      \param percentile in range of 0 to 100 which is computed independently for each value.
+      \return statistics where each value is the given percentile.
+    */
+    FrameStatistics getFrameStatisticsPercentile(GUI const * pGUI, float percentile);
+
+    //! Set whether elements are drawn in batches. Batch rendering is enabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param batch indicates whether elements with same shader are drawn with one instanced draw call.
+    */
+    void setBatchRendering(GUI* pGUI, bool batch);
+
+    //! Set whether redundant changes of render state are skipped. Enabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param cache indicates whether binds of already bound programs, vertex array objects and textures are skipped while drawing.
+    */
+    void setRenderStateCaching(GUI* pGUI, bool cache);
+
+    //! Set which OpenGL state is saved before drawing and restored afterwards. Everything is restored by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param restoration contains flags for state the application relies on.
+    */
+    void setStateRestoration(GUI* pGUI, StateRestoration restoration);
+
+    //! Set whether layouts and floating frames are rendered into offscreen layers. Disabled by default.
+    /*! Content of a layer is only rendered again when it has changed, otherwise it is drawn as one quad with alpha
+        of its layout or frame. Each layer occupies a texture in size of the window.
+      \param pGUI pointer to GUI.
+      \param layouts indicates whether each layout is rendered into its own layer.
+      \param floatingFrames indicates whether each floating frame is rendered into its own layer.
+    */
+    void setOffscreenCaching(GUI* pGUI, bool layouts, bool floatingFrames);
+
+    //! Set budget for memory of textures loaded from image files. Default is 256 MiB.
+    /*! Textures not used by any element are deleted in least recently used order while memory is above budget.
+        They are loaded again when used later.
+      \param pGUI pointer to GUI.
+      \param budget in bytes.
+    */
+    void setTextureMemoryBudget(GUI* pGUI, unsigned int budget);
+
+    //! Get memory of textures loaded from image files.
+    /*!
+      \param pGUI pointer to GUI.
+      \return bytes of pixel data, without mipmaps.
+    */
+    unsigned int getResidentTextureBytes(GUI const * pGUI);
+
+    //! Set directory where decoded images are stored across runs. Disabled by default.
+    /*! Png files are not decoded and svg files are not rasterized again when found in the directory.
+        Entries are replaced when size or modification time of the image file changes.
+      \param pGUI pointer to GUI.
+      \param directory is path to directory, which is created if not existing. Not relative to root filepath.
+             Empty string disables storing and loading.
+    */
+    void setImageCacheDirectory(GUI* pGUI, std::string directory);
+
+    //! Set whether text is drawn from distance fields of glyphs. Disabled by default.
+    /*! One atlas per font is rasterized at a fixed height and scaled for all font sizes,
+        so resizing the window does not rasterize glyphs again. Edges are slightly softer.
+      \param pGUI pointer to GUI.
+      \param distanceField is true for distance fields, false for bitmaps per font size.
+    */
+    void setDistanceFieldFonts(GUI* pGUI, bool distanceField);
+
+    //! Get memory of font atlases.
+    /*!
+      \param pGUI pointer to GUI.
+      \return bytes of atlases and bytes of them covered by glyphs.
+    */
+    FontAtlasStatistics getFontAtlasStatistics(GUI const * pGUI);
+
     //! Terminate GUI.
     /*!
       \param pGUI pointer to GUI which should be termianted.
@@ -221,7 +425,9 @@ namespace eyegui
     */
     void toggleGazeVisualizationDrawing(GUI* pGUI);
 
-    //! Prefetch image to avoid lags.
+    //! Prefetch image to avoid lags. Image is decoded in background and uploaded during following updates.
+    /*! Svg files are rasterized for the size of the elements using them, so they are not prefetched.
+    */
     /*!
       \param pGUI pointer to GUI.
       \param filepath is path to image which should be prefetched.
@@ -416,7 +622,7 @@ namespace eyegui
         float b,
         float a);
 
-    //! Set icon of interactive element.
+    //! Set icon of interactive element. Icon is decoded in background, element shows nothing until then.
     /*!
       \param pLayout pointer to layout.
       \param id is the unique id of an element.
@@ -447,7 +653,8 @@ namespace eyegui
     void interactWithSelectedInteractiveElement(Layout* pLayout);
 
     //! Select next interactive element, returns whether reached end of layout. If so, nothing is selected.
-    /*!
+    /*! Must be called by the thread updating the GUI, as result depends on state of layout. Calls from other
+        threads are ignored with a warning and return false. Calls queued before by other threads are executed first.
       \param pLayout pointer to layout.
     */
     bool selectNextInteractiveElement(Layout* pLayout);
@@ -855,6 +1062,14 @@ namespace eyegui
       \param rootFilepath is used as prefix for used filepathes.
     */
     void setRootFilepath(std::string rootFilepath);
+
+    //! Asset archive is searched first for ALL filepathes, before loose files are read.
+    /*! Archive is created by eyeGUIPacker out of directory at root filepath. Files not
+        contained in archive are read from below root filepath, as without archive.
+      \param archiveFilepath is path to archive. Not relative to root filepath.
+             Empty string removes archive.
+    */
+    void setArchiveFilepath(std::string archiveFilepath);
 }
 
 #endif // EYE_GUI_H_
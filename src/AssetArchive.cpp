@@ -0,0 +1,266 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "AssetArchive.h"
+
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+
+namespace eyegui
+{
+    // Beginning of archive, followed by entries
+    struct AssetArchiveHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t count;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(AssetArchiveHeader) == 16, "AssetArchiveHeader must not contain padding");
+
+    // Entry of index, offsets relative to beginning of archive
+    struct AssetArchiveEntry
+    {
+        uint64_t offset;
+        uint64_t size;
+        int64_t time;
+        uint32_t pathOffset;
+        uint32_t pathLength;
+    };
+    static_assert(sizeof(AssetArchiveEntry) == 32, "AssetArchiveEntry must not contain padding");
+
+    // Identification of archives
+    static const uint32_t ASSET_ARCHIVE_MAGIC = 0x41504745; // "EGPA"
+    static const uint32_t ASSET_ARCHIVE_VERSION = 1;
+
+    // Contents of files start at multiples of it
+    static const uint64_t ASSET_ARCHIVE_ALIGNMENT = 16;
+
+    // Read entry at index out of mapped archive
+    static AssetArchiveEntry readEntry(uchar const * pData, uint index)
+    {
+        AssetArchiveEntry entry;
+        std::memcpy(&entry, pData + sizeof(AssetArchiveHeader) + index * sizeof(AssetArchiveEntry), sizeof(AssetArchiveEntry));
+        return entry;
+    }
+
+    AssetArchive::AssetArchive(std::string filepath)
+    {
+        // Initialize members
+        mCount = 0;
+
+        // Map archive
+        std::shared_ptr<MappedFile const> spMapping = std::make_shared<MappedFile>(filepath);
+        if (!spMapping->isMapped() || spMapping->getSize() < sizeof(AssetArchiveHeader))
+        {
+            return;
+        }
+        uchar const * pData = spMapping->getData();
+        uint64_t size = spMapping->getSize();
+
+        // Check header
+        AssetArchiveHeader header;
+        std::memcpy(&header, pData, sizeof(AssetArchiveHeader));
+        if (header.magic != ASSET_ARCHIVE_MAGIC
+            || header.version != ASSET_ARCHIVE_VERSION
+            || sizeof(AssetArchiveHeader) + (uint64_t)header.count * sizeof(AssetArchiveEntry) > size)
+        {
+            return;
+        }
+
+        // Check that entries stay inside of archive, so lookups need no checks
+        for (uint i = 0; i < header.count; i++)
+        {
+            AssetArchiveEntry entry = readEntry(pData, i);
+            if ((uint64_t)entry.pathOffset + entry.pathLength > size
+                || entry.offset > size
+                || entry.size > size - entry.offset)
+            {
+                return;
+            }
+        }
+
+        // Archive is usable
+        mspMapping = spMapping;
+        mCount = header.count;
+    }
+
+    AssetArchive::~AssetArchive()
+    {
+        // Nothing to do
+    }
+
+    bool AssetArchive::find(std::string filepath, FileView& rView) const
+    {
+        uint index = findIndex(filepath);
+        if (index >= mCount)
+        {
+            return false;
+        }
+        AssetArchiveEntry entry = readEntry(mspMapping->getData(), index);
+        rView = FileView(mspMapping, mspMapping->getData() + entry.offset, (size_t)entry.size);
+        return true;
+    }
+
+    bool AssetArchive::getFileStatus(std::string filepath, unsigned long long& rSize, long long& rTime) const
+    {
+        uint index = findIndex(filepath);
+        if (index >= mCount)
+        {
+            return false;
+        }
+        AssetArchiveEntry entry = readEntry(mspMapping->getData(), index);
+        rSize = (unsigned long long)entry.size;
+        rTime = (long long)entry.time;
+        return true;
+    }
+
+    bool AssetArchive::write(std::string rootDirectory, std::vector<std::string> filepaths, std::string archiveFilepath)
+    {
+        // Sort filepaths as expected by binary search
+        for (std::string& rFilepath : filepaths)
+        {
+            rFilepath = normalizeFilepath(rFilepath);
+        }
+        std::sort(filepaths.begin(), filepaths.end());
+        filepaths.erase(std::unique(filepaths.begin(), filepaths.end()), filepaths.end());
+
+        // Prefix for reading files
+        std::string prefix = rootDirectory.empty() ? "" : rootDirectory + "/";
+
+        // Fill index, contents follow filepaths
+        AssetArchiveHeader header;
+        header.magic = ASSET_ARCHIVE_MAGIC;
+        header.version = ASSET_ARCHIVE_VERSION;
+        header.count = (uint32_t)filepaths.size();
+        header.reserved = 0;
+        std::vector<AssetArchiveEntry> entries(filepaths.size());
+        uint64_t offset = sizeof(AssetArchiveHeader) + entries.size() * sizeof(AssetArchiveEntry);
+        for (uint i = 0; i < filepaths.size(); i++)
+        {
+            entries[i].pathOffset = (uint32_t)offset;
+            entries[i].pathLength = (uint32_t)filepaths[i].size();
+            offset += filepaths[i].size();
+        }
+        for (uint i = 0; i < filepaths.size(); i++)
+        {
+            struct stat status;
+            if (stat((prefix + filepaths[i]).c_str(), &status) != 0)
+            {
+                return false;
+            }
+            offset = (offset + ASSET_ARCHIVE_ALIGNMENT - 1) / ASSET_ARCHIVE_ALIGNMENT * ASSET_ARCHIVE_ALIGNMENT;
+            entries[i].offset = offset;
+            entries[i].size = (uint64_t)status.st_size;
+            entries[i].time = (int64_t)status.st_mtime;
+            offset += entries[i].size;
+        }
+
+        // Write header, index and filepaths
+        std::ofstream out(archiveFilepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(AssetArchiveHeader));
+        out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetArchiveEntry));
+        for (const std::string& rFilepath : filepaths)
+        {
+            out.write(rFilepath.data(), rFilepath.size());
+        }
+
+        // Write contents, padded to alignment
+        for (uint i = 0; i < filepaths.size(); i++)
+        {
+            while ((uint64_t)out.tellp() < entries[i].offset)
+            {
+                out.put(0);
+            }
+            std::ifstream in((prefix + filepaths[i]).c_str(), std::ios::in | std::ios::binary);
+            if (!in)
+            {
+                return false;
+            }
+            if (entries[i].size > 0)
+            {
+                out << in.rdbuf();
+            }
+
+            // File may have changed since index was filled
+            if ((uint64_t)out.tellp() != entries[i].offset + entries[i].size)
+            {
+                return false;
+            }
+        }
+        return out.good();
+    }
+
+    std::string AssetArchive::normalizeFilepath(std::string filepath)
+    {
+        // Forward slashes only
+        std::replace(filepath.begin(), filepath.end(), '\\', '/');
+
+        // Remove leading slashes and references to current directory
+        while (true)
+        {
+            if (filepath.compare(0, 2, "./") == 0)
+            {
+                filepath.erase(0, 2);
+            }
+            else if (filepath.compare(0, 1, "/") == 0)
+            {
+                filepath.erase(0, 1);
+            }
+            else
+            {
+                break;
+            }
+        }
+        return filepath;
+    }
+
+    uint AssetArchive::findIndex(std::string filepath) const
+    {
+        if (mCount == 0)
+        {
+            return mCount;
+        }
+        filepath = normalizeFilepath(filepath);
+
+        // Binary search in index, compares like std::string
+        uchar const * pData = mspMapping->getData();
+        uint lower = 0;
+        uint upper = mCount;
+        while (lower < upper)
+        {
+            uint middle = lower + (upper - lower) / 2;
+            AssetArchiveEntry entry = readEntry(pData, middle);
+            size_t length = std::min((size_t)entry.pathLength, filepath.size());
+            int result = std::memcmp(pData + entry.pathOffset, filepath.data(), length);
+            if (result == 0)
+            {
+                result = entry.pathLength < filepath.size() ? -1 : (entry.pathLength > filepath.size() ? 1 : 0);
+            }
+            if (result == 0)
+            {
+                return middle;
+            }
+            else if (result < 0)
+            {
+                lower = middle + 1;
+            }
+            else
+            {
+                upper = middle;
+            }
+        }
+        return mCount;
+    }
+}
@@ -0,0 +1,61 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Single file bundling all files below a root directory. Starts with a header,
+// followed by an index sorted by relative filepath, the filepaths and the
+// contents of the files. Archive is mapped into memory as a whole and files
+// are found by binary search, so looking up and reading them copies nothing.
+// Written by the packer tool.
+
+#ifndef ASSET_ARCHIVE_H_
+#define ASSET_ARCHIVE_H_
+
+#include "FileView.h"
+
+#include <vector>
+
+namespace eyegui
+{
+    class AssetArchive
+    {
+    public:
+
+        // Constructor, full filepath of archive expected
+        AssetArchive(std::string filepath);
+
+        // Destructor
+        virtual ~AssetArchive();
+
+        // Was archive found and is its index intact
+        bool isUsable() const { return mCount > 0; }
+
+        // Get number of files
+        uint getFileCount() const { return mCount; }
+
+        // Find file by filepath relative to root of archive. Returns false if not contained
+        bool find(std::string filepath, FileView& rView) const;
+
+        // Get size and modification time of contained file as it was packed
+        bool getFileStatus(std::string filepath, unsigned long long& rSize, long long& rTime) const;
+
+        // Write archive with given files, filepaths relative to root directory. Returns false on failure
+        static bool write(std::string rootDirectory, std::vector<std::string> filepaths, std::string archiveFilepath);
+
+        // Bring filepath into form used in index
+        static std::string normalizeFilepath(std::string filepath);
+
+    private:
+
+        // Get index of contained file, returns count if not contained
+        uint findIndex(std::string filepath) const;
+
+        // Members
+        std::shared_ptr<MappedFile const> mspMapping;
+        uint mCount;
+    };
+}
+
+#endif // ASSET_ARCHIVE_H_
@@ -0,0 +1,115 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "CommandQueue.h"
+
+namespace eyegui
+{
+    // Memory reserved for strings of each slot
+    static const size_t RESERVED_TEXT_LENGTH = 64;
+
+    CommandQueue::CommandQueue(uint capacity)
+    {
+        // Power of two allows masking of positions
+        size_t size = 1;
+        while (size < capacity)
+        {
+            size *= 2;
+        }
+        mupSlots = std::unique_ptr<Slot[]>(new Slot[size]);
+        mMask = size - 1;
+
+        // Slot is free when its sequence equals position of writing
+        for (size_t i = 0; i < size; i++)
+        {
+            mupSlots[i].sequence.store(i, std::memory_order_relaxed);
+            for (std::string& rText : mupSlots[i].command.texts)
+            {
+                rText.reserve(RESERVED_TEXT_LENGTH);
+            }
+            mupSlots[i].command.content.reserve(RESERVED_TEXT_LENGTH);
+        }
+        mEnqueuePosition.store(0, std::memory_order_relaxed);
+        mDequeuePosition = 0;
+        mExecuting = false;
+        mConsumerThread.store(std::this_thread::get_id());
+    }
+
+    CommandQueue::~CommandQueue()
+    {
+        // Nothing to do
+    }
+
+    void CommandQueue::execute()
+    {
+        mConsumerThread.store(std::this_thread::get_id());
+
+        // Command being executed may submit further calls, which must not execute it again
+        if (mExecuting)
+        {
+            return;
+        }
+        mExecuting = true;
+
+        // Execute at most one round, so producers cannot keep consumer busy
+        for (size_t i = 0; i <= mMask; i++)
+        {
+            Slot& rSlot = mupSlots[mDequeuePosition & mMask];
+            size_t sequence = rSlot.sequence.load(std::memory_order_acquire);
+            if ((std::intptr_t)(sequence - (mDequeuePosition + 1)) < 0)
+            {
+                // Empty or still being filled
+                break;
+            }
+
+            rSlot.command.function(rSlot.command);
+
+            // Release references before slot is given back to producers
+            rSlot.command.idMapper.clear();
+            rSlot.command.wpButtonListener.reset();
+            rSlot.command.wpSensorListener.reset();
+            rSlot.sequence.store(mDequeuePosition + mMask + 1, std::memory_order_release);
+            mDequeuePosition++;
+        }
+        mExecuting = false;
+    }
+
+    bool CommandQueue::isConsumerThread() const
+    {
+        return mConsumerThread.load() == std::this_thread::get_id();
+    }
+
+    CommandQueue::Slot& CommandQueue::claim(size_t& rPosition)
+    {
+        rPosition = mEnqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& rSlot = mupSlots[rPosition & mMask];
+            size_t sequence = rSlot.sequence.load(std::memory_order_acquire);
+            std::intptr_t difference = (std::intptr_t)(sequence - rPosition);
+            if (difference == 0)
+            {
+                // Slot is free, try to take it
+                if (mEnqueuePosition.compare_exchange_weak(rPosition, rPosition + 1, std::memory_order_relaxed))
+                {
+                    return rSlot;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Ring is full, wait for consumer
+                std::this_thread::yield();
+                rPosition = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                // Other producer was faster
+                rPosition = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Queue for mutating calls of the interface, owned by GUI. Calls on the
+// thread updating the GUI are executed immediately, after commands already
+// queued, so calls keep their order. Calls from any other thread are stored
+// as commands in a ring of preallocated slots without locking and executed
+// at the begin of next update. Slots are reused, so
+// strings of commands keep their memory and queueing does not allocate as
+// long as arguments fit into it. When ring is full, producers wait.
+
+#ifndef COMMAND_QUEUE_H_
+#define COMMAND_QUEUE_H_
+
+#include "eyeGUI.h"
+#include "Defines.h"
+
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <map>
+#include <cstdint>
+
+namespace eyegui
+{
+    class CommandQueue
+    {
+    public:
+
+        // Arguments of call, interpreted by function of command
+        struct Command
+        {
+            typedef void (*Function)(Command& rCommand);
+
+            Function function = NULL;
+            GUI* pGUI = NULL;
+            Layout* pLayout = NULL;
+            Layout const * pConstLayout = NULL;
+            std::string texts[3]; // Ids, filepaths, attributes and values
+            std::u16string content;
+            std::map<std::string, std::string> idMapper;
+            std::weak_ptr<ButtonListener> wpButtonListener;
+            std::weak_ptr<SensorListener> wpSensorListener;
+            StateRestoration restoration;
+            float values[4];
+            int integers[4]; // Sizes, indices and enumerations
+            bool flags[4];
+        };
+
+        // Constructor, capacity is rounded up to power of two
+        CommandQueue(uint capacity);
+
+        // Destructor
+        virtual ~CommandQueue();
+
+        // Execute call immediately or queue it. Fill is called with command to store arguments
+        template<typename Fill>
+        void submit(Fill fill, Command::Function function);
+
+        // Thread calling this becomes consumer, executes all queued commands. Nested calls
+        // from inside of executed commands return immediately
+        void execute();
+
+        // Is calling thread the one which executes commands
+        bool isConsumerThread() const;
+
+    private:
+
+        // Slot in ring, sequence tells whether it is free or filled
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            Command command;
+        };
+
+        // Claim free slot, waits while ring is full
+        Slot& claim(size_t& rPosition);
+
+        // Members
+        std::unique_ptr<Slot[]> mupSlots;
+        size_t mMask;
+        std::atomic<size_t> mEnqueuePosition;
+        size_t mDequeuePosition; // Only accessed by consumer
+        bool mExecuting; // Only accessed by consumer
+        std::atomic<std::thread::id> mConsumerThread;
+    };
+
+    template<typename Fill>
+    void CommandQueue::submit(Fill fill, Command::Function function)
+    {
+        // Consumer executes immediately, but after commands queued before by other threads
+        if (isConsumerThread())
+        {
+            execute();
+            Command command;
+            fill(command);
+            function(command);
+            return;
+        }
+
+        // Other threads fill slot and publish it
+        size_t position;
+        Slot& rSlot = claim(position);
+        fill(rSlot.command);
+        rSlot.command.function = function;
+        rSlot.sequence.store(position + 1, std::memory_order_release);
+    }
+}
+
+#endif // COMMAND_QUEUE_H_
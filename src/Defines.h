@@ -33,6 +33,8 @@ namespace eyegui
 	static const std::string STYLESHEET_EXTENSION = "seyegui";
 	static const std::string LOCALIZATION_EXTENSION = "leyegui";
 	static const float SVG_DPI = 96;
+	static const uint VECTOR_GRAPHICS_MIN_SIZE = 16; // Pixels of longer side when rasterized for element
+	static const uint VECTOR_GRAPHICS_MAX_SIZE = 2048;
 	static const int NOTIFICATION_MAX_LOOP_COUNT = 10;
 	static const float ACCUMULATED_TIME_PERIOD = 1800.0f;
 	static const float FONT_CHARACTER_PADDING = 0.02f; // Percentage of height
@@ -40,7 +42,23 @@ namespace eyegui
 	static const float FONT_TALL_SCREEN_HEIGHT = 0.05f;
 	static const float FONT_MEDIUM_SCREEN_HEIGHT = 0.035f;
 	static const float FONT_SMALL_SCREEN_HEIGHT = 0.0175f;
+	static const int FONT_DISTANCE_FIELD_PIXEL_HEIGHT = 64; // Reference height of glyphs in distance field atlas
+	static const int FONT_DISTANCE_FIELD_SPREAD = 8; // Pixels around outline of glyph covered by distance field
+	static const int FONT_RASTERIZATION_CHUNK_SIZE = 16; // Glyphs rasterized by thread before it takes next ones
+	static const int GLYPH_CACHE_MIN_PAGE_SIZE = 256; // Pixels, pages of glyphs rasterized on first use grow up to maximal size
+	static const int GLYPH_CACHE_MAX_PAGE_SIZE = 1024;
+	static const uint GLYPH_CACHE_MAX_PAGES = 4; // Per font size, afterwards least recently used glyphs are replaced
 	static const float RESIZE_WAIT_DURATION = 0.3f;
+	static const int FRAME_STATISTICS_HISTORY_SIZE = 128;
+	static const uint COMMAND_QUEUE_CAPACITY = 1024;
+	static const float LAYOUT_FINALIZATION_BUDGET = 0.004f; // Seconds per update
+	static const uint TEXTURE_MEMORY_BUDGET = 256 * 1024 * 1024; // Bytes of textures from files before unused ones are evicted
+	static const uint TEXTURE_REPLACEMENT_BUDGET = 4 * 1024 * 1024; // Bytes of decoded images uploaded per update
+	static const uint ICON_ATLAS_MIN_PAGE_SIZE = 512; // Pixels, pages grow up to maximal size before new one is created
+	static const uint ICON_ATLAS_MAX_PAGE_SIZE = 2048;
+	static const uint ICON_ATLAS_MAX_ICON_SIZE = 512; // Pixels of longer side, larger textures are not placed in pages
+	static const int ICON_ATLAS_MAX_MIPMAP_LEVEL = 3; // Deepest level sampled from pages, icons minified further alias
+	static const uint ICON_ATLAS_PADDING = 1 << ICON_ATLAS_MAX_MIPMAP_LEVEL; // Copies of border pixels around icon, one texel at deepest level
 	static const glm::vec4 RESIZE_BLEND_COLOR = glm::vec4(0.75f, 0.75f, 0.75f, 0.75f);
 	static const std::u16string LOCALIZATION_NOT_FOUND = u"";
 }
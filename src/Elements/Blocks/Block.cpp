@@ -7,6 +7,8 @@
 
 #include "Block.h"
 
+#include "Layout.h"
+
 namespace eyegui
 {
     Block::Block(
@@ -40,11 +42,6 @@ namespace eyegui
         // Fill members
         mConsumeInput = consumeInput;
         mInnerBorder = innerBorder;
-
-        // Fetch render item
-        mpBackground = pAssetManager->fetchRenderItem(
-            shaders::Type::BLOCK,
-            meshes::Type::QUAD);
     }
 
     Block::~Block()
@@ -68,29 +65,15 @@ namespace eyegui
     {
         if (getStyle()->backgroundColor.a > 0)
         {
-            // Bind render item before setting values and drawing
-            mpBackground->bind();
-
-            // Fill matrix in shader
-            mpBackground->getShader()->fillValue("matrix", mDrawMatrix);
-
-            // Fill color to shader
-            mpBackground->getShader()->fillValue(
-                "backgroundColor",
-                getStyle()->backgroundColor);
-
-            // Fill alpha
-            mpBackground->getShader()->fillValue("alpha", mAlpha);
-
-            // Fill activity
-            mpBackground->getShader()->fillValue("activity", mActivity.getValue());
-
-            // Fill dimming
-            mpBackground->getShader()->fillValue("dimColor", getStyle()->dimColor);
-            mpBackground->getShader()->fillValue("dimming", mDimming.getValue());
-
-            // Draw render item
-            mpBackground->draw();
+            // Fill values of background
+            QuadInstance instance;
+            instance.matrix = mDrawMatrix;
+            instance.color = getStyle()->backgroundColor;
+            instance.dimColor = getStyle()->dimColor;
+            instance.state = glm::vec4(mAlpha, mActivity.getValue(), mDimming.getValue(), 0);
+
+            // Let batch renderer draw it
+            mpLayout->getBatchRenderer()->drawQuad(shaders::Type::BLOCK, instance);
         }
     }
 
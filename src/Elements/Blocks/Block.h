@@ -59,7 +59,6 @@ namespace eyegui
     private:
 
         // Members
-        RenderItem const * mpBackground;
         float mInnerBorder; // [0..1]
         bool mConsumeInput;
     };
@@ -52,9 +52,6 @@ namespace eyegui
         mAlignment = alignment;
         mPadding = padding;
         mSeparator = separator;
-        mpSeparator = mpAssetManager->fetchRenderItem(
-            shaders::Type::SEPARATOR,
-            meshes::Type::QUAD);
     }
 
     Stack::~Stack()
@@ -75,28 +72,18 @@ namespace eyegui
         // Draw separators
         if (mSeparatorDrawMatrices.size() > 0 && getStyle()->separatorColor.a > 0)
         {
-            // Bind render item before setting values and drawing
-            mpSeparator->bind();
-
-            // Fill color to shader
-            mpSeparator->getShader()->fillValue(
-                "separatorColor",
-                getStyle()->separatorColor);
-
-            // Fill alpha
-            mpSeparator->getShader()->fillValue("alpha", mAlpha);
-
-            // Fill dimming
-            mpSeparator->getShader()->fillValue("dimColor", getStyle()->dimColor);
-            mpSeparator->getShader()->fillValue("dimming", mDimming.getValue());
+            // Values shared by all separators
+            QuadInstance instance;
+            instance.color = getStyle()->separatorColor;
+            instance.dimColor = getStyle()->dimColor;
+            instance.state = glm::vec4(mAlpha, 0, mDimming.getValue(), 0);
 
+            BatchRenderer* pBatchRenderer = mpLayout->getBatchRenderer();
             for (int i = 0; i < mSeparatorDrawMatrices.size(); i++)
             {
-                // Fill matrix in shader
-                mpSeparator->getShader()->fillValue("matrix", mSeparatorDrawMatrices[i]);
-
-                // Draw render item
-                mpSeparator->draw();
+                // Fill matrix and let batch renderer draw it
+                instance.matrix = mSeparatorDrawMatrices[i];
+                pBatchRenderer->drawQuad(shaders::Type::SEPARATOR, instance);
             }
         }
     }
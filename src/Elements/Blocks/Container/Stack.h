@@ -76,7 +76,6 @@ namespace eyegui
         Alignment mAlignment;
         float mPadding; // [0..1]
         float mSeparator; // [0..1]
-        RenderItem const * mpSeparator;
         std::vector<glm::mat4> mSeparatorDrawMatrices;
     };
 }
@@ -90,6 +90,7 @@ namespace eyegui
         else
         {
             mupTextFlow->setContent(content);
+            markDirty();
         }
     }
 
@@ -114,10 +115,23 @@ namespace eyegui
             {
                 mKey = key;
                 mupTextFlow->setContent(localization);
+                markDirty();
             }
         }
     }
 
+    float TextBlock::specialUpdate(float tpf, Input* pInput)
+    {
+        // Glyphs used by text may have been replaced or moved in caches of font
+        if (mupTextFlow->update())
+        {
+            markDirty();
+        }
+
+        // Super call
+        return Block::specialUpdate(tpf, pInput);
+    }
+
     void TextBlock::specialDraw() const
     {
         // Super call
@@ -127,7 +141,7 @@ namespace eyegui
         glm::vec4 color = getStyle()->fontColor;
         color.a *= mAlpha;
         color *= (1.0f - mDimming.getValue()) + (mDimming.getValue() * getStyle()->dimColor);
-        mupTextFlow->draw(1.0f, color);
+        mpLayout->getBatchRenderer()->drawText(mupTextFlow.get(), 1.0f, color);
     }
 
     void TextBlock::specialTransformAndSize()
@@ -51,6 +51,9 @@ namespace eyegui
 
     protected:
 
+        // Updating filled by subclasses, returns adaptive scale
+        virtual float specialUpdate(float tpf, Input* pInput);
+
         // Drawing filled by subclasses
         virtual void specialDraw() const;
 
@@ -145,6 +145,7 @@ namespace eyegui
         if(pStyle != NULL)
         {
             mpStyle = pStyle;
+            markDirty();
         }
         else
         {
@@ -159,7 +160,11 @@ namespace eyegui
 
     void Element::setAlpha(float alpha)
     {
-        mAlpha = alpha;
+        if (mAlpha != alpha)
+        {
+            mAlpha = alpha;
+            markDirty();
+        }
     }
 
     float Element::getAlpha() const
@@ -186,6 +191,7 @@ namespace eyegui
                     if (!fade)
                     {
                         mActivity.setValue(1);
+                        markDirty();
                     }
 
                     // Do it for all children
@@ -203,6 +209,7 @@ namespace eyegui
                 if (!fade)
                 {
                     mActivity.setValue(0);
+                    markDirty();
                 }
 
                 // Do it for all children
@@ -319,6 +326,12 @@ namespace eyegui
             height -= (int)(usedBorder * mBorderAspectRatio);
         }
 
+        // Changed transformation has to be drawn
+        if (x != mX || y != mY || width != mWidth || height != mHeight)
+        {
+            markDirty();
+        }
+
         // Save values to members
         mX = x;
         mY = y;
@@ -359,11 +372,23 @@ namespace eyegui
 
     void Element::setHiding(bool hidden)
     {
-        mHidden = hidden;
+        if (mHidden != hidden)
+        {
+            mHidden = hidden;
+            markDirty();
+        }
     }
 
     float Element::update(float tpf, float alpha, Input* pInput, float dimming)
     {
+        mpLayout->getFrameStatisticsRecorder()->countUpdatedElement();
+
+        // Remember values to detect visual changes
+        float previousAlpha = mAlpha;
+        float previousActivity = mActivity.getValue();
+        float previousDimming = mDimming.getValue();
+        float previousAdaptiveScale = mAdaptiveScale.getValue();
+
         // Activity animationa
         mActivity.update(tpf, !mActive);
 
@@ -449,6 +474,15 @@ namespace eyegui
         // If it would be not saved in member, nobody would know about it at rendering.
         mAdaptiveScale.setValue(std::max(mAdaptiveScale.getValue(), specialAdaptiveScale));
 
+        // Check whether any animated value has changed
+        if (previousAlpha != mAlpha
+            || previousActivity != mActivity.getValue()
+            || previousDimming != mDimming.getValue()
+            || previousAdaptiveScale != mAdaptiveScale.getValue())
+        {
+            markDirty();
+        }
+
         // Return adaptive scale
         return mAdaptiveScale.getValue();
     }
@@ -458,14 +492,20 @@ namespace eyegui
         // Only draw if visible
         if (mAlpha > 0 && !mHidden)
         {
-            // Draw the element
+            // Draw the element one level deeper than parent
+            BatchRenderer* pBatchRenderer = mpLayout->getBatchRenderer();
+            pBatchRenderer->enterElement();
             specialDraw();
 
             // Draw fading replaced elements if available (always mutliplied with own alpha)
             if (mupReplacedElement.get() != NULL)
             {
+                // Replaced element overlaps this one, so draw collected quads before and after it
+                pBatchRenderer->flush();
                 mupReplacedElement->draw();
+                pBatchRenderer->flush();
             }
+            pBatchRenderer->leaveElement();
         }
     }
 
@@ -478,6 +518,7 @@ namespace eyegui
         mForceUndim = false;
 
         mAdaptiveScale.setValue(0);
+        markDirty();
 
         // Do reset implemented by subclass
         specialReset();
@@ -559,6 +600,8 @@ namespace eyegui
 
     void Element::commitReplacedElement(std::unique_ptr<Element> upElement, bool fade)
     {
+        markDirty();
+
         if (fade)
         {
             // Fading is wished, so remember the replaced element
@@ -615,4 +658,9 @@ namespace eyegui
         }
         return false;
     }
+
+    void Element::markDirty()
+    {
+        mpFrame->markDirty();
+    }
 }
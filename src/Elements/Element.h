@@ -215,6 +215,9 @@ namespace eyegui
         // Checks, whether element is penetrated by input
         virtual bool penetratedByInput(Input const * pInput) const;
 
+        // Mark frame of element to be drawn again
+        void markDirty();
+
         // Members
         int mX, mY, mWidth, mHeight; // ONLY PIXEL BASED VALUES HERE
         Type mType;
@@ -39,10 +39,8 @@ namespace eyegui
 	{
 		mType = Type::BOX_BUTTON;
 
-		// Fetch stuff for rendering
-		mpRenderItem = mpAssetManager->fetchRenderItem(
-			shaders::Type::BOX_BUTTON,
-			meshes::Type::QUAD);
+		// Shader for rendering
+		mShaderType = shaders::Type::BOX_BUTTON;
 	}
 
 	BoxButton::~BoxButton()
@@ -50,16 +48,15 @@ namespace eyegui
 		// Nothing to do here
 	}
 
-	void BoxButton::specialDraw() const
+	void BoxButton::fillInstance(QuadInstance& rInstance) const
 	{
-		// Bind render item before setting values and drawing
-		mpRenderItem->bind();
-
 		// Super call
-		Button::specialDraw();
+		Button::fillInstance(rInstance);
 
 		// Scale of icon
-		mpRenderItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
+		glm::vec2 iconUVScale = iconAspectRatioCorrection();
+		rInstance.icon.x = iconUVScale.x;
+		rInstance.icon.y = iconUVScale.y;
 
 		// Orientation
 		float orientation = 0;
@@ -70,9 +67,6 @@ namespace eyegui
 				orientation = 1;
 			}
 		}
-		mpRenderItem->getShader()->fillValue("orientation", orientation);
-
-		// Draw render item
-		mpRenderItem->draw();
+		rInstance.icon.z = orientation;
 	}
 }
@@ -38,8 +38,8 @@ namespace eyegui
 
 	protected:
 
-		// Drawing filled by subclasses
-		virtual void specialDraw() const;
+		// Fill values for drawing
+		virtual void fillInstance(QuadInstance& rInstance) const;
 	};
 }
 
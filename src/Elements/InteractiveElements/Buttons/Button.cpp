@@ -93,6 +93,7 @@ namespace eyegui
             if (immediately)
             {
                 mPressing.setValue(1);
+                markDirty();
             }
         }
     }
@@ -114,6 +115,7 @@ namespace eyegui
             if (immediately)
             {
                 mPressing.setValue(0);
+                markDirty();
             }
         }
     }
@@ -133,6 +135,10 @@ namespace eyegui
         // Super call
         float adaptiveScale = InteractiveElement::specialUpdate(tpf, pInput);
 
+        // Remember values to detect visual changes
+        float previousPressing = mPressing.getValue();
+        float previousThreshold = mThreshold.getValue();
+
 		// Check for penetration by input
         bool penetrated = penetratedByInput(pInput);
         if (penetrated)
@@ -176,16 +182,22 @@ namespace eyegui
             mThreshold.update(-tpf / mpLayout->getConfig()->buttonThresholdDecreaseDuration);
         }
 
+        // Check whether values have changed
+        if (previousPressing != mPressing.getValue() || previousThreshold != mThreshold.getValue())
+        {
+            markDirty();
+        }
+
         return adaptiveScale;
     }
 
-    void Button::specialDraw() const
+    void Button::fillInstance(QuadInstance& rInstance) const
     {
         // Super call
-        InteractiveElement::specialDraw();
+        InteractiveElement::fillInstance(rInstance);
 
-        mpRenderItem->getShader()->fillValue("threshold", mThreshold.getValue());
-        mpRenderItem->getShader()->fillValue("pressing", mPressing.getValue());
+        rInstance.interaction.y = mThreshold.getValue();
+        rInstance.interaction.z = mPressing.getValue();
     }
 
     void Button::specialTransformAndSize()
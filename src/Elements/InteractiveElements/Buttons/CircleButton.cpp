@@ -39,8 +39,8 @@ namespace eyegui
 	{
 		mType = Type::CIRCLE_BUTTON;
 
-		// Fetch stuff for rendering
-		mpRenderItem = mpAssetManager->fetchRenderItem(shaders::Type::CIRCLE_BUTTON, meshes::Type::QUAD);
+		// Shader for rendering
+		mShaderType = shaders::Type::CIRCLE_BUTTON;
 	}
 
 	CircleButton::~CircleButton()
@@ -48,18 +48,6 @@ namespace eyegui
 		// Nothing to do here
 	}
 
-	void CircleButton::specialDraw() const
-	{
-		// Bind render item before setting values and drawing
-		mpRenderItem->bind();
-
-		// Super call
-		Button::specialDraw();
-
-		// Draw render item
-		mpRenderItem->draw();
-	}
-
 	void CircleButton::evaluateSize(
 		int availableWidth,
 		int availableHeight,
@@ -42,11 +42,6 @@ namespace eyegui
 			int availableHeight,
 			int& rWidth,
 			int& rHeight) const;
-
-	protected:
-
-		// Drawing filled by subclasses
-		virtual void specialDraw() const;
 	};
 }
 
@@ -35,13 +35,13 @@ namespace eyegui
 			relativeScale,
 			border,
 			dimmable,
-			adaptiveScaling)
+			adaptiveScaling),
+		mIcon(pAssetManager)
 	{
 		mType = Type::INTERACTIVE_ELEMENT;
 
 		// Filling members
 		setIcon(iconFilepath);
-		mpRenderItem = NULL;
 		mHighlight.setValue(0);
 		mIsHighlighted = false;
 		mSelection.setValue(0);
@@ -78,14 +78,8 @@ namespace eyegui
 
 	void InteractiveElement::setIcon(std::string filepath)
 	{
-		if (filepath != EMPTY_STRING_ATTRIBUTE)
-		{
-			mpIcon = mpAssetManager->fetchTexture(filepath);
-		}
-		else
-		{
-			mpIcon = mpAssetManager->fetchTexture(graphics::Type::NOT_FOUND);
-		}
+		mIcon.set(filepath);
+		markDirty();
 	}
 
 	void InteractiveElement::pipeNotification(Notification notification, Layout* pLayout)
@@ -104,33 +98,53 @@ namespace eyegui
 
 	float InteractiveElement::specialUpdate(float tpf, Input* pInput)
 	{
+		// Remember values to detect visual changes
+		float previousHighlight = mHighlight.getValue();
+		float previousSelection = mSelection.getValue();
+
 		// Highlight
 		mHighlight.update(tpf, !mIsHighlighted);
 
 		// Selection
 		mSelection.update(tpf / mpLayout->getConfig()->animationDuration, !mIsSelected);
 
+		// Icon may be rasterized for drawn size
+		if (mIcon.update(mWidth, mHeight))
+		{
+			markDirty();
+		}
+
+		// Highlight is animated over time by shader
+		if (mHighlight.getValue() > 0
+			|| previousHighlight != mHighlight.getValue()
+			|| previousSelection != mSelection.getValue())
+		{
+			markDirty();
+		}
+
 		return 0;
 	}
 
 	void InteractiveElement::specialDraw() const
 	{
-		// Fill shader
-		mpRenderItem->getShader()->fillValue("matrix", mDrawMatrix);
-		mpRenderItem->getShader()->fillValue("highlight", mHighlight.getValue());
-		mpRenderItem->getShader()->fillValue("alpha", mAlpha);
-		mpRenderItem->getShader()->fillValue("activity", mActivity.getValue());
-		mpRenderItem->getShader()->fillValue("selection", mSelection.getValue());
-		mpRenderItem->getShader()->fillValue("color", getStyle()->color);
-		mpRenderItem->getShader()->fillValue("highlightColor", getStyle()->highlightColor);
-		mpRenderItem->getShader()->fillValue("selectionColor", getStyle()->selectionColor);
-		mpRenderItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-		mpRenderItem->getShader()->fillValue("time", mpLayout->getAccPeriodicTime());
-		mpRenderItem->getShader()->fillValue("dimColor", getStyle()->dimColor);
-		mpRenderItem->getShader()->fillValue("dimming", mDimming.getValue());
-
-		// Bind icon texture
-		mpIcon->bind(0);
+		// Collect values of subclasses
+		QuadInstance instance;
+		fillInstance(instance);
+
+		// Let batch renderer draw it with icon
+		mpLayout->getBatchRenderer()->drawQuad(mShaderType, instance, mIcon.get());
+	}
+
+	void InteractiveElement::fillInstance(QuadInstance& rInstance) const
+	{
+		rInstance.matrix = mDrawMatrix;
+		rInstance.color = getStyle()->color;
+		rInstance.highlightColor = getStyle()->highlightColor;
+		rInstance.selectionColor = getStyle()->selectionColor;
+		rInstance.iconColor = getStyle()->iconColor;
+		rInstance.dimColor = getStyle()->dimColor;
+		rInstance.state = glm::vec4(mAlpha, mActivity.getValue(), mDimming.getValue(), mHighlight.getValue());
+		rInstance.interaction.x = mSelection.getValue();
 	}
 
 	void InteractiveElement::specialReset()
@@ -144,7 +158,7 @@ namespace eyegui
 	glm::vec2 InteractiveElement::iconAspectRatioCorrection() const
 	{
 		float aspectRatio = (float)mWidth / (float)mHeight;
-		float iconAspectRatio = mpIcon->getAspectRatio();
+		float iconAspectRatio = mIcon.getAspectRatio();
 		float relation = aspectRatio / iconAspectRatio;
 		glm::vec2 iconUVScale;
 		if (relation >= 1)
@@ -11,6 +11,8 @@
 #define INTERACTIVE_ELEMENT_H_
 
 #include "Elements/Element.h"
+#include "Rendering/BatchRenderer.h"
+#include "Rendering/ElementTexture.h"
 
 namespace eyegui
 {
@@ -77,11 +79,14 @@ namespace eyegui
 		// Filled by subclass and called by layout after updating
 		virtual void specialPipeNotification(Notification notification, Layout* pLayout) = 0;
 
+		// Fill values for drawing, extended by subclasses
+		virtual void fillInstance(QuadInstance& rInstance) const;
+
 		// Calculate aspect ratio correction for icon on gizmo
 		glm::vec2 iconAspectRatioCorrection() const;
 
 		// Members
-		RenderItem const * mpRenderItem; // has to be initialized by subclasses
+		shaders::Type mShaderType; // has to be initialized by subclasses
 
 	private:
 
@@ -90,7 +95,7 @@ namespace eyegui
 		bool mIsHighlighted;
 		LerpValue mSelection;
 		bool mIsSelected;
-		Texture const * mpIcon;
+		ElementTexture mIcon;
 	};
 }
 
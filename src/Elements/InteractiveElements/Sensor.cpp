@@ -42,9 +42,7 @@ namespace eyegui
 	{
 		// Fill members
 		mType = Type::SENSOR;
-		mpRenderItem = mpAssetManager->fetchRenderItem(
-			shaders::Type::SENSOR,
-			meshes::Type::QUAD);
+		mShaderType = shaders::Type::SENSOR;
 		mPenetration.setValue(0);
 	}
 
@@ -57,6 +55,7 @@ namespace eyegui
 	{
 		// Penetrate
 		mPenetration.update(amount);
+		markDirty();
 
 		// Remove highlight
 		highlight(false);
@@ -67,6 +66,9 @@ namespace eyegui
 		// Super call
 		InteractiveElement::specialUpdate(tpf, pInput);
 
+		// Remember value to detect visual changes
+		float previousPenetration = mPenetration.getValue();
+
 		// Penetration by input
 		bool penetrated = penetratedByInput(pInput);
 		if (penetrated)
@@ -78,6 +80,10 @@ namespace eyegui
 			highlight(false);
 		}
 		mPenetration.update(tpf / mpLayout->getConfig()->sensorPenetrationDecreaseDuration, !penetrated);
+		if (previousPenetration != mPenetration.getValue())
+		{
+			markDirty();
+		}
 
 		// Inform listener after updating when penetrated
 		if (mPenetration.getValue() > 0)
@@ -88,22 +94,18 @@ namespace eyegui
 		return 0;
 	}
 
-	void Sensor::specialDraw() const
+	void Sensor::fillInstance(QuadInstance& rInstance) const
 	{
-		// Bind render item before setting values and drawing
-		mpRenderItem->bind();
-
 		// Super call
-		InteractiveElement::specialDraw();
+		InteractiveElement::fillInstance(rInstance);
 
 		// Fill other values
-		mpRenderItem->getShader()->fillValue("penetration", mPenetration.getValue());
+		rInstance.interaction.w = mPenetration.getValue();
 
 		// Scale of icon
-		mpRenderItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-
-		// Draw render item
-		mpRenderItem->draw();
+		glm::vec2 iconUVScale = iconAspectRatioCorrection();
+		rInstance.icon.x = iconUVScale.x;
+		rInstance.icon.y = iconUVScale.y;
 	}
 
 	void Sensor::specialTransformAndSize()
@@ -45,8 +45,8 @@ namespace eyegui
 		// Updating filled by subclasses, returns adaptive scale
 		virtual float specialUpdate(float tpf, Input* pInput);
 
-		// Drawing filled by subclasses
-		virtual void specialDraw() const;
+		// Fill values for drawing
+		virtual void fillInstance(QuadInstance& rInstance) const;
 
 		// Transformation filled by subclasses
 		virtual void specialTransformAndSize();
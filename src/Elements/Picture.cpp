@@ -7,6 +7,8 @@
 
 #include "Picture.h"
 
+#include "Layout.h"
+
 namespace eyegui
 {
 	Picture::Picture(
@@ -33,19 +35,19 @@ namespace eyegui
 			relativeScale,
 			border,
 			dimmable,
-			adaptiveScaling)
+			adaptiveScaling),
+		mImage(pAssetManager)
 	{
 		mType = Type::PICTURE;
 
 		// Fill members
-		mpQuad = mpAssetManager->fetchRenderItem(shaders::Type::PICTURE, meshes::Type::QUAD);
-		mpImage = mpAssetManager->fetchTexture(filepath);
+		mImage.set(filepath);
 		mAlignment = alignment;
 
 		// Aspect ratio of border should be preserved if necessary
 		if (mAlignment == PictureAlignment::ORIGINAL)
 		{
-			mBorderAspectRatio = (float)(mpImage->getWidth()) / (float)(mpImage->getHeight());
+			mBorderAspectRatio = mImage.getAspectRatio();
 		}
 
 	}
@@ -64,7 +66,7 @@ namespace eyegui
 		if (mAlignment == PictureAlignment::ORIGINAL)
 		{
 			float availableAspectRatio = ((float)availableWidth) / ((float)availableHeight);
-			float aspectRatio = (float)(mpImage->getWidth()) / (float)(mpImage->getHeight());
+			float aspectRatio = mImage.getAspectRatio();
 
 			if (availableAspectRatio < aspectRatio)
 			{
@@ -92,6 +94,23 @@ namespace eyegui
 
 	float Picture::specialUpdate(float tpf, Input* pInput)
 	{
+		// Image may be rasterized for drawn size
+		if (mImage.update(mWidth, mHeight))
+		{
+			markDirty();
+		}
+
+		// Image may be decoded in background and replace placeholder later
+		if (mAlignment == PictureAlignment::ORIGINAL)
+		{
+			float aspectRatio = mImage.getAspectRatio();
+			if (aspectRatio != mBorderAspectRatio)
+			{
+				mBorderAspectRatio = aspectRatio;
+				mpFrame->makeResizeNecessary();
+			}
+		}
+
 		// If mouse over picture, consume input
 		if (penetratedByInput(pInput))
 		{
@@ -103,27 +122,14 @@ namespace eyegui
 
 	void Picture::specialDraw() const
 	{
-		// Bind render item before setting values and drawing
-		mpQuad->bind();
-
-		// Fill matrix in shader
-		mpQuad->getShader()->fillValue("matrix", mDrawMatrix);
-
-		// Fill alpha
-		mpQuad->getShader()->fillValue("alpha", mAlpha);
-
-		// Fill activity
-		mpQuad->getShader()->fillValue("activity", mActivity.getValue());
-
-		// Fill dimming
-		mpQuad->getShader()->fillValue("dimColor", getStyle()->dimColor);
-		mpQuad->getShader()->fillValue("dimming", mDimming.getValue());
-
-		// Bind image
-		mpImage->bind(0);
-
-		// Draw render item
-		mpQuad->draw();
+		// Fill values of picture
+		QuadInstance instance;
+		instance.matrix = mDrawMatrix;
+		instance.dimColor = getStyle()->dimColor;
+		instance.state = glm::vec4(mAlpha, mActivity.getValue(), mDimming.getValue(), 0);
+
+		// Let batch renderer draw it with image
+		mpLayout->getBatchRenderer()->drawQuad(shaders::Type::PICTURE, instance, mImage.get());
 	}
 
 	void Picture::specialTransformAndSize()
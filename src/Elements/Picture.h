@@ -10,6 +10,7 @@
 #define PICTURE_H_
 
 #include "Element.h"
+#include "Rendering/ElementTexture.h"
 
 namespace eyegui
 {
@@ -60,8 +61,7 @@ namespace eyegui
 	private:
 
 		// Members
-		RenderItem const * mpQuad;
-		Texture const * mpImage;
+		ElementTexture mImage;
 		PictureAlignment mAlignment;
 	};
 }
@@ -0,0 +1,56 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Read only view of the content of a file, either inside the mapped asset
+// archive or of a loose file mapped on its own. Keeps the mapping alive, so
+// content stays valid as long as the view exists. Created by path builder.
+
+#ifndef FILE_VIEW_H_
+#define FILE_VIEW_H_
+
+#include "MappedFile.h"
+
+#include <memory>
+#include <string>
+
+namespace eyegui
+{
+    class FileView
+    {
+    public:
+
+        // Constructor for missing file
+        FileView() : mpData(NULL), mSize(0) {}
+
+        // Constructor for content inside mapping
+        FileView(std::shared_ptr<MappedFile const> spMapping, uchar const * pData, size_t size)
+            : mspMapping(spMapping), mpData(pData), mSize(size) {}
+
+        // Was file found. Empty loose files count as missing
+        bool isValid() const { return mpData != NULL; }
+
+        // Getter for content
+        uchar const * getData() const { return mpData; }
+
+        // Getter for content as characters
+        char const * getChars() const { return reinterpret_cast<char const *>(mpData); }
+
+        // Getter for size of content in bytes
+        size_t getSize() const { return mSize; }
+
+        // Copy content into string
+        std::string toString() const { return isValid() ? std::string(getChars(), mSize) : std::string(); }
+
+    private:
+
+        // Members
+        std::shared_ptr<MappedFile const> mspMapping;
+        uchar const * mpData;
+        size_t mSize;
+    };
+}
+
+#endif // FILE_VIEW_H_
@@ -25,10 +25,13 @@ namespace eyegui
         mpLayout = pLayout;
         mFrameAlpha.setValue(1);
         mCombinedAlpha = 1;
+        mElementAlpha = 1;
         mRemovedFadingAlpha = 1;
         mVisible = true;
         mupRoot = NULL;
         mResizeNecessary = true;
+        mDirty = true;
+        mCompositionDirty = false;
         mRelativePositionX = relativePositionX;
         mRelativePositionY = relativePositionY;
         mRelativeSizeX = relativeSizeX;
@@ -93,7 +96,28 @@ namespace eyegui
         mFrameAlpha.update(tpf / mpLayout->getConfig()->animationDuration, !mVisible);
 
         // Combine own alpha with layout's
-        mCombinedAlpha = mFrameAlpha.getValue() * mRemovedFadingAlpha * alpha;
+        float combinedAlpha = mFrameAlpha.getValue() * mRemovedFadingAlpha * alpha;
+        if (combinedAlpha != mCombinedAlpha)
+        {
+            mCombinedAlpha = combinedAlpha;
+            mCompositionDirty = true;
+        }
+
+        // Alpha applied at composition of offscreen layers is not given to elements
+        float elementAlpha = mCombinedAlpha;
+        if (mupLayer.get() != NULL)
+        {
+            elementAlpha = 1;
+        }
+        else if (mpLayout->hasOffscreenLayer())
+        {
+            elementAlpha = mFrameAlpha.getValue() * mRemovedFadingAlpha;
+        }
+        if (elementAlpha != mElementAlpha)
+        {
+            mElementAlpha = elementAlpha;
+            mDirty = true;
+        }
 
          // *** OWN ROOT AND FRONT ELEMENTS ***
 
@@ -115,7 +139,7 @@ namespace eyegui
             }
 
             // Update standard elements
-            float adaptiveScale = mupRoot->update(tpf, mCombinedAlpha, pInput, 0);
+            float adaptiveScale = mupRoot->update(tpf, mElementAlpha, pInput, 0);
             if (adaptiveScale > 0)
             {
                 mResizeNecessary = true;
@@ -134,18 +158,50 @@ namespace eyegui
         // Use alpha because while fading it should still draw
         if (mCombinedAlpha > 0)
         {
-            // Draw standard elements
-            mupRoot->draw();
-
-            // Draw front elements (other way than expected because inner ones are added first)
-            for (int i = (int)mFrontElements.size() - 1; i >= 0; i--)
+            if (mupLayer.get() != NULL)
             {
-                Element const * pElement = mFrontElements[i];
-                pElement->draw();
+                // Render content again only if it has changed
+                if (mDirty || mupLayer->isOutdated())
+                {
+                    mupLayer->beginRendering();
+                    drawContent();
+                    mupLayer->endRendering();
+                }
+                mupLayer->composite(mCombinedAlpha);
             }
+            else
+            {
+                drawContent();
+            }
+        }
+        else
+        {
+            skipDrawing();
+        }
+    }
+
+    void Frame::skipDrawing() const
+    {
+        if (mDirty && mupLayer.get() != NULL)
+        {
+            mupLayer->invalidate();
+        }
+    }
+
+    void Frame::useOffscreenLayer(bool use)
+    {
+        if (use != (mupLayer.get() != NULL))
+        {
+            mupLayer = use ? mpLayout->createOffscreenLayer() : NULL;
+            mDirty = true;
         }
     }
 
+    bool Frame::hasOffscreenLayer() const
+    {
+        return mupLayer.get() != NULL;
+    }
+
     void Frame::makeResizeNecessary()
     {
         mResizeNecessary = true;
@@ -155,6 +211,7 @@ namespace eyegui
     {
         // Initial resize is done at first update
         mupRoot = std::move(upElement);
+        mDirty = true;
     }
 
     std::unique_ptr<Element> Frame::replaceRoot(std::unique_ptr<Element> upElement)
@@ -167,6 +224,7 @@ namespace eyegui
     void Frame::registerFrontElementForUpdateAndDraw(Element* pElement, bool visible)
     {
         mFrontElements.push_back(pElement);
+        mDirty = true;
 
         if (visible)
         {
@@ -180,7 +238,12 @@ namespace eyegui
 
     void Frame::setFrontElementAlpha(Element* pElement, float alpha)
     {
-        mFrontElementAlphas[pElement] = alpha;
+        float& rAlpha = mFrontElementAlphas[pElement];
+        if (rAlpha != alpha)
+        {
+            rAlpha = alpha;
+            mDirty = true;
+        }
     }
 
     void Frame::commitDyingReplacedElement(std::unique_ptr<Element> upElement)
@@ -202,6 +265,7 @@ namespace eyegui
             {
                 mFrameAlpha.setValue(0);
             }
+            mDirty = true;
         }
     }
 
@@ -217,6 +281,8 @@ namespace eyegui
 
     void Frame::removeFrontElementsOfElement(Element* pTarget)
     {
+        mDirty = true;
+
         // Get rid of front element
         for (Element* pFrontElement : mFrontElements)
         {
@@ -300,6 +366,28 @@ namespace eyegui
     {
         mRelativePositionX = relativePositionX;
         mRelativePositionY = relativePositionY;
+        mResizeNecessary = true;
+    }
+
+    void Frame::markDirty()
+    {
+        mDirty = true;
+    }
+
+    bool Frame::isDirty() const
+    {
+        return mDirty || mCompositionDirty;
+    }
+
+    bool Frame::isContentDirty() const
+    {
+        return mDirty;
+    }
+
+    void Frame::clearDirty()
+    {
+        mDirty = false;
+        mCompositionDirty = false;
     }
 
     void Frame::setSize(float relativeSizeX, float relativeSizeY)
@@ -333,6 +421,9 @@ namespace eyegui
                 usedWidth,
                 usedHeight);
             mResizeNecessary = false;
+            mDirty = true;
+
+            mpLayout->getFrameStatisticsRecorder()->countRelayout();
         }
     }
 
@@ -341,4 +432,20 @@ namespace eyegui
         mRelativeSizeX = std::max(mRelativeSizeX, 0.0f);
         mRelativeSizeY = std::max(mRelativeSizeY, 0.0f);
     }
+
+    void Frame::drawContent() const
+    {
+        // Draw standard elements
+        BatchRenderer* pBatchRenderer = mpLayout->getBatchRenderer();
+        mupRoot->draw();
+        pBatchRenderer->flush();
+
+        // Draw front elements (other way than expected because inner ones are added first)
+        for (int i = (int)mFrontElements.size() - 1; i >= 0; i--)
+        {
+            Element const * pElement = mFrontElements[i];
+            pElement->draw();
+            pBatchRenderer->flush();
+        }
+    }
 }
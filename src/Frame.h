@@ -15,6 +15,7 @@
 #include "Object.h"
 #include "Elements/Elements.h"
 #include "LerpValue.h"
+#include "Rendering/OffscreenLayer.h"
 
 #include <memory>
 #include <map>
@@ -58,6 +59,15 @@ namespace eyegui
         // Drawing
         void draw() const;
 
+        // Drawing is skipped, so layer has to be rendered again if content changed meanwhile
+        void skipDrawing() const;
+
+        // Use own offscreen layer, which is composited with alpha of frame
+        void useOffscreenLayer(bool use);
+
+        // Has frame its own offscreen layer
+        bool hasOffscreenLayer() const;
+
         // Make resize necessary
         void makeResizeNecessary();
 
@@ -118,6 +128,18 @@ namespace eyegui
         // Set size
         void setSize(float relativeSizeX, float relativeSizeY);
 
+        // Mark frame to be drawn again
+        void markDirty();
+
+        // Has anything visible changed since last drawing
+        bool isDirty() const;
+
+        // Has content changed since last drawing, not only alpha of frame
+        bool isContentDirty() const;
+
+        // Drawing has been done
+        void clearDirty();
+
     private:
 
         // Resize function
@@ -126,16 +148,23 @@ namespace eyegui
         // Clamp size
         void clampSize();
 
+        // Draw root and front elements
+        void drawContent() const;
+
         // Members
         Layout const * mpLayout;
         std::unique_ptr<Element> mupRoot;
         LerpValue mFrameAlpha;
         float mCombinedAlpha;
+        float mElementAlpha; // Combined alpha without alpha applied by offscreen layers
         bool mVisible;
         std::vector<Element*> mFrontElements;
         std::map<Element*, float> mFrontElementAlphas;
         std::vector<std::unique_ptr<Element> > mDyingReplacedElements;
         bool mResizeNecessary;
+        bool mDirty;
+        bool mCompositionDirty; // Only alpha of frame changed
+        std::unique_ptr<OffscreenLayer> mupLayer;
         float mRelativePositionX;
         float mRelativePositionY;
         float mRelativeSizeX;
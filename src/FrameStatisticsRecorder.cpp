@@ -0,0 +1,199 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "FrameStatisticsRecorder.h"
+
+#include "Helper.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eyegui
+{
+    FrameStatisticsRecorder::FrameStatisticsRecorder()
+    {
+        // Initialize members
+        mEnabled = false;
+        mFrameOpen = false;
+        mHistory.resize(FRAME_STATISTICS_HISTORY_SIZE);
+        mHistoryIndex = 0;
+        mHistoryCount = 0;
+    }
+
+    FrameStatisticsRecorder::~FrameStatisticsRecorder()
+    {
+        // Nothing to do
+    }
+
+    void FrameStatisticsRecorder::setEnabled(bool enabled)
+    {
+        mEnabled = enabled;
+        mFrameOpen = false;
+        mCurrent = FrameStatistics();
+        mHistoryIndex = 0;
+        mHistoryCount = 0;
+    }
+
+    void FrameStatisticsRecorder::beginFrame()
+    {
+        if (!mEnabled) { return; }
+
+        // Frame without drawing is committed nevertheless
+        if (mFrameOpen)
+        {
+            endFrame();
+        }
+        mCurrent = FrameStatistics();
+        mFrameOpen = true;
+    }
+
+    void FrameStatisticsRecorder::endFrame()
+    {
+        if (!mEnabled) { return; }
+
+        // Write into ring buffer
+        mHistory[mHistoryIndex] = mCurrent;
+        mHistoryIndex = (mHistoryIndex + 1) % FRAME_STATISTICS_HISTORY_SIZE;
+        mHistoryCount = std::min(mHistoryCount + 1, FRAME_STATISTICS_HISTORY_SIZE);
+
+        mCurrent = FrameStatistics();
+        mFrameOpen = false;
+    }
+
+    void FrameStatisticsRecorder::setRenderCounters(uint drawCalls, uint shaderBinds, uint textureBinds, uint issuedStateChanges, uint skippedStateChanges)
+    {
+        if (!mEnabled) { return; }
+        mCurrent.drawCalls = drawCalls;
+        mCurrent.shaderBinds = shaderBinds;
+        mCurrent.textureBinds = textureBinds;
+        mCurrent.issuedStateChanges = issuedStateChanges;
+        mCurrent.skippedStateChanges = skippedStateChanges;
+    }
+
+    void FrameStatisticsRecorder::setStateQueryCounters(uint stateQueries, uint avoidedStateQueries)
+    {
+        if (!mEnabled) { return; }
+        mCurrent.stateQueries = stateQueries;
+        mCurrent.avoidedStateQueries = avoidedStateQueries;
+    }
+
+    FrameStatistics FrameStatisticsRecorder::getLast() const
+    {
+        if (mHistoryCount <= 0)
+        {
+            return FrameStatistics();
+        }
+        return mHistory[(mHistoryIndex + FRAME_STATISTICS_HISTORY_SIZE - 1) % FRAME_STATISTICS_HISTORY_SIZE];
+    }
+
+    std::vector<FrameStatistics> FrameStatisticsRecorder::getHistory() const
+    {
+        std::vector<FrameStatistics> history;
+        history.reserve(mHistoryCount);
+        int oldestIndex = (mHistoryIndex + FRAME_STATISTICS_HISTORY_SIZE - mHistoryCount) % FRAME_STATISTICS_HISTORY_SIZE;
+        for (int i = 0; i < mHistoryCount; i++)
+        {
+            history.push_back(mHistory[(oldestIndex + i) % FRAME_STATISTICS_HISTORY_SIZE]);
+        }
+        return history;
+    }
+
+    FrameStatistics FrameStatisticsRecorder::getPercentile(float percentile) const
+    {
+        FrameStatistics result;
+        if (mHistoryCount <= 0)
+        {
+            return result;
+        }
+
+        // Nearest rank inside sorted values
+        int rank = (int)std::ceil((clamp(percentile, 0, 100) / 100.0f) * mHistoryCount) - 1;
+        rank = std::max(rank, 0);
+
+        // Each value is handled independently
+        static float FrameStatistics::* const times[] =
+        {
+            &FrameStatistics::jobsTime,
+            &FrameStatistics::resizingTime,
+            &FrameStatistics::fontAtlasTime,
+            &FrameStatistics::notificationTime,
+            &FrameStatistics::frameUpdateTime,
+            &FrameStatistics::updateTime,
+            &FrameStatistics::drawTime
+        };
+        static unsigned int FrameStatistics::* const counters[] =
+        {
+            &FrameStatistics::updatedElements,
+            &FrameStatistics::relayouts,
+            &FrameStatistics::textMeshCalculations,
+            &FrameStatistics::drawCalls,
+            &FrameStatistics::shaderBinds,
+            &FrameStatistics::textureBinds,
+            &FrameStatistics::issuedStateChanges,
+            &FrameStatistics::skippedStateChanges,
+            &FrameStatistics::stateQueries,
+            &FrameStatistics::avoidedStateQueries,
+            &FrameStatistics::renderedLayers,
+            &FrameStatistics::compositedLayers
+        };
+
+        std::vector<float> timeValues(mHistoryCount);
+        for (float FrameStatistics::* pTime : times)
+        {
+            for (int i = 0; i < mHistoryCount; i++)
+            {
+                timeValues[i] = mHistory[i].*pTime;
+            }
+            std::nth_element(timeValues.begin(), timeValues.begin() + rank, timeValues.end());
+            result.*pTime = timeValues[rank];
+        }
+
+        std::vector<unsigned int> counterValues(mHistoryCount);
+        for (unsigned int FrameStatistics::* pCounter : counters)
+        {
+            for (int i = 0; i < mHistoryCount; i++)
+            {
+                counterValues[i] = mHistory[i].*pCounter;
+            }
+            std::nth_element(counterValues.begin(), counterValues.begin() + rank, counterValues.end());
+            result.*pCounter = counterValues[rank];
+        }
+
+        return result;
+    }
+
+    void FrameStatisticsRecorder::accumulateTime(Phase phase, Clock::duration duration)
+    {
+        float milliseconds = std::chrono::duration<float, std::milli>(duration).count();
+        switch (phase)
+        {
+        case Phase::JOBS:
+            mCurrent.jobsTime += milliseconds;
+            break;
+        case Phase::RESIZING:
+            mCurrent.resizingTime += milliseconds;
+            break;
+        case Phase::FONT_ATLAS:
+            mCurrent.fontAtlasTime += milliseconds;
+            break;
+        case Phase::NOTIFICATION:
+            mCurrent.notificationTime += milliseconds;
+            break;
+        case Phase::FRAME_UPDATE:
+            mCurrent.frameUpdateTime += milliseconds;
+            break;
+        case Phase::UPDATE:
+            mCurrent.updateTime += milliseconds;
+            break;
+        case Phase::DRAW:
+            mCurrent.drawTime += milliseconds;
+            break;
+        default:
+            break;
+        }
+    }
+}
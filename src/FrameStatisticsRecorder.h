@@ -0,0 +1,106 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Recorder for frame statistics. Owned by GUI and reachable by layouts,
+// elements and text flows. Every method returns immediately when collection
+// is disabled, so no clock is read and no counter is touched. Collected
+// frames are kept in a ring buffer of fixed size.
+
+#ifndef FRAME_STATISTICS_RECORDER_H_
+#define FRAME_STATISTICS_RECORDER_H_
+
+#include "eyeGUI.h"
+#include "Defines.h"
+
+#include <chrono>
+#include <vector>
+
+namespace eyegui
+{
+    class FrameStatisticsRecorder
+    {
+    public:
+
+        // Measured phases of a frame
+        enum class Phase
+        {
+            JOBS, RESIZING, FONT_ATLAS, NOTIFICATION, FRAME_UPDATE, UPDATE, DRAW, PHASE_COUNT
+        };
+
+        // Constructor
+        FrameStatisticsRecorder();
+
+        // Destructor
+        virtual ~FrameStatisticsRecorder();
+
+        // Enable or disable collection, clears history
+        void setEnabled(bool enabled);
+
+        // Is collection enabled
+        bool isEnabled() const { return mEnabled; }
+
+        // Begin new frame, commits current one if still open
+        void beginFrame();
+
+        // End frame and commit it into history
+        void endFrame();
+
+        // Start timer of phase
+        void startTimer(Phase phase)
+        {
+            if (!mEnabled) { return; }
+            mTimerStarts[(int)phase] = Clock::now();
+        }
+
+        // Stop timer of phase and accumulate measured time
+        void stopTimer(Phase phase)
+        {
+            if (!mEnabled) { return; }
+            accumulateTime(phase, Clock::now() - mTimerStarts[(int)phase]);
+        }
+
+        // Counting
+        void countUpdatedElement() { if (mEnabled) { mCurrent.updatedElements++; } }
+        void countRelayout() { if (mEnabled) { mCurrent.relayouts++; } }
+        void countTextMeshCalculation() { if (mEnabled) { mCurrent.textMeshCalculations++; } }
+        void countLayerRendering() { if (mEnabled) { mCurrent.renderedLayers++; } }
+        void countLayerComposition() { if (mEnabled) { mCurrent.compositedLayers++; } }
+
+        // Set counters of render backend
+        void setRenderCounters(uint drawCalls, uint shaderBinds, uint textureBinds, uint issuedStateChanges, uint skippedStateChanges);
+
+        // Set counters of state queries of last drawing
+        void setStateQueryCounters(uint stateQueries, uint avoidedStateQueries);
+
+        // Get statistics of last committed frame
+        FrameStatistics getLast() const;
+
+        // Get history ordered from oldest to newest frame
+        std::vector<FrameStatistics> getHistory() const;
+
+        // Get percentile (0..100) of each value over history
+        FrameStatistics getPercentile(float percentile) const;
+
+    private:
+
+        // Typedefs
+        typedef std::chrono::steady_clock Clock;
+
+        // Add time to phase of current frame
+        void accumulateTime(Phase phase, Clock::duration duration);
+
+        // Members
+        bool mEnabled;
+        bool mFrameOpen;
+        FrameStatistics mCurrent;
+        Clock::time_point mTimerStarts[(int)Phase::PHASE_COUNT];
+        std::vector<FrameStatistics> mHistory;
+        int mHistoryIndex; // next index to write
+        int mHistoryCount;
+    };
+}
+
+#endif // FRAME_STATISTICS_RECORDER_H_
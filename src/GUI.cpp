@@ -9,6 +9,8 @@
 
 #include "Defines.h"
 #include "OperationNotifier.h"
+#include "Rendering/Backend/OpenGLBackend.h"
+#include "Rendering/Backend/RecordingBackend.h"
 #include "externals/GLM/glm/gtc/matrix_transform.hpp"
 
 #include <algorithm>
@@ -20,24 +22,43 @@ namespace eyegui
         int height,
         std::string fontFilepath,
         CharacterSet characterSet,
-        std::string localizationFilepath)
+        std::string localizationFilepath,
+        RenderBackendType renderBackend,
+        std::string fontAtlasCacheDirectory)
     {
+        // Initialize render backend first, as all assets are created with it
+        mupRenderStateCache = std::unique_ptr<RenderStateCache>(new RenderStateCache());
+        switch (renderBackend)
+        {
+        case RenderBackendType::OPENGL:
+            mupRenderBackend = std::unique_ptr<RenderBackend>(new OpenGLBackend(mupRenderStateCache.get()));
+            break;
+        case RenderBackendType::RECORDING:
+            mupRenderBackend = std::unique_ptr<RenderBackend>(new RecordingBackend(mupRenderStateCache.get()));
+            break;
+        }
+        mupRenderBackend->init();
+
         // Initialize members
         mWidth = width;
         mHeight = height;
         mNewWidth = 0;
         mNewHeight = 0;
         mCharacterSet = characterSet;
+        mupCommandQueue = std::unique_ptr<CommandQueue>(new CommandQueue(COMMAND_QUEUE_CAPACITY));
+        mupFrameStatisticsRecorder = std::unique_ptr<FrameStatisticsRecorder>(new FrameStatisticsRecorder());
         mAccPeriodicTime = -(ACCUMULATED_TIME_PERIOD / 2);
-        mupAssetManager = std::unique_ptr<AssetManager>(new AssetManager(this));
+        mupAssetManager = std::unique_ptr<AssetManager>(new AssetManager(this, mupRenderBackend.get(), fontAtlasCacheDirectory));
+        mupBatchRenderer = std::unique_ptr<BatchRenderer>(new BatchRenderer(this, mupAssetManager.get(), mupRenderBackend.get()));
+        mupLayoutLoader = std::unique_ptr<LayoutLoader>(new LayoutLoader(this, mupAssetManager.get()));
         mpDefaultFont = NULL;
         mResizing = false;
         mResizeWaitTime = 0;
         mupGazeDrawer = std::unique_ptr<GazeDrawer>(new GazeDrawer(this, mupAssetManager.get()));
         mDrawGazeVisualization = false;
-
-        // Initialize OpenGL
-        mGLSetup.init();
+        mDirty = true;
+        mCachingLayouts = false;
+        mCachingFloatingFrames = false;
 
         // Initialize default font ("" handled by asset manager)
         mpDefaultFont = mupAssetManager->fetchFont(fontFilepath);
@@ -60,7 +81,9 @@ namespace eyegui
 
     GUI::~GUI()
     {
-        // Nothing to do so far
+        // Delete layouts while asset manager exists, as elements release their textures
+        mJobs.clear();
+        mLayouts.clear();
     }
 
     Layout* GUI::addLayout(std::string filepath, bool visible)
@@ -68,16 +91,12 @@ namespace eyegui
         // Parse layout
         std::unique_ptr<Layout> upLayout = layout_parser::parse(this, mupAssetManager.get(), filepath);
 
-        // Get raw pointer to return
-        Layout* pLayout = upLayout.get();
-
-        // Set visibility
-        pLayout->setVisibility(visible, false);
-
-        // Give unique pointer to job so it will be pushed back before next rendering but not during
-        mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new AddLayoutJob(this, std::move(upLayout)))));
+        return addLayout(std::move(upLayout), visible);
+    }
 
-        return pLayout;
+    std::shared_future<Layout*> GUI::addLayoutAsync(std::string filepath, bool visible)
+    {
+        return mupLayoutLoader->load(filepath, visible);
     }
 
     void GUI::removeLayout(Layout const * pLayout)
@@ -105,12 +124,30 @@ namespace eyegui
 
     Input GUI::update(float tpf, Input input)
     {
-        // Execute all jobs
+        // Frame statistics start with update, which may upload to and query graphics API as well
+        mupFrameStatisticsRecorder->beginFrame();
+        mupRenderBackend->resetCounters();
+        mupRenderStateCache->resetCounters();
+        mupFrameStatisticsRecorder->startTimer(FrameStatisticsRecorder::Phase::UPDATE);
+
+        // Execute all calls from other threads, finalize layouts loaded in background, then execute all jobs
+        mupFrameStatisticsRecorder->startTimer(FrameStatisticsRecorder::Phase::JOBS);
+        mupCommandQueue->execute();
+        mupLayoutLoader->finalize(LAYOUT_FINALIZATION_BUDGET);
+
+        // Upload images decoded in background. Elements using them notice it in their update,
+        // only pictures preserving aspect ratio of image let their frame resize
+        mupAssetManager->replaceDecodedTextures(TEXTURE_REPLACEMENT_BUDGET);
+
+        // Keep memory of textures in budget
+        mupAssetManager->evictTextures();
         for (std::unique_ptr<GUIJob>& rupJob : mJobs)
         {
             rupJob->execute();
+            mDirty = true;
         }
         mJobs.clear();
+        mupFrameStatisticsRecorder->stopTimer(FrameStatisticsRecorder::Phase::JOBS);
 
         // Resizing
         if (mResizing)
@@ -120,7 +157,9 @@ namespace eyegui
             // Resizing should take place?
             if (mResizeWaitTime <= 0)
             {
+                mupFrameStatisticsRecorder->startTimer(FrameStatisticsRecorder::Phase::RESIZING);
                 internalResizing();
+                mupFrameStatisticsRecorder->stopTimer(FrameStatisticsRecorder::Phase::RESIZING);
                 mResizing = false;
                 mResizeWaitTime = 0;
             }
@@ -143,14 +182,22 @@ namespace eyegui
         // Update gaze drawer
         mupGazeDrawer->update(input.gazeX, input.gazeY, tpf);
 
+        // Upload glyphs rasterized on first use in one batch per page. Text using replaced
+        // or moved glyphs calculates its meshes again in its next update
+        mupAssetManager->uploadGlyphs();
+
+        mupFrameStatisticsRecorder->stopTimer(FrameStatisticsRecorder::Phase::UPDATE);
+
         // Return copy of used input
         return input;
     }
 
     void GUI::draw()
     {
-        // Setup OpenGL (therefore is draw not const)
-        mGLSetup.setup(0, 0, getWindowWidth(), getWindowHeight());
+        mupFrameStatisticsRecorder->startTimer(FrameStatisticsRecorder::Phase::DRAW);
+
+        // Setup render backend (therefore is draw not const)
+        mupRenderBackend->beginFrame(0, 0, getWindowWidth(), getWindowHeight());
 
         // Draw all layouts
         for (int i = 0; i < mLayouts.size(); i++)
@@ -158,15 +205,18 @@ namespace eyegui
             mLayouts[i]->draw();
         }
 
+        // Draw what is left in batch renderer
+        mupBatchRenderer->flush();
+
         // Render resize blend
         if (mResizing)
         {
             glm::mat4 matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f);
             mpResizeBlend->bind();
-            mpResizeBlend->getShader()->fillValue("matrix", matrix);
-            mpResizeBlend->getShader()->fillValue("color", RESIZE_BLEND_COLOR);
-            // mpResizeBlend->getShader()->fillValue("alpha", 1.0f - 0.5f * (mResizeWaitTime / RESIZE_WAIT_DURATION));
-            mpResizeBlend->getShader()->fillValue("alpha", 1.0f); // Without animation
+            mpResizeBlend->getShader()->fillValue(shaders::Uniform::MATRIX, matrix);
+            mpResizeBlend->getShader()->fillValue(shaders::Uniform::COLOR, RESIZE_BLEND_COLOR);
+            // mpResizeBlend->getShader()->fillValue(shaders::Uniform::ALPHA, 1.0f - 0.5f * (mResizeWaitTime / RESIZE_WAIT_DURATION));
+            mpResizeBlend->getShader()->fillValue(shaders::Uniform::ALPHA, 1.0f); // Without animation
             mpResizeBlend->draw();
         }
 
@@ -176,8 +226,45 @@ namespace eyegui
             mupGazeDrawer->draw();
         }
 
-        // Restore OpenGL state of application
-        mGLSetup.restore();
+        // Restore state of application
+        mupRenderBackend->endFrame();
+
+        // Everything drawn is up to date
+        mDirty = false;
+        for (int i = 0; i < mLayouts.size(); i++)
+        {
+            mLayouts[i]->clearDirty();
+        }
+
+        // Frame statistics end with drawing
+        mupFrameStatisticsRecorder->stopTimer(FrameStatisticsRecorder::Phase::DRAW);
+        mupFrameStatisticsRecorder->setRenderCounters(
+            mupRenderBackend->getDrawCallCount(),
+            mupRenderBackend->getShaderBindCount(),
+            mupRenderBackend->getTextureBindCount(),
+            mupRenderStateCache->getIssuedCount(),
+            mupRenderStateCache->getSkippedCount());
+        mupFrameStatisticsRecorder->setStateQueryCounters(
+            mupRenderBackend->getStateQueryCount(),
+            mupRenderBackend->getAvoidedStateQueryCount());
+        mupFrameStatisticsRecorder->endFrame();
+    }
+
+    bool GUI::isRedrawNeeded() const
+    {
+        // Resize blend and gaze visualization change every frame
+        if (mDirty || mResizing || mDrawGazeVisualization)
+        {
+            return true;
+        }
+        for (int i = 0; i < mLayouts.size(); i++)
+        {
+            if (mLayouts[i]->isDirty())
+            {
+                return true;
+            }
+        }
+        return false;
     }
 
     void GUI::moveLayoutToFront(Layout* pLayout)
@@ -207,8 +294,8 @@ namespace eyegui
 
     void GUI::prefetchImage(std::string filepath)
     {
-        // Do it immediately
-        mupAssetManager->fetchTexture(filepath);
+        // Decode in background
+        mupAssetManager->requestTexture(filepath);
     }
 
     void GUI::setValueOfConfigAttribute(std::string attribute, std::string value)
@@ -216,6 +303,85 @@ namespace eyegui
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new SetValueOfConfigAttributeJob(this, attribute, value))));
     }
 
+    std::vector<DrawCommand> GUI::getRecordedDrawCommands() const
+    {
+        return mupRenderBackend->getRecordedDrawCommands();
+    }
+
+    void GUI::setFrameStatisticsCollection(bool collect)
+    {
+        mupFrameStatisticsRecorder->setEnabled(collect);
+    }
+
+    FrameStatistics GUI::getFrameStatistics() const
+    {
+        return mupFrameStatisticsRecorder->getLast();
+    }
+
+    std::vector<FrameStatistics> GUI::getFrameStatisticsHistory() const
+    {
+        return mupFrameStatisticsRecorder->getHistory();
+    }
+
+    FrameStatistics GUI::getFrameStatisticsPercentile(float percentile) const
+    {
+        return mupFrameStatisticsRecorder->getPercentile(percentile);
+    }
+
+    void GUI::setBatchRendering(bool batch)
+    {
+        mupBatchRenderer->setInstancing(batch);
+    }
+
+    void GUI::setRenderStateCaching(bool cache)
+    {
+        mupRenderStateCache->setEnabled(cache);
+    }
+
+    void GUI::setStateRestoration(StateRestoration restoration)
+    {
+        mupRenderBackend->setStateRestoration(restoration);
+    }
+
+    void GUI::setOffscreenCaching(bool layouts, bool floatingFrames)
+    {
+        // Layouts and frames create or delete their layers at next update
+        mCachingLayouts = layouts;
+        mCachingFloatingFrames = floatingFrames;
+        mDirty = true;
+    }
+
+    void GUI::setTextureMemoryBudget(uint budget)
+    {
+        mupAssetManager->setTextureMemoryBudget(budget);
+    }
+
+    uint GUI::getResidentTextureBytes() const
+    {
+        return mupAssetManager->getResidentTextureBytes();
+    }
+
+    void GUI::setImageCacheDirectory(std::string directory)
+    {
+        mupAssetManager->setImageCacheDirectory(directory);
+    }
+
+    void GUI::setDistanceFieldFonts(bool distanceField)
+    {
+        // Meshes of text flows depend on glyphs
+        mupAssetManager->setDistanceFieldFonts(distanceField);
+        for (std::unique_ptr<Layout>& rupLayout : mLayouts)
+        {
+            rupLayout->makeResizeNecessary();
+        }
+        mDirty = true;
+    }
+
+    FontAtlasStatistics GUI::getFontAtlasStatistics() const
+    {
+        return mupAssetManager->getFontAtlasStatistics();
+    }
+
     int GUI::getWindowWidth() const
     {
         return mWidth;
@@ -260,6 +426,51 @@ namespace eyegui
         }
     }
 
+    FrameStatisticsRecorder* GUI::getFrameStatisticsRecorder() const
+    {
+        return mupFrameStatisticsRecorder.get();
+    }
+
+    BatchRenderer* GUI::getBatchRenderer() const
+    {
+        return mupBatchRenderer.get();
+    }
+
+    Layout* GUI::addLayout(std::unique_ptr<Layout> upLayout, bool visible)
+    {
+        // Get raw pointer to return
+        Layout* pLayout = upLayout.get();
+
+        // Set visibility
+        pLayout->setVisibility(visible, false);
+
+        // Give unique pointer to job so it will be pushed back before next rendering but not during
+        mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new AddLayoutJob(this, std::move(upLayout)))));
+
+        return pLayout;
+    }
+
+    CommandQueue* GUI::getCommandQueue() const
+    {
+        return mupCommandQueue.get();
+    }
+
+    bool GUI::isCachingLayouts() const
+    {
+        return mCachingLayouts;
+    }
+
+    bool GUI::isCachingFloatingFrames() const
+    {
+        return mCachingFloatingFrames;
+    }
+
+    std::unique_ptr<OffscreenLayer> GUI::createOffscreenLayer() const
+    {
+        return std::unique_ptr<OffscreenLayer>(
+            new OffscreenLayer(this, mupAssetManager.get(), mupRenderBackend.get()));
+    }
+
     int GUI::findLayout(Layout const * pLayout) const
     {
         // Try to find index of layout in vector
@@ -298,10 +509,13 @@ namespace eyegui
         mHeight = mNewHeight;
 
         // Resize font atlases first
+        mupFrameStatisticsRecorder->startTimer(FrameStatisticsRecorder::Phase::FONT_ATLAS);
         mupAssetManager->resizeFontAtlases();
+        mupFrameStatisticsRecorder->stopTimer(FrameStatisticsRecorder::Phase::FONT_ATLAS);
 
         // Reset gaze drawer
         mupGazeDrawer->reset();
+        mDirty = true;
 
         // Then, resize all layouts
         for (std::unique_ptr<Layout>& upLayout : mLayouts)
@@ -19,12 +19,18 @@
 #include "Parser/ConfigParser.h"
 #include "Parser/LocalizationParser.h"
 #include "Rendering/AssetManager.h"
-#include "Rendering/GLSetup.h"
+#include "Rendering/Backend/RenderBackend.h"
 #include "Config.h"
 #include "Rendering/GazeDrawer.h"
+#include "FrameStatisticsRecorder.h"
+#include "CommandQueue.h"
+#include "LayoutLoader.h"
+#include "Rendering/BatchRenderer.h"
+#include "Rendering/OffscreenLayer.h"
 
 #include <memory>
 #include <vector>
+#include <future>
 
 namespace eyegui
 {
@@ -40,7 +46,9 @@ namespace eyegui
             int height,
             std::string fontFilepath,
             CharacterSet characterSet,
-            std::string localizationFilepath);
+            std::string localizationFilepath,
+            RenderBackendType renderBackend,
+            std::string fontAtlasCacheDirectory);
 
         // Destructor
         virtual ~GUI();
@@ -48,6 +56,9 @@ namespace eyegui
         // Load layout from xml, returns NULL if fails
         Layout* addLayout(std::string filepath, bool visible);
 
+        // Load layout from xml in background, finalized while updating
+        std::shared_future<Layout*> addLayoutAsync(std::string filepath, bool visible);
+
         // Remove layout
         void removeLayout(Layout const * pLayout);
 
@@ -60,6 +71,9 @@ namespace eyegui
         // Drawing
         void draw();
 
+        // Has anything visible changed since last drawing
+        bool isRedrawNeeded() const;
+
         // Move layout to front
         void moveLayoutToFront(Layout* pLayout);
 
@@ -81,8 +95,53 @@ namespace eyegui
         // Set value of config attribute
         void setValueOfConfigAttribute(std::string attribute, std::string value);
 
+        // Get draw commands of last drawing (only filled by recording backend)
+        std::vector<DrawCommand> getRecordedDrawCommands() const;
+
+        // Enable or disable collection of frame statistics
+        void setFrameStatisticsCollection(bool collect);
+
+        // Get statistics of last frame
+        FrameStatistics getFrameStatistics() const;
+
+        // Get statistics of recent frames
+        std::vector<FrameStatistics> getFrameStatisticsHistory() const;
+
+        // Get percentile of statistics over recent frames
+        FrameStatistics getFrameStatisticsPercentile(float percentile) const;
+
+        // Enable or disable batch rendering of elements with instancing
+        void setBatchRendering(bool batch);
+
+        // Set whether redundant changes of render state are skipped
+        void setRenderStateCaching(bool cache);
+
+        // Set which OpenGL state is saved before drawing and restored afterwards
+        void setStateRestoration(StateRestoration restoration);
+
+        // Set whether layouts and floating frames are rendered into offscreen layers
+        void setOffscreenCaching(bool layouts, bool floatingFrames);
+
+        // Set budget for memory of textures from files in bytes
+        void setTextureMemoryBudget(uint budget);
+
+        // Get bytes of pixel data of textures from files
+        uint getResidentTextureBytes() const;
+
+        // Set directory where decoded images are kept across runs
+        void setImageCacheDirectory(std::string directory);
+
+        // Set whether text is drawn from distance fields of glyphs
+        void setDistanceFieldFonts(bool distanceField);
+
+        // Get memory of font atlases
+        FontAtlasStatistics getFontAtlasStatistics() const;
+
         // *** Methods accessed by other classes ***
 
+        // Add layout parsed before
+        Layout* addLayout(std::unique_ptr<Layout> upLayout, bool visible);
+
         // Getter for window size
         int getWindowWidth() const;
         int getWindowHeight() const;
@@ -102,6 +161,22 @@ namespace eyegui
         // Get string content from localization
         std::u16string getContentFromLocalization(std::string key) const;
 
+        // Get recorder of frame statistics (not const, because it is filled by all)
+        FrameStatisticsRecorder* getFrameStatisticsRecorder() const;
+
+        // Get renderer for quads of elements (not const, because it collects them while drawing)
+        BatchRenderer* getBatchRenderer() const;
+
+        // Get queue for calls of interface (not const, because it is filled by any thread)
+        CommandQueue* getCommandQueue() const;
+
+        // Are layouts or floating frames rendered into offscreen layers
+        bool isCachingLayouts() const;
+        bool isCachingFloatingFrames() const;
+
+        // Create offscreen layer for layout or floating frame
+        std::unique_ptr<OffscreenLayer> createOffscreenLayer() const;
+
     private:
 
         // ### INNER CLASSES ###################################################
@@ -197,13 +272,15 @@ namespace eyegui
         // Internal resizing
         void internalResizing();
 
-        // Members
+        // Members (render backend first, so it is destroyed after everything using it)
+        std::unique_ptr<RenderStateCache> mupRenderStateCache;
+        std::unique_ptr<RenderBackend> mupRenderBackend;
         std::vector<std::unique_ptr<Layout> > mLayouts;
         int mWidth, mHeight;
         int mNewWidth, mNewHeight;
         CharacterSet mCharacterSet;
         std::unique_ptr<AssetManager> mupAssetManager;
-        GLSetup mGLSetup;
+        std::unique_ptr<BatchRenderer> mupBatchRenderer;
         float mAccPeriodicTime;
         Config mConfig;
         Font const * mpDefaultFont;
@@ -211,9 +288,15 @@ namespace eyegui
         float mResizeWaitTime;
         RenderItem const * mpResizeBlend;
         std::unique_ptr<localizationMap> mupLocalizationMap;
-        std::vector<std::unique_ptr<GUIJob> > mJobs;
+        std::vector<std::unique_ptr<GUIJob> > mJobs; // Only accessed by thread updating the GUI
+        std::unique_ptr<CommandQueue> mupCommandQueue;
+        std::unique_ptr<LayoutLoader> mupLayoutLoader; // Destroyed before asset manager, as worker may use it
         std::unique_ptr<GazeDrawer> mupGazeDrawer;
         bool mDrawGazeVisualization;
+        bool mDirty; // Only own changes, layouts keep track of theirs
+        bool mCachingLayouts;
+        bool mCachingFloatingFrames;
+        std::unique_ptr<FrameStatisticsRecorder> mupFrameStatisticsRecorder;
     };
 }
 
@@ -19,6 +19,12 @@
 namespace eyegui
 {
     Layout::Layout(GUI const * pGUI, AssetManager* pAssetManager, std::string stylesheetFilepath)
+        : Layout(pGUI, pAssetManager, stylesheet_parser::parse(stylesheetFilepath))
+    {
+        // Nothing to do
+    }
+
+    Layout::Layout(GUI const * pGUI, AssetManager* pAssetManager, std::unique_ptr<std::map<std::string, Style> > upStyles)
     {
         // Initialize members
         mpGUI = pGUI;
@@ -27,13 +33,13 @@ namespace eyegui
         mAlpha.setValue(1);
         mVisible = true;
         mResizeNecessary = true;
+        mDirty = true;
+        mCompositionDirty = false;
         mUseInput = true;
         mpSelectedInteractiveElement = NULL;
         mupMainFrame = std::unique_ptr<Frame>(new Frame(this, 0, 0, 1, 1));
         mupNotificationQueue = std::unique_ptr<NotificationQueue>(new NotificationQueue(this));
-
-        // Parse style file
-        mupStyles = stylesheet_parser::parse(stylesheetFilepath);
+        mupStyles = std::move(upStyles);
     }
 
     Layout::~Layout()
@@ -51,6 +57,7 @@ namespace eyegui
                 std::remove(
                     mFloatingFramesOrderingIndices.begin(), mFloatingFramesOrderingIndices.end(), i), mFloatingFramesOrderingIndices.end());
             mFloatingFrames[i].reset(NULL);
+            mDirty = true;
         }
         mDyingFloatingFramesIndices.clear();
 
@@ -59,16 +66,41 @@ namespace eyegui
 
         // *** NOTIFICATIONS ***
 
+        FrameStatisticsRecorder* pRecorder = getFrameStatisticsRecorder();
+        pRecorder->startTimer(FrameStatisticsRecorder::Phase::NOTIFICATION);
         mupNotificationQueue->process();
+        pRecorder->stopTimer(FrameStatisticsRecorder::Phase::NOTIFICATION);
 
         // *** OWN UPDATE ***
 
         // Update alpha
+        float previousAlpha = mAlpha.getValue();
         mAlpha.update(tpf / getConfig()->animationDuration, !mVisible);
+        if (previousAlpha != mAlpha.getValue())
+        {
+            mCompositionDirty = true;
+        }
+
+        // *** OFFSCREEN LAYERS ***
+
+        // Create or delete layers as requested by GUI
+        if (mpGUI->isCachingLayouts() != hasOffscreenLayer())
+        {
+            mupLayer = mpGUI->isCachingLayouts() ? createOffscreenLayer() : NULL;
+            mDirty = true;
+        }
+        for (const auto& rupFrame : mFloatingFrames)
+        {
+            if (rupFrame.get() != NULL)
+            {
+                rupFrame->useOffscreenLayer(mpGUI->isCachingFloatingFrames());
+            }
+        }
 
         // *** UPDATE FRAMES ***
 
         // Update root only if own alpha greater zero
+        pRecorder->startTimer(FrameStatisticsRecorder::Phase::FRAME_UPDATE);
         if (mAlpha.getValue() > 0)
         {
             // Do not use input if still fading
@@ -112,6 +144,7 @@ namespace eyegui
             // Update main frame
             mupMainFrame->update(tpf, mAlpha.getValue(), pInput);
         }
+        pRecorder->stopTimer(FrameStatisticsRecorder::Phase::FRAME_UPDATE);
     }
 
     void Layout::draw() const
@@ -119,16 +152,37 @@ namespace eyegui
         // Use alpha because while fading it should still draw
         if (mAlpha.getValue() > 0)
         {
-            // Draw main frame
-            mupMainFrame->draw();
+            if (mupLayer.get() != NULL)
+            {
+                // Render content again only if it has changed
+                if (isContentDirty() || mupLayer->isOutdated())
+                {
+                    mupLayer->beginRendering();
+                    drawFrames(false);
+                    mupLayer->endRendering();
+                }
+                mupLayer->composite(mAlpha.getValue());
+            }
+            else
+            {
+                drawFrames(false);
+            }
 
-            // Draw floating frames
-            for (int i = 0; i < mFloatingFramesOrderingIndices.size(); i++)
+            // Floating frames with own layer are composited on top (either all or none have one)
+            drawFrames(true);
+        }
+        else
+        {
+            // Layers have to be rendered again if content changed while invisible
+            if (mupLayer.get() != NULL && isContentDirty())
             {
-                Frame* pFrame = mFloatingFrames[mFloatingFramesOrderingIndices[i]].get();
-                if (pFrame != NULL)
+                mupLayer->invalidate();
+            }
+            for (const auto& rupFrame : mFloatingFrames)
+            {
+                if (rupFrame.get() != NULL)
                 {
-                    pFrame->draw();
+                    rupFrame->skipDrawing();
                 }
             }
         }
@@ -139,6 +193,36 @@ namespace eyegui
         mResizeNecessary = true;
     }
 
+    bool Layout::isDirty() const
+    {
+        if (mDirty || mCompositionDirty || mupMainFrame->isDirty())
+        {
+            return true;
+        }
+        for (const auto& rupFrame : mFloatingFrames)
+        {
+            if (rupFrame.get() != NULL && rupFrame->isDirty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Layout::clearDirty()
+    {
+        mDirty = false;
+        mCompositionDirty = false;
+        mupMainFrame->clearDirty();
+        for (const auto& rupFrame : mFloatingFrames)
+        {
+            if (rupFrame.get() != NULL)
+            {
+                rupFrame->clearDirty();
+            }
+        }
+    }
+
     void Layout::attachElementToMainFrameAsRoot(
         std::unique_ptr<Element> upElement,
         std::unique_ptr<std::map<std::string, Element*> > upIds)
@@ -160,6 +244,31 @@ namespace eyegui
         return mpGUI->getConfig();
     }
 
+    FrameStatisticsRecorder* Layout::getFrameStatisticsRecorder() const
+    {
+        return mpGUI->getFrameStatisticsRecorder();
+    }
+
+    BatchRenderer* Layout::getBatchRenderer() const
+    {
+        return mpGUI->getBatchRenderer();
+    }
+
+    CommandQueue* Layout::getCommandQueue() const
+    {
+        return mpGUI->getCommandQueue();
+    }
+
+    std::unique_ptr<OffscreenLayer> Layout::createOffscreenLayer() const
+    {
+        return mpGUI->createOffscreenLayer();
+    }
+
+    bool Layout::hasOffscreenLayer() const
+    {
+        return mupLayer.get() != NULL;
+    }
+
     Frame* Layout::getMainFrame()
     {
         return mupMainFrame.get();
@@ -225,6 +334,7 @@ namespace eyegui
             {
                 mAlpha.setValue(0);
             }
+            mDirty = true;
         }
     }
 
@@ -373,6 +483,8 @@ namespace eyegui
         InteractiveElement* pInteractiveElement = toInteractiveElement(fetchElement(id));
         if (pInteractiveElement != NULL)
         {
+            // Decode icon in background, element shows placeholder until then
+            mpAssetManager->requestTexture(iconFilepath);
             pInteractiveElement->setIcon(iconFilepath);
         }
         else
@@ -688,6 +800,7 @@ namespace eyegui
         if (it != mupStyles->end())
         {
             stylesheet_parser::fillValue(it->second, attribute, value);
+            mDirty = true;
         }
         else
         {
@@ -735,6 +848,9 @@ namespace eyegui
         Element* pElement = fetchElement(id);
         if (pElement != NULL)
         {
+            // Decode image in background, element shows placeholder until then
+            mpAssetManager->requestTexture(filepath);
+
             // Create new picture
             std::unique_ptr<Picture> upPicture = std::unique_ptr<Picture>(new Picture(
                 pElement->getId(),
@@ -803,6 +919,9 @@ namespace eyegui
         Element* pElement = fetchElement(id);
         if (pElement != NULL)
         {
+            // Decode image in background, element shows placeholder until then
+            mpAssetManager->requestTexture(iconFilepath);
+
             // Create new picture
             std::unique_ptr<CircleButton> upCircleButton = std::unique_ptr<CircleButton>(new CircleButton(
                 pElement->getId(),
@@ -838,6 +957,9 @@ namespace eyegui
         Element* pElement = fetchElement(id);
         if (pElement != NULL)
         {
+            // Decode image in background, element shows placeholder until then
+            mpAssetManager->requestTexture(iconFilepath);
+
             // Create new picture
             std::unique_ptr<BoxButton> upBoxButton = std::unique_ptr<BoxButton>(new BoxButton(
                 pElement->getId(),
@@ -873,6 +995,9 @@ namespace eyegui
         Element* pElement = fetchElement(id);
         if (pElement != NULL)
         {
+            // Decode image in background, element shows placeholder until then
+            mpAssetManager->requestTexture(iconFilepath);
+
             // Create new picture
             std::unique_ptr<Sensor> upSensor = std::unique_ptr<Sensor>(new Sensor(
                 pElement->getId(),
@@ -1079,6 +1204,7 @@ namespace eyegui
 
             // Reminder for removed frame
             pFrame->setRemoved();
+            mDirty = true;
 
             // Deselected element if it is in frame
             std::set<Element*> children = pFrame->getAllElements();
@@ -1219,6 +1345,7 @@ namespace eyegui
         {
             // Resize main frame
             mupMainFrame->makeResizeNecessary();
+            mDirty = true;
 
             // Resize floating frames
             for (auto& upFrame : mFloatingFrames)
@@ -1251,6 +1378,7 @@ namespace eyegui
     {
         // Pointer to replacement
         Element* pElement = upElement.get();
+        mDirty = true;
 
         // Do the replacement
         std::unique_ptr<Element> upTarget;
@@ -1389,6 +1517,8 @@ namespace eyegui
 
     void Layout::moveFloatingFrame(int oldIndex, int newIndex)
     {
+        mDirty = true;
+
         // Move index of floating frame
         int movedFrameIndex = mFloatingFramesOrderingIndices[oldIndex];
         mFloatingFramesOrderingIndices.erase(mFloatingFramesOrderingIndices.begin() + oldIndex);
@@ -1402,4 +1532,41 @@ namespace eyegui
             mFloatingFramesOrderingIndices.insert(mFloatingFramesOrderingIndices.begin() + newIndex, movedFrameIndex);
         }
     }
+
+    void Layout::drawFrames(bool withOwnLayer) const
+    {
+        // Main frame never has own layer
+        if (!withOwnLayer)
+        {
+            mupMainFrame->draw();
+        }
+
+        // Draw floating frames
+        for (int i = 0; i < mFloatingFramesOrderingIndices.size(); i++)
+        {
+            Frame* pFrame = mFloatingFrames[mFloatingFramesOrderingIndices[i]].get();
+            if (pFrame != NULL && pFrame->hasOffscreenLayer() == withOwnLayer)
+            {
+                pFrame->draw();
+            }
+        }
+    }
+
+    bool Layout::isContentDirty() const
+    {
+        if (mDirty || mupMainFrame->isContentDirty())
+        {
+            return true;
+        }
+
+        // Floating frames with own layer are not part of content
+        for (const auto& rupFrame : mFloatingFrames)
+        {
+            if (rupFrame.get() != NULL && !rupFrame->hasOffscreenLayer() && rupFrame->isContentDirty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
 }
@@ -21,6 +21,9 @@
 #include "Parser/BrickParser.h"
 #include "NotificationQueue.h"
 #include "LerpValue.h"
+#include "FrameStatisticsRecorder.h"
+#include "CommandQueue.h"
+#include "Rendering/BatchRenderer.h"
 
 #include <memory>
 #include <map>
@@ -39,6 +42,9 @@ namespace eyegui
         // Constructor
         Layout(GUI const * pGUI, AssetManager* pAssetManager, std::string stylesheetFilepath);
 
+        // Constructor with stylesheet parsed before, maybe on another thread
+        Layout(GUI const * pGUI, AssetManager* pAssetManager, std::unique_ptr<std::map<std::string, Style> > upStyles);
+
         // Destructor
         virtual ~Layout();
 
@@ -51,6 +57,12 @@ namespace eyegui
         // Make resize necessary
         void makeResizeNecessary();
 
+        // Has anything visible changed since last drawing
+        bool isDirty() const;
+
+        // Drawing has been done
+        void clearDirty();
+
         // Attach element to main frame as root
         void attachElementToMainFrameAsRoot(
             std::unique_ptr<Element> upElement,
@@ -62,6 +74,21 @@ namespace eyegui
         // Get pointer to config of owning GUI
         Config const * getConfig() const;
 
+        // Get recorder of frame statistics of owning GUI
+        FrameStatisticsRecorder* getFrameStatisticsRecorder() const;
+
+        // Get batch renderer of owning GUI
+        BatchRenderer* getBatchRenderer() const;
+
+        // Get queue for calls of interface of owning GUI
+        CommandQueue* getCommandQueue() const;
+
+        // Create offscreen layer with owning GUI
+        std::unique_ptr<OffscreenLayer> createOffscreenLayer() const;
+
+        // Is layout rendered into its own offscreen layer
+        bool hasOffscreenLayer() const;
+
         // Get main frame of layout
         Frame* getMainFrame();
 
@@ -271,6 +298,12 @@ namespace eyegui
         // Fetch pointer to frame
         Frame* fetchFloatingFrame(uint frameIndex) const;
 
+        // Draw main frame and floating frames, either those with or without own offscreen layer
+        void drawFrames(bool withOwnLayer) const;
+
+        // Has content of own offscreen layer changed, not only alpha of layout
+        bool isContentDirty() const;
+
         // Move floating frame by id
         void moveFloatingFrame(int oldIndex, int newIndex);
 
@@ -285,6 +318,9 @@ namespace eyegui
         LerpValue mAlpha;
         bool mVisible;
         bool mResizeNecessary;
+        bool mDirty; // Only own changes, frames keep track of their elements
+        bool mCompositionDirty; // Only alpha of layout changed
+        std::unique_ptr<OffscreenLayer> mupLayer;
         bool mUseInput;
         std::unique_ptr<std::map<std::string, Style> > mupStyles;
         InteractiveElement* mpSelectedInteractiveElement;
@@ -0,0 +1,203 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "LayoutLoader.h"
+
+#include "GUI.h"
+#include "Helper.h"
+#include "Parser/LayoutParser.h"
+#include "Parser/TemplateParser.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace eyegui
+{
+    LayoutLoader::LayoutLoader(GUI* pGUI, AssetManager* pAssetManager)
+    {
+        // Initialize members
+        mpGUI = pGUI;
+        mpAssetManager = pAssetManager;
+        mPendingCount = 0;
+        mStop = false;
+    }
+
+    LayoutLoader::~LayoutLoader()
+    {
+        // Stop worker, unfinished requests are dropped
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        if (mWorker.joinable())
+        {
+            mWorker.join();
+        }
+    }
+
+    std::shared_future<Layout*> LayoutLoader::load(std::string filepath, bool visible)
+    {
+        std::unique_ptr<Request> upRequest = std::unique_ptr<Request>(new Request);
+        upRequest->filepath = filepath;
+        upRequest->visible = visible;
+        std::shared_future<Layout*> future = upRequest->promise.get_future().share();
+
+        // Hand over to worker
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRequested.push_back(std::move(upRequest));
+        }
+        mCondition.notify_one();
+        mPendingCount++;
+
+        // Start worker at first request
+        if (!mWorker.joinable())
+        {
+            mWorker = std::thread(&LayoutLoader::run, this);
+        }
+
+        return future;
+    }
+
+    void LayoutLoader::finalize(float budget)
+    {
+        if (mPendingCount == 0)
+        {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        do
+        {
+            // Take next loaded request
+            if (mupFinalizing == NULL)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mLoaded.empty())
+                {
+                    return;
+                }
+                mupFinalizing = std::move(mLoaded.front());
+                mLoaded.pop_front();
+            }
+
+            if (mupFinalizing->uploadedImages < mupFinalizing->images.size())
+            {
+                // Create one texture
+                std::pair<std::string, Image>& rImage = mupFinalizing->images[mupFinalizing->uploadedImages];
+                mpAssetManager->fetchTexture(rImage.first, rImage.second);
+                rImage.second = Image(); // Free memory early
+                mupFinalizing->uploadedImages++;
+            }
+            else
+            {
+                // Construct elements, images are found in asset manager
+                OperationNotifier::notify(mupFinalizing->notifications);
+                std::unique_ptr<Layout> upLayout = layout_parser::parse(
+                    mpGUI,
+                    mpAssetManager,
+                    mupFinalizing->filepath,
+                    mupFinalizing->upTemplate.get(),
+                    mupFinalizing->errorMessage,
+                    std::move(mupFinalizing->upStyles));
+                Layout* pLayout = mpGUI->addLayout(std::move(upLayout), mupFinalizing->visible);
+                mupFinalizing->promise.set_value(pLayout);
+                mupFinalizing = NULL;
+                mPendingCount--;
+            }
+        } while (std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() < budget);
+    }
+
+    bool LayoutLoader::isLoading() const
+    {
+        return mPendingCount > 0;
+    }
+
+    void LayoutLoader::run()
+    {
+        while (true)
+        {
+            // Wait for request
+            std::unique_ptr<Request> upRequest;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [&] { return mStop || !mRequested.empty(); });
+                if (mStop)
+                {
+                    return;
+                }
+                upRequest = std::move(mRequested.front());
+                mRequested.pop_front();
+            }
+
+            // Read template. Errors are reported at finalization
+            upRequest->upTemplate = template_parser::parse(upRequest->filepath, upRequest->errorMessage);
+
+            // Read stylesheet. Notifications are sent at finalization
+            OperationNotifier::deferOnThisThread(&upRequest->notifications);
+            upRequest->upStyles = layout_parser::parseStylesheet(upRequest->upTemplate.get());
+            OperationNotifier::deferOnThisThread(NULL);
+
+            // Decode raster images. Failures are reported when asset manager tries again
+            if (upRequest->upTemplate != NULL)
+            {
+                std::vector<std::string> filepaths;
+                collectImages(upRequest->upTemplate.get(), filepaths);
+                for (const std::string& rFilepath : filepaths)
+                {
+                    Image image;
+                    if (mpAssetManager->decodeImage(rFilepath, 0, image))
+                    {
+                        upRequest->images.push_back(std::make_pair(rFilepath, std::move(image)));
+                    }
+                }
+            }
+
+            // Hand over for finalization
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mLoaded.push_back(std::move(upRequest));
+            }
+        }
+    }
+
+    void LayoutLoader::collectImages(ElementTemplate const * pTemplate, std::vector<std::string>& rFilepaths)
+    {
+        // Same attributes as read by element parser
+        ElementTemplate::Attribute const * pAttribute = NULL;
+        switch (pTemplate->getKind())
+        {
+        case ElementTemplate::Kind::PICTURE:
+            pAttribute = pTemplate->findAttribute(ElementTemplate::AttributeId::SRC);
+            break;
+        case ElementTemplate::Kind::CIRCLEBUTTON:
+        case ElementTemplate::Kind::BOXBUTTON:
+        case ElementTemplate::Kind::SENSOR:
+        case ElementTemplate::Kind::DROPBUTTON:
+            pAttribute = pTemplate->findAttribute(ElementTemplate::AttributeId::ICON);
+            break;
+        default:
+            break;
+        }
+
+        // Remember each filepath once
+        if (pAttribute != NULL
+            && pAttribute->text != EMPTY_STRING
+            && !checkFileNameExtension(pAttribute->text, "svg")
+            && std::find(rFilepaths.begin(), rFilepaths.end(), pAttribute->text) == rFilepaths.end())
+        {
+            rFilepaths.push_back(pAttribute->text);
+        }
+
+        // Go over children
+        for (ElementTemplate const * pChild = pTemplate->getFirstChild(); pChild != NULL; pChild = pChild->getNextSibling())
+        {
+            collectImages(pChild, rFilepaths);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Loader of layouts in background, owned by GUI. A worker thread reads the
+// templates and stylesheets of requested layouts and decodes the raster images
+// used by their elements. Notifications of the worker are held back until the
+// finalization, which is called by GUI while updating: textures are created
+// from decoded images and finally the elements are constructed. Finalization
+// stops after each step when its time budget is spent, so images of a large
+// layout are spread over multiple frames. Construction of the elements is a
+// single step, since they are attached to their parents while parsed.
+
+#ifndef LAYOUT_LOADER_H_
+#define LAYOUT_LOADER_H_
+
+#include "eyeGUI.h"
+#include "Rendering/AssetManager.h"
+#include "Rendering/Textures/Image.h"
+#include "Parser/ElementTemplate.h"
+#include "Parser/StylesheetParser.h"
+#include "OperationNotifier.h"
+
+#include <memory>
+#include <deque>
+#include <vector>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace eyegui
+{
+    // Forward declaration
+    class GUI;
+
+    class LayoutLoader
+    {
+    public:
+
+        // Constructor
+        LayoutLoader(GUI* pGUI, AssetManager* pAssetManager);
+
+        // Destructor, waits for worker thread
+        virtual ~LayoutLoader();
+
+        // Request layout, worker thread is started at first request
+        std::shared_future<Layout*> load(std::string filepath, bool visible);
+
+        // Finalize loaded layouts until budget in seconds is spent. At least one step is done
+        void finalize(float budget);
+
+        // Are layouts requested which are not yet finalized
+        bool isLoading() const;
+
+    private:
+
+        // Requested layout, filled by worker and finalized by thread updating the GUI
+        struct Request
+        {
+            std::string filepath;
+            bool visible;
+            std::unique_ptr<ElementTemplate> upTemplate;
+            std::string errorMessage;
+            std::unique_ptr<std::map<std::string, Style> > upStyles;
+            std::vector<OperationNotifier::Notification> notifications;
+            std::vector<std::pair<std::string, Image> > images;
+            uint uploadedImages = 0;
+            std::promise<Layout*> promise;
+        };
+
+        // Execution of worker thread
+        void run();
+
+        // Collect filepaths of raster images used by elements in template. Vector graphics are
+        // rasterized for the size elements are drawn at, which is not known before construction
+        static void collectImages(ElementTemplate const * pTemplate, std::vector<std::string>& rFilepaths);
+
+        // Members
+        GUI* mpGUI;
+        AssetManager* mpAssetManager;
+        std::thread mWorker;
+        mutable std::mutex mMutex; // Guards requests and stopping
+        std::condition_variable mCondition;
+        std::deque<std::unique_ptr<Request> > mRequested; // Waiting for worker
+        std::deque<std::unique_ptr<Request> > mLoaded; // Waiting for finalization
+        std::unique_ptr<Request> mupFinalizing; // Only accessed by thread updating the GUI
+        uint mPendingCount; // Requests not yet finalized
+        bool mStop;
+    };
+}
+
+#endif // LAYOUT_LOADER_H_
@@ -0,0 +1,98 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace eyegui
+{
+#ifdef _WIN32
+    MappedFile::MappedFile(std::string filepath)
+    {
+        // Initialize members
+        mpData = NULL;
+        mSize = 0;
+
+        // Open file
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        // Map it, view stays valid after closing the handles
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping != NULL)
+            {
+                void* pView = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (pView != NULL)
+                {
+                    mpData = static_cast<uchar const *>(pView);
+                    mSize = (size_t)size.QuadPart;
+                }
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (mpData != NULL)
+        {
+            UnmapViewOfFile(mpData);
+        }
+    }
+#else
+    MappedFile::MappedFile(std::string filepath)
+    {
+        // Initialize members
+        mpData = NULL;
+        mSize = 0;
+
+        // Open file
+        int file = open(filepath.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return;
+        }
+
+        // Map it, mapping stays valid after closing the descriptor
+        struct stat status;
+        if (fstat(file, &status) == 0 && status.st_size > 0)
+        {
+            void* pMapping = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (pMapping != MAP_FAILED)
+            {
+                mpData = static_cast<uchar const *>(pMapping);
+                mSize = (size_t)status.st_size;
+            }
+        }
+        close(file);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (mpData != NULL)
+        {
+            munmap(const_cast<uchar*>(mpData), mSize);
+        }
+    }
+#endif
+}
@@ -0,0 +1,52 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Read only view of a whole file, mapped into memory by the operating system.
+// Pages are read from disk when accessed, without copying them into a buffer.
+// Usable from any thread, mapping is removed at destruction.
+
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#include "Defines.h"
+
+#include <string>
+#include <cstddef>
+
+namespace eyegui
+{
+    class MappedFile
+    {
+    public:
+
+        // Constructor, full filepath expected
+        MappedFile(std::string filepath);
+
+        // Destructor
+        virtual ~MappedFile();
+
+        // Was file found and mapped. Empty files are not mapped
+        bool isMapped() const { return mpData != NULL; }
+
+        // Getter for content, NULL if not mapped
+        uchar const * getData() const { return mpData; }
+
+        // Getter for size of content in bytes
+        size_t getSize() const { return mSize; }
+
+    private:
+
+        // No copies, mapping is owned
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Members
+        uchar const * mpData;
+        size_t mSize;
+    };
+}
+
+#endif // MAPPED_FILE_H_
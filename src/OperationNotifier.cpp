@@ -10,4 +10,5 @@
 namespace eyegui
 {
 	OperationNotifier* OperationNotifier::pInstance = NULL;
+	thread_local std::vector<OperationNotifier::Notification>* OperationNotifier::pDeferred = NULL;
 }
@@ -13,6 +13,7 @@
 #include "PathBuilder.h"
 
 #include <string>
+#include <vector>
 
 // Defines for easier use
 #define throwError eyegui::OperationNotifier::notifyAboutError
@@ -27,18 +28,60 @@ namespace eyegui
         // Enumeration of operations which could occur
         enum class Operation { PARSING, IMAGE_LOADING, FONT_LOADING, RUNTIME, BUG };
 
+        // Notification held back instead of sent to callback
+        struct Notification
+        {
+            bool error;
+            Operation operation;
+            std::string message;
+            std::string filepath;
+        };
+
         // Send error to callback
         static void notifyAboutError(Operation operation, std::string message = "", std::string filepath = "")
         {
+            if (pDeferred != NULL)
+            {
+                pDeferred->push_back({ true, operation, message, filepath });
+                return;
+            }
             getInstance()->callbackError(operation, message, filepath);
         }
 
         // Send warning to callback
         static void notifyAboutWarning(Operation operation, std::string message = "", std::string filepath = "")
         {
+            if (pDeferred != NULL)
+            {
+                pDeferred->push_back({ false, operation, message, filepath });
+                return;
+            }
             getInstance()->callbackWarning(operation, message, filepath);
         }
 
+        // Collect notifications of calling thread instead of sending them, until called with NULL.
+        // Used by worker threads, since callbacks are expected on the thread using the GUI
+        static void deferOnThisThread(std::vector<Notification>* pNotifications)
+        {
+            pDeferred = pNotifications;
+        }
+
+        // Send notifications collected before
+        static void notify(const std::vector<Notification>& rNotifications)
+        {
+            for (const Notification& rNotification : rNotifications)
+            {
+                if (rNotification.error)
+                {
+                    notifyAboutError(rNotification.operation, rNotification.message, rNotification.filepath);
+                }
+                else
+                {
+                    notifyAboutWarning(rNotification.operation, rNotification.message, rNotification.filepath);
+                }
+            }
+        }
+
         // Set function to call back
         static void setErrorCallback(void(*pCallbackFunction)(std::string))
         {
@@ -162,6 +205,9 @@ namespace eyegui
         // The pointer to the single instance
         static OperationNotifier* pInstance;
 
+        // Collected notifications of thread, NULL if sent directly
+        static thread_local std::vector<Notification>* pDeferred;
+
         // Member
         bool mErrorCallbackSet;
         bool mWarningCallbackSet;
@@ -9,7 +9,6 @@
 
 #include "OperationNotifier.h"
 #include "Helper.h"
-#include "PathBuilder.h"
 
 namespace eyegui
 {
@@ -23,17 +22,14 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
+            // Get template, file is only read and parsed when it changed
+            std::string errorMessage;
+            ElementTemplate const * xmlElement = pAssetManager->fetchBrickTemplate(filepath, errorMessage);
+            if (xmlElement == NULL)
             {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                throwError(OperationNotifier::Operation::PARSING, errorMessage, filepath);
             }
 
-            // Get first xml element
-            tinyxml2::XMLElement* xmlElement = doc.FirstChildElement();
-
             // Collect values to return
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
             upPair = std::move(element_parser::parse(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, pParent, filepath, idMapper));
@@ -4,7 +4,9 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Parser for bricks. Delegates element parser for actual work.
+// Parser for bricks. Delegates element parser for actual work. Templates of
+// bricks are cached by asset manager, so repeated instantiation of the same
+// brick neither reads nor parses its file again.
 
 #ifndef BRICK_PARSER_H_
 #define BRICK_PARSER_H_
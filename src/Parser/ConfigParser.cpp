@@ -14,8 +14,6 @@
 #include "PathBuilder.h"
 
 #include <algorithm>
-#include <sstream>
-#include <fstream>
 
 namespace eyegui
 {
@@ -34,21 +32,16 @@ namespace eyegui
             config.filepath = filepath;
 
             // Read file
-            std::ifstream in(buildPath(filepath).c_str(), std::ios::in);
+            FileView view = viewFile(filepath);
 
             // Check whether file was found
-            if (!in)
+            if (!view.isValid())
             {
                 throwError(OperationNotifier::Operation::PARSING, "Config file not found", filepath);
             }
 
-            // Convert input file to string
-            std::stringstream strStream;
-            strStream << in.rdbuf();
-            std::string content = strStream.str();
-
-            // Close file
-            in.close();
+            // Convert content of file to string
+            std::string content = view.toString();
 
             // Get rid of whitespaces
             std::string::iterator end_pos = std::remove(content.begin(), content.end(), ' ');
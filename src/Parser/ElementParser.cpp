@@ -12,11 +12,13 @@
 #include "OperationNotifier.h"
 #include "externals/utfcpp/source/utf8.h"
 
+#include <cstdlib>
+
 namespace eyegui
 {
     namespace element_parser
     {
-        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, tinyxml2::XMLElement const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper)
+        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, ElementTemplate const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper)
         {
             // Create map for ids
             std::unique_ptr<idMap> upIdMap = std::unique_ptr<idMap>(new std::map<std::string, Element*>);
@@ -33,7 +35,7 @@ namespace eyegui
             return std::move(upPair);
         }
 
-        std::unique_ptr<Element> parseElement(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, tinyxml2::XMLElement const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Element> parseElement(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, ElementTemplate const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Name of style of element (if xmlElement == NULL, get style of parent if available)
             std::string styleName = parseStyleName(xmlElement, pParent, pLayout->getNamesOfAvailableStyles(), filepath);
@@ -48,7 +50,7 @@ namespace eyegui
             std::unique_ptr<Element> upElement;
 
             // Id of element
-            std::string id = parseStringAttribute("id", xmlElement);
+            std::string id = parseStringAttribute(ElementTemplate::AttributeId::ID, xmlElement);
 
             // Try to map id using id mapper
             auto it = rIdMapper.find(id);
@@ -61,58 +63,50 @@ namespace eyegui
             float relativeScale = parseRelativeScale(xmlElement);
 
             // Border of element
-            float border = parsePercentAttribute("border", xmlElement);
+            float border = parsePercentAttribute(ElementTemplate::AttributeId::BORDER, xmlElement);
 
             // Dimmable
-            bool dimmable = parseBoolAttribute("dimmable", xmlElement);
+            bool dimmable = parseBoolAttribute(ElementTemplate::AttributeId::DIMMABLE, xmlElement);
 
             // Adaptive scaling
-            bool adaptiveScaling = parseBoolAttribute("adaptivescaling", xmlElement);
+            bool adaptiveScaling = parseBoolAttribute(ElementTemplate::AttributeId::ADAPTIVESCALING, xmlElement);
 
-            std::string value = std::string(xmlElement->Value());
-            if (value == "grid")
+            // Create element of kind
+            switch (xmlElement->getKind())
             {
+            case ElementTemplate::Kind::GRID:
                 upElement = std::move(parseGrid(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
-            }
-            else if (value == "blank")
-            {
+                break;
+            case ElementTemplate::Kind::BLANK:
                 upElement = std::move(parseBlank(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "block")
-            {
+                break;
+            case ElementTemplate::Kind::BLOCK:
                 upElement = std::move(parseBlock(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "picture")
-            {
+                break;
+            case ElementTemplate::Kind::PICTURE:
                 upElement = std::move(parsePicture(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "stack")
-            {
+                break;
+            case ElementTemplate::Kind::STACK:
                 upElement = std::move(parseStack(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
-            }
-            else if (value == "textblock")
-            {
+                break;
+            case ElementTemplate::Kind::TEXTBLOCK:
                 upElement = std::move(parseTextBlock(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "circlebutton")
-            {
+                break;
+            case ElementTemplate::Kind::CIRCLEBUTTON:
                 upElement = std::move(parseCircleButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "boxbutton")
-            {
+                break;
+            case ElementTemplate::Kind::BOXBUTTON:
                 upElement = std::move(parseBoxButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "sensor")
-            {
+                break;
+            case ElementTemplate::Kind::SENSOR:
                 upElement = std::move(parseSensor(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "dropbutton")
-            {
+                break;
+            case ElementTemplate::Kind::DROPBUTTON:
                 upElement = std::move(parseDropButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimmable, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown element found: " + std::string(xmlElement->Value()), filepath);
+                break;
+            default:
+                throwError(OperationNotifier::Operation::PARSING, "Unknown element found: " + xmlElement->getName(), filepath);
+                break;
             }
 
             // Return element, but save id before
@@ -127,33 +121,33 @@ namespace eyegui
             }
         }
 
-        std::unique_ptr<Grid> parseGrid(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlGrid, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Grid> parseGrid(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlGrid, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Consume input?
-            bool consumeInput = parseBoolAttribute("consumeinput", xmlGrid);
+            bool consumeInput = parseBoolAttribute(ElementTemplate::AttributeId::CONSUMEINPUT, xmlGrid);
 
             // Get inner border
-            float innerBorder = parsePercentAttribute("innerborder", xmlGrid);
+            float innerBorder = parsePercentAttribute(ElementTemplate::AttributeId::INNERBORDER, xmlGrid);
 
             // Show background?
-            bool showBackground = parseBoolAttribute("showbackground", xmlGrid);
+            bool showBackground = parseBoolAttribute(ElementTemplate::AttributeId::SHOWBACKGROUND, xmlGrid);
 
             // Get first row
-            tinyxml2::XMLElement const * xmlRow = xmlGrid->FirstChildElement();
-            if (!validateElement(xmlRow, "row"))
+            ElementTemplate const * xmlRow = xmlGrid->getFirstChild();
+            if (!validateElement(xmlRow, ElementTemplate::Kind::ROW))
             {
                 throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
             }
 
             // Count of rows
             int rows = 0;
-            tinyxml2::XMLElement const * xmlRowCounter = xmlRow;
+            ElementTemplate const * xmlRowCounter = xmlRow;
 
             while (xmlRowCounter != NULL)
             {
                 // Checking whether it is really a row element is done later
                 rows++;
-                xmlRowCounter = xmlRowCounter->NextSiblingElement();
+                xmlRowCounter = xmlRowCounter->getNextSibling();
             }
 
             // Create grid
@@ -179,44 +173,44 @@ namespace eyegui
             for (int i = 0; i < rows; i++)
             {
                 // Get first column
-                tinyxml2::XMLElement const * xmlColumn = xmlRow->FirstChildElement();
-                if (!validateElement(xmlColumn, "column"))
+                ElementTemplate const * xmlColumn = xmlRow->getFirstChild();
+                if (!validateElement(xmlColumn, ElementTemplate::Kind::COLUMN))
                 {
                     throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
                 }
 
                 // Get column count
                 int columns = 0;
-                tinyxml2::XMLElement const * xmlColumnCounter = xmlColumn;
+                ElementTemplate const * xmlColumnCounter = xmlColumn;
 
                 while (xmlColumnCounter != NULL)
                 {
                     // Checking whether it is really a column element is done later
                     columns++;
-                    xmlColumnCounter = xmlColumnCounter->NextSiblingElement();
+                    xmlColumnCounter = xmlColumnCounter->getNextSibling();
                 }
 
                 // Tell grid about column count
                 upGrid->prepareColumns(i, columns);
 
                 // Set height of row
-                upGrid->setRelativeHeightOfRow(i, parsePercentAttribute("size", xmlRow));
+                upGrid->setRelativeHeightOfRow(i, parsePercentAttribute(ElementTemplate::AttributeId::SIZE, xmlRow));
 
                 // Go over columns
                 for (int j = 0; j < columns; j++)
                 {
                     // Set width of column
-                    upGrid->setRelativeWidthOfCell(i, j, parsePercentAttribute("size", xmlColumn));
+                    upGrid->setRelativeWidthOfCell(i, j, parsePercentAttribute(ElementTemplate::AttributeId::SIZE, xmlColumn));
 
                     // Determine element in cell
-                    tinyxml2::XMLElement const * xmlElement = xmlColumn->FirstChildElement();
+                    ElementTemplate const * xmlElement = xmlColumn->getFirstChild();
                     upGrid->attachElement(i, j, std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upGrid.get(), filepath, rIdMapper, rIdMap)));
 
                     // Get column sibling if necessary
-                    xmlColumn = xmlColumn->NextSiblingElement();
+                    xmlColumn = xmlColumn->getNextSibling();
                     if (j < columns - 1)
                     {
-                        if (!validateElement(xmlColumn, "column"))
+                        if (!validateElement(xmlColumn, ElementTemplate::Kind::COLUMN))
                         {
                             throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
                         }
@@ -231,10 +225,10 @@ namespace eyegui
                 }
 
                 // Get row sibling if necessary
-                xmlRow = xmlRow->NextSiblingElement();
+                xmlRow = xmlRow->getNextSibling();
                 if (i < rows - 1)
                 {
-                    if (!validateElement(xmlRow, "row"))
+                    if (!validateElement(xmlRow, ElementTemplate::Kind::ROW))
                     {
                         throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
                     }
@@ -258,30 +252,30 @@ namespace eyegui
             return std::move(upGrid);
         }
 
-        std::unique_ptr<Blank> parseBlank(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBlank, Element* pParent, std::string filepath)
+        std::unique_ptr<Blank> parseBlank(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlBlank, Element* pParent, std::string filepath)
         {
             // Create and return blank
             std::unique_ptr<Blank> upBlank = std::unique_ptr<Blank>(new Blank(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling));
             return (std::move(upBlank));
         }
 
-        std::unique_ptr<Block> parseBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBlock, Element* pParent, std::string filepath)
+        std::unique_ptr<Block> parseBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlBlock, Element* pParent, std::string filepath)
         {
             // Consume input?
-            bool consumeInput = parseBoolAttribute("consumeinput", xmlBlock);
+            bool consumeInput = parseBoolAttribute(ElementTemplate::AttributeId::CONSUMEINPUT, xmlBlock);
 
             // Create block and return
             std::unique_ptr<Block> upBlock = std::unique_ptr<Block>(new Block(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling, consumeInput));
             return (std::move(upBlock));
         }
 
-        std::unique_ptr<Picture> parsePicture(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlPicture, Element* pParent, std::string filepath)
+        std::unique_ptr<Picture> parsePicture(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlPicture, Element* pParent, std::string filepath)
         {
             // Get full path to image file
-            std::string imageFilepath = parseStringAttribute("src", xmlPicture);
+            std::string imageFilepath = parseStringAttribute(ElementTemplate::AttributeId::SRC, xmlPicture);
 
             // Get alignment
-            std::string alignmentValue = parseStringAttribute("alignment", xmlPicture);
+            std::string alignmentValue = parseStringAttribute(ElementTemplate::AttributeId::ALIGNMENT, xmlPicture);
             PictureAlignment alignment;
             if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "original")
             {
@@ -301,19 +295,19 @@ namespace eyegui
             return (std::move(upPicture));
         }
 
-        std::unique_ptr<Stack> parseStack(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlStack, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Stack> parseStack(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlStack, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Consume input?
-            bool consumeInput = parseBoolAttribute("consumeinput", xmlStack);
+            bool consumeInput = parseBoolAttribute(ElementTemplate::AttributeId::CONSUMEINPUT, xmlStack);
 
             // Get inner border
-            float innerBorder = parsePercentAttribute("innerborder", xmlStack);
+            float innerBorder = parsePercentAttribute(ElementTemplate::AttributeId::INNERBORDER, xmlStack);
 
             // Show background?
-            bool showBackground = parseBoolAttribute("showbackground", xmlStack);
+            bool showBackground = parseBoolAttribute(ElementTemplate::AttributeId::SHOWBACKGROUND, xmlStack);
 
             // Get mode of relative scaling
-            std::string relativeScalingValue = parseStringAttribute("relativescaling", xmlStack);
+            std::string relativeScalingValue = parseStringAttribute(ElementTemplate::AttributeId::RELATIVESCALING, xmlStack);
             Stack::RelativeScaling relativeScaling;
             if (relativeScalingValue == EMPTY_STRING_ATTRIBUTE || relativeScalingValue == "mainaxis")
             {
@@ -329,7 +323,7 @@ namespace eyegui
             }
 
             // Get alignment
-            std::string alignmentValue = parseStringAttribute("alignment", xmlStack);
+            std::string alignmentValue = parseStringAttribute(ElementTemplate::AttributeId::ALIGNMENT, xmlStack);
             Stack::Alignment alignment;
             if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "fill")
             {
@@ -353,14 +347,14 @@ namespace eyegui
             }
 
             // Get padding
-            float padding = parsePercentAttribute("padding", xmlStack);
+            float padding = parsePercentAttribute(ElementTemplate::AttributeId::PADDING, xmlStack);
             if (padding < 0 || padding > 1)
             {
                 throwError(OperationNotifier::Operation::PARSING, "Padding value of stack not in range of 0% to 100%", filepath);
             }
 
             // Get separator
-            float separator = parsePercentAttribute("separator", xmlStack);
+            float separator = parsePercentAttribute(ElementTemplate::AttributeId::SEPARATOR, xmlStack);
             if (separator < 0 || separator > 1)
             {
                 throwError(OperationNotifier::Operation::PARSING, "Separator value of stack not in range of 0% to 100%", filepath);
@@ -389,30 +383,30 @@ namespace eyegui
                     separator));
 
             // Insert elements
-            tinyxml2::XMLElement const * xmlElement = xmlStack->FirstChildElement();
+            ElementTemplate const * xmlElement = xmlStack->getFirstChild();
             while (xmlElement != NULL)
             {
                 // Fetch element
                 upStack->attachElement(std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upStack.get(), filepath, rIdMapper, rIdMap)));
 
                 // Try to get next sibling element
-                xmlElement = xmlElement->NextSiblingElement();
+                xmlElement = xmlElement->getNextSibling();
             }
 
             // Return stack
             return (std::move(upStack));
         }
 
-        std::unique_ptr<TextBlock> parseTextBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlTextBlock, Element* pParent, std::string filepath)
+        std::unique_ptr<TextBlock> parseTextBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlTextBlock, Element* pParent, std::string filepath)
         {
             // Consume input?
-            bool consumeInput = parseBoolAttribute("consumeinput", xmlTextBlock);
+            bool consumeInput = parseBoolAttribute(ElementTemplate::AttributeId::CONSUMEINPUT, xmlTextBlock);
 
             // Get inner border
-            float innerBorder = parsePercentAttribute("innerborder", xmlTextBlock);
+            float innerBorder = parsePercentAttribute(ElementTemplate::AttributeId::INNERBORDER, xmlTextBlock);
 
             // Get font size
-            std::string fontSizeValue = parseStringAttribute("fontsize", xmlTextBlock);
+            std::string fontSizeValue = parseStringAttribute(ElementTemplate::AttributeId::FONTSIZE, xmlTextBlock);
             FontSize fontSize;
             if (fontSizeValue == EMPTY_STRING_ATTRIBUTE || fontSizeValue == "medium")
             {
@@ -432,7 +426,7 @@ namespace eyegui
             }
 
             // Get alignment
-            std::string alignmentValue = parseStringAttribute("alignment", xmlTextBlock);
+            std::string alignmentValue = parseStringAttribute(ElementTemplate::AttributeId::ALIGNMENT, xmlTextBlock);
             TextFlowAlignment alignment;
             if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "left")
             {
@@ -456,7 +450,7 @@ namespace eyegui
             }
 
             // Get vertical alignment
-            std::string verticalAlignmentValue = parseStringAttribute("verticalalignment", xmlTextBlock);
+            std::string verticalAlignmentValue = parseStringAttribute(ElementTemplate::AttributeId::VERTICALALIGNMENT, xmlTextBlock);
             TextFlowVerticalAlignment verticalAlignment;
             if (verticalAlignmentValue == EMPTY_STRING_ATTRIBUTE || verticalAlignmentValue == "top")
             {
@@ -476,12 +470,12 @@ namespace eyegui
             }
 
             // Get content
-            std::string contentValue = parseStringAttribute("content", xmlTextBlock);
+            std::string contentValue = parseStringAttribute(ElementTemplate::AttributeId::CONTENT, xmlTextBlock);
             std::u16string content;
             utf8::utf8to16(contentValue.begin(), contentValue.end(), back_inserter(content));
 
             // Get key for localization
-            std::string key = parseStringAttribute("key", xmlTextBlock);
+            std::string key = parseStringAttribute(ElementTemplate::AttributeId::KEY, xmlTextBlock);
 
             // Create text block
             std::unique_ptr<TextBlock> upTextBlock = std::unique_ptr<TextBlock>(new TextBlock(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling, consumeInput, innerBorder, fontSize, alignment, verticalAlignment, content, key));
@@ -490,13 +484,13 @@ namespace eyegui
             return std::move(upTextBlock);
         }
 
-        std::unique_ptr<CircleButton> parseCircleButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlCircleButton, Element* pParent, std::string filepath)
+        std::unique_ptr<CircleButton> parseCircleButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlCircleButton, Element* pParent, std::string filepath)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlCircleButton);
+            std::string iconFilepath = parseStringAttribute(ElementTemplate::AttributeId::ICON, xmlCircleButton);
 
             // Is button a switch?
-            bool isSwitch = parseBoolAttribute("switch", xmlCircleButton);
+            bool isSwitch = parseBoolAttribute(ElementTemplate::AttributeId::SWITCH, xmlCircleButton);
 
             // Create circle button
             std::unique_ptr<CircleButton> upCircleButton = std::unique_ptr<CircleButton>(new CircleButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling, iconFilepath, isSwitch));
@@ -505,13 +499,13 @@ namespace eyegui
             return (std::move(upCircleButton));
         }
 
-        std::unique_ptr<BoxButton> parseBoxButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBoxButton, Element* pParent, std::string filepath)
+        std::unique_ptr<BoxButton> parseBoxButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlBoxButton, Element* pParent, std::string filepath)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlBoxButton);
+            std::string iconFilepath = parseStringAttribute(ElementTemplate::AttributeId::ICON, xmlBoxButton);
 
             // Is button a switch?
-            bool isSwitch = parseBoolAttribute("switch", xmlBoxButton);
+            bool isSwitch = parseBoolAttribute(ElementTemplate::AttributeId::SWITCH, xmlBoxButton);
 
             // Create box button
             std::unique_ptr<BoxButton> upBoxButton = std::unique_ptr<BoxButton>(new BoxButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling, iconFilepath, isSwitch));
@@ -520,10 +514,10 @@ namespace eyegui
             return (std::move(upBoxButton));
         }
 
-        std::unique_ptr<Sensor> parseSensor(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlSensor, Element* pParent, std::string filepath)
+        std::unique_ptr<Sensor> parseSensor(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlSensor, Element* pParent, std::string filepath)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlSensor);
+            std::string iconFilepath = parseStringAttribute(ElementTemplate::AttributeId::ICON, xmlSensor);
 
             // Create sensor
             std::unique_ptr<Sensor> upSensor = std::unique_ptr<Sensor>(new Sensor(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling, iconFilepath));
@@ -532,13 +526,13 @@ namespace eyegui
             return (std::move(upSensor));
         }
 
-        std::unique_ptr<DropButton> parseDropButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, tinyxml2::XMLElement const * xmlDropButton, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<DropButton> parseDropButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimmable, bool adaptiveScaling, ElementTemplate const * xmlDropButton, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlDropButton);
+            std::string iconFilepath = parseStringAttribute(ElementTemplate::AttributeId::ICON, xmlDropButton);
 
             // Get usage of available space
-            float space = parsePercentAttribute("space", xmlDropButton);
+            float space = parsePercentAttribute(ElementTemplate::AttributeId::SPACE, xmlDropButton);
             if (space < 0 || space > 1)
             {
                 throwError(OperationNotifier::Operation::PARSING, "Usage of available space in DropButton not in range of 0% to 100%", filepath);
@@ -548,13 +542,13 @@ namespace eyegui
             std::unique_ptr<DropButton> upDropButton = std::unique_ptr<DropButton>(new DropButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimmable, adaptiveScaling, iconFilepath, space));
 
             // Attach inner element
-            tinyxml2::XMLElement const * xmlElement = xmlDropButton->FirstChildElement();
+            ElementTemplate const * xmlElement = xmlDropButton->getFirstChild();
 
             if (xmlElement == NULL)
             {
                 throwError(OperationNotifier::Operation::PARSING, "DropButton has no inner element", filepath);
             }
-            else if (xmlElement->NextSiblingElement() != NULL)
+            else if (xmlElement->getNextSibling() != NULL)
             {
                 throwError(OperationNotifier::Operation::PARSING, "DropButton has more than one inner element", filepath);
             }
@@ -565,16 +559,16 @@ namespace eyegui
             return (std::move(upDropButton));
         }
 
-        bool validateElement(tinyxml2::XMLElement const * xmlElement, const std::string& expectedValue)
+        bool validateElement(ElementTemplate const * xmlElement, ElementTemplate::Kind expectedKind)
         {
-            if (xmlElement == NULL || std::string(xmlElement->Value()).compare(expectedValue) != 0)
+            if (xmlElement == NULL || xmlElement->getKind() != expectedKind)
             {
                 return false;
             }
             return true;
         }
 
-        float parseRelativeScale(tinyxml2::XMLElement const * xmlElement)
+        float parseRelativeScale(ElementTemplate const * xmlElement)
         {
             if (xmlElement == NULL)
             {
@@ -582,7 +576,7 @@ namespace eyegui
             }
             else
             {
-                float value = parsePercentAttribute("relativescale", xmlElement);
+                float value = parsePercentAttribute(ElementTemplate::AttributeId::RELATIVESCALE, xmlElement);
                 if (value <= 0)
                 {
                     return 1;
@@ -594,7 +588,7 @@ namespace eyegui
             }
         }
 
-        std::string parseStyleName(tinyxml2::XMLElement const * xmlElement, Element const * pParent, const std::set<std::string>& rNamesOfAvailableStyles, std::string filepath)
+        std::string parseStyleName(ElementTemplate const * xmlElement, Element const * pParent, const std::set<std::string>& rNamesOfAvailableStyles, std::string filepath)
         {
             if (xmlElement == NULL)
             {
@@ -602,7 +596,7 @@ namespace eyegui
             }
             else
             {
-                std::string styleName = parseStringAttribute("style", xmlElement);
+                std::string styleName = parseStringAttribute(ElementTemplate::AttributeId::STYLE, xmlElement);
                 if (styleName == EMPTY_STRING_ATTRIBUTE)
                 {
                     // No style found, try to get one from parent
@@ -637,12 +631,12 @@ namespace eyegui
             }
         }
 
-        std::string parseStringAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, std::string fallback)
+        std::string parseStringAttribute(ElementTemplate::AttributeId id, ElementTemplate const * xmlElement, std::string fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            ElementTemplate::Attribute const * pAttribute = xmlElement->findAttribute(id);
+            if (pAttribute != NULL)
             {
-                return xmlAttribute->Value();
+                return pAttribute->text;
             }
             else
             {
@@ -650,17 +644,13 @@ namespace eyegui
             }
         }
 
-        bool parseBoolAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, bool fallback)
+        bool parseBoolAttribute(ElementTemplate::AttributeId id, ElementTemplate const * xmlElement, bool fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            // Value is converted while reading template
+            ElementTemplate::Attribute const * pAttribute = xmlElement->findAttribute(id);
+            if (pAttribute != NULL)
             {
-                std::string value = xmlAttribute->Value();
-
-                // File format case is not relevant
-                std::transform(value.begin(), value.end(), value.begin(), ::tolower);
-
-                return value == "true";
+                return pAttribute->flag;
             }
             else
             {
@@ -668,12 +658,12 @@ namespace eyegui
             }
         }
 
-        int parseIntAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, int fallback)
+        int parseIntAttribute(ElementTemplate::AttributeId id, ElementTemplate const * xmlElement, int fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            ElementTemplate::Attribute const * pAttribute = xmlElement->findAttribute(id);
+            if (pAttribute != NULL)
             {
-                return xmlAttribute->IntValue();
+                return std::atoi(pAttribute->text.c_str());
             }
             else
             {
@@ -681,15 +671,13 @@ namespace eyegui
             }
         }
 
-        float parsePercentAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, float fallback)
+        float parsePercentAttribute(ElementTemplate::AttributeId id, ElementTemplate const * xmlElement, float fallback)
         {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
+            // Value is converted while reading template
+            ElementTemplate::Attribute const * pAttribute = xmlElement->findAttribute(id);
+            if (pAttribute != NULL)
             {
-                std::string value = xmlAttribute->Value();
-                std::string delimiter = "%";
-                std::string token = value.substr(0, value.find(delimiter));
-                return (std::stof(token) / 100.0f);
+                return pAttribute->percentage;
             }
             else
             {
@@ -0,0 +1,210 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "ElementTemplate.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+namespace eyegui
+{
+    // Names of kinds, in order of enumeration
+    static const char* KIND_NAMES[] =
+    {
+        "", "layout", "grid", "row", "column", "blank", "block", "picture", "stack", "textblock",
+        "circlebutton", "boxbutton", "sensor", "dropbutton"
+    };
+    static_assert(sizeof(KIND_NAMES) / sizeof(KIND_NAMES[0]) == (size_t)ElementTemplate::Kind::COUNT, "Name of each kind expected");
+
+    // Names and types of attributes, in order of enumeration
+    struct AttributeDescription
+    {
+        const char* name;
+        ElementTemplate::AttributeType type;
+    };
+    static const AttributeDescription ATTRIBUTE_DESCRIPTIONS[] =
+    {
+        { "id", ElementTemplate::AttributeType::STRING },
+        { "style", ElementTemplate::AttributeType::STRING },
+        { "relativescale", ElementTemplate::AttributeType::PERCENTAGE },
+        { "border", ElementTemplate::AttributeType::PERCENTAGE },
+        { "dimmable", ElementTemplate::AttributeType::BOOL },
+        { "adaptivescaling", ElementTemplate::AttributeType::BOOL },
+        { "consumeinput", ElementTemplate::AttributeType::BOOL },
+        { "innerborder", ElementTemplate::AttributeType::PERCENTAGE },
+        { "showbackground", ElementTemplate::AttributeType::BOOL },
+        { "size", ElementTemplate::AttributeType::PERCENTAGE },
+        { "src", ElementTemplate::AttributeType::STRING },
+        { "alignment", ElementTemplate::AttributeType::STRING },
+        { "relativescaling", ElementTemplate::AttributeType::STRING },
+        { "padding", ElementTemplate::AttributeType::PERCENTAGE },
+        { "separator", ElementTemplate::AttributeType::PERCENTAGE },
+        { "fontsize", ElementTemplate::AttributeType::STRING },
+        { "verticalalignment", ElementTemplate::AttributeType::STRING },
+        { "content", ElementTemplate::AttributeType::STRING },
+        { "key", ElementTemplate::AttributeType::STRING },
+        { "icon", ElementTemplate::AttributeType::STRING },
+        { "switch", ElementTemplate::AttributeType::BOOL },
+        { "space", ElementTemplate::AttributeType::PERCENTAGE },
+        { "stylesheet", ElementTemplate::AttributeType::STRING }
+    };
+    static_assert(sizeof(ATTRIBUTE_DESCRIPTIONS) / sizeof(ATTRIBUTE_DESCRIPTIONS[0]) == (size_t)ElementTemplate::AttributeId::COUNT, "Description of each attribute expected");
+
+    bool ElementTemplate::Attribute::operator==(const Attribute& rOther) const
+    {
+        return id == rOther.id && text == rOther.text && percentage == rOther.percentage && flag == rOther.flag;
+    }
+
+    ElementTemplate::ElementTemplate(Kind kind, std::string name, attributeList attributes, childList children)
+    {
+        // Initialize members
+        mKind = kind;
+        mName = name;
+        mAttributes = std::move(attributes);
+        mChildren = std::move(children);
+        mpNextSibling = NULL;
+        linkChildren();
+    }
+
+    ElementTemplate::~ElementTemplate()
+    {
+        // Nothing to do
+    }
+
+    ElementTemplate::Attribute const * ElementTemplate::findAttribute(AttributeId id) const
+    {
+        for (const Attribute& rAttribute : mAttributes)
+        {
+            if (rAttribute.id == id)
+            {
+                return &rAttribute;
+            }
+        }
+        return NULL;
+    }
+
+    ElementTemplate const * ElementTemplate::getFirstChild() const
+    {
+        return mChildren.empty() ? NULL : mChildren.front().get();
+    }
+
+    bool ElementTemplate::isEqual(const ElementTemplate& rOther) const
+    {
+        if (mKind != rOther.mKind || mAttributes != rOther.mAttributes || mChildren.size() != rOther.mChildren.size())
+        {
+            return false;
+        }
+        for (uint i = 0; i < mChildren.size(); i++)
+        {
+            if (!mChildren[i]->isEqual(*(rOther.mChildren[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ElementTemplate::Kind ElementTemplate::findKind(const std::string& rName)
+    {
+        for (uint i = 1; i < (uint)Kind::COUNT; i++)
+        {
+            if (rName == KIND_NAMES[i])
+            {
+                return (Kind)i;
+            }
+        }
+        return Kind::UNKNOWN;
+    }
+
+    std::string ElementTemplate::getKindName(Kind kind)
+    {
+        return KIND_NAMES[(uint)kind];
+    }
+
+    bool ElementTemplate::findAttributeId(const std::string& rName, AttributeId& rId)
+    {
+        for (uint i = 0; i < (uint)AttributeId::COUNT; i++)
+        {
+            if (rName == ATTRIBUTE_DESCRIPTIONS[i].name)
+            {
+                rId = (AttributeId)i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string ElementTemplate::getAttributeName(AttributeId id)
+    {
+        return ATTRIBUTE_DESCRIPTIONS[(uint)id].name;
+    }
+
+    ElementTemplate::AttributeType ElementTemplate::getAttributeType(AttributeId id)
+    {
+        return ATTRIBUTE_DESCRIPTIONS[(uint)id].type;
+    }
+
+    bool ElementTemplate::convertAttribute(const std::string& rText, Attribute& rAttribute)
+    {
+        switch (getAttributeType(rAttribute.id))
+        {
+        case AttributeType::STRING:
+        {
+            rAttribute.text = rText;
+            return true;
+        }
+        case AttributeType::PERCENTAGE:
+        {
+            // Number in front of optional percent sign
+            std::string token = rText.substr(0, rText.find("%"));
+            char* pEnd = NULL;
+            float value = std::strtof(token.c_str(), &pEnd);
+            while (pEnd != token.c_str() && std::isspace((uchar)*pEnd))
+            {
+                pEnd++;
+            }
+            if (pEnd == token.c_str() || *pEnd != '\0')
+            {
+                return false;
+            }
+            rAttribute.percentage = value / 100.0f;
+            return true;
+        }
+        case AttributeType::BOOL:
+        {
+            // File format case is not relevant
+            std::string value = rText;
+            std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+            rAttribute.flag = value == "true";
+            return true;
+        }
+        }
+        return false;
+    }
+
+    bool ElementTemplate::isInRange(const Attribute& rAttribute)
+    {
+        switch (rAttribute.id)
+        {
+        case AttributeId::PADDING:
+        case AttributeId::SEPARATOR:
+        case AttributeId::SPACE:
+            return rAttribute.percentage >= 0 && rAttribute.percentage <= 1;
+        default:
+            return true;
+        }
+    }
+
+    void ElementTemplate::linkChildren()
+    {
+        for (uint i = 0; i + 1 < mChildren.size(); i++)
+        {
+            mChildren[i]->mpNextSibling = mChildren[i + 1].get();
+        }
+    }
+}
@@ -0,0 +1,131 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Immutable tree of element kinds and attributes as read from a layout or
+// brick file. Element parser creates elements out of it, so a template can be
+// instantiated again and again without reading or parsing the file again.
+// Attributes are identified by enumeration and their values are converted
+// to their type when the template is created. Unknown attributes are dropped.
+
+#ifndef ELEMENT_TEMPLATE_H_
+#define ELEMENT_TEMPLATE_H_
+
+#include "Defines.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class ElementTemplate
+    {
+    public:
+
+        // Kinds of nodes. Values are stored in compiled templates, so only append
+        enum class Kind
+        {
+            UNKNOWN, LAYOUT, GRID, ROW, COLUMN, BLANK, BLOCK, PICTURE, STACK, TEXTBLOCK,
+            CIRCLEBUTTON, BOXBUTTON, SENSOR, DROPBUTTON, COUNT
+        };
+
+        // Known attributes. Values are stored in compiled templates, so only append
+        enum class AttributeId
+        {
+            ID, STYLE, RELATIVESCALE, BORDER, DIMMABLE, ADAPTIVESCALING, CONSUMEINPUT, INNERBORDER,
+            SHOWBACKGROUND, SIZE, SRC, ALIGNMENT, RELATIVESCALING, PADDING, SEPARATOR, FONTSIZE,
+            VERTICALALIGNMENT, CONTENT, KEY, ICON, SWITCH, SPACE, STYLESHEET, COUNT
+        };
+
+        // Types of attribute values
+        enum class AttributeType { STRING, PERCENTAGE, BOOL };
+
+        // Attribute with value converted to its type
+        struct Attribute
+        {
+            AttributeId id;
+            std::string text; // Value of string attributes
+            float percentage = 0; // Value of percentage attributes, as fraction
+            bool flag = false; // Value of bool attributes
+
+            // Compare id and value
+            bool operator==(const Attribute& rOther) const;
+        };
+
+        // Typedefs
+        typedef std::vector<Attribute> attributeList;
+        typedef std::vector<std::unique_ptr<ElementTemplate> > childList;
+
+        // Constructor taking over attributes and children. Name is kept for messages about unknown kinds
+        ElementTemplate(Kind kind, std::string name, attributeList attributes, childList children);
+
+        // Destructor
+        virtual ~ElementTemplate();
+
+        // Getter for kind of element
+        Kind getKind() const { return mKind; }
+
+        // Getter for name of element
+        const std::string& getName() const { return mName; }
+
+        // Getter for attributes in order of file
+        const attributeList& getAttributes() const { return mAttributes; }
+
+        // Find attribute, NULL if not existing
+        Attribute const * findAttribute(AttributeId id) const;
+
+        // Get first child, NULL if there are no children
+        ElementTemplate const * getFirstChild() const;
+
+        // Get next sibling, NULL for last child
+        ElementTemplate const * getNextSibling() const { return mpNextSibling; }
+
+        // Getter for children
+        const childList& getChildren() const { return mChildren; }
+
+        // Compare kinds, attributes and children
+        bool isEqual(const ElementTemplate& rOther) const;
+
+        // Kind of node with name, UNKNOWN if there is none
+        static Kind findKind(const std::string& rName);
+
+        // Name of kind
+        static std::string getKindName(Kind kind);
+
+        // Id of attribute with name, returns false if attribute is unknown
+        static bool findAttributeId(const std::string& rName, AttributeId& rId);
+
+        // Name of attribute
+        static std::string getAttributeName(AttributeId id);
+
+        // Type of attribute
+        static AttributeType getAttributeType(AttributeId id);
+
+        // Convert text of attribute to its type, returns false if text does not fit
+        static bool convertAttribute(const std::string& rText, Attribute& rAttribute);
+
+        // Check value of attribute against range used by element parser
+        static bool isInRange(const Attribute& rAttribute);
+
+    private:
+
+        // No copies, siblings are linked by pointers
+        ElementTemplate(const ElementTemplate&) = delete;
+        ElementTemplate& operator=(const ElementTemplate&) = delete;
+
+        // Link children as siblings
+        void linkChildren();
+
+        // Members
+        Kind mKind;
+        std::string mName;
+        attributeList mAttributes;
+        childList mChildren;
+        ElementTemplate const * mpNextSibling;
+    };
+}
+
+#endif // ELEMENT_TEMPLATE_H_
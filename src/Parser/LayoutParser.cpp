@@ -8,16 +8,30 @@
 #include "LayoutParser.h"
 
 #include "StylesheetParser.h"
+#include "TemplateParser.h"
 #include "Layout.h"
 #include "OperationNotifier.h"
 #include "Helper.h"
-#include "PathBuilder.h"
 
 namespace eyegui
 {
     namespace layout_parser
     {
         std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath)
+        {
+            // Read file
+            std::string errorMessage;
+            std::unique_ptr<ElementTemplate> upTemplate = template_parser::parse(filepath, errorMessage);
+            return parse(pGUI, pAssetManager, filepath, upTemplate.get(), errorMessage);
+        }
+
+        std::unique_ptr<Layout> parse(
+            GUI* pGUI,
+            AssetManager* pAssetManager,
+            std::string filepath,
+            ElementTemplate const * pTemplate,
+            std::string errorMessage,
+            std::unique_ptr<std::map<std::string, Style> > upStyles)
         {
             // Check file name
             if (!checkFileNameExtension(filepath, LAYOUT_EXTENSION))
@@ -25,29 +39,30 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
+            // Check whether file was read
+            if (pTemplate == NULL)
             {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                throwError(OperationNotifier::Operation::PARSING, errorMessage, filepath);
             }
 
             // First xml element should be a layout
-            tinyxml2::XMLElement* xmlLayout = doc.FirstChildElement();
-            if (!element_parser::validateElement(xmlLayout, "layout"))
+            ElementTemplate const * xmlLayout = pTemplate;
+            if (!element_parser::validateElement(xmlLayout, ElementTemplate::Kind::LAYOUT))
             {
                 throwError(OperationNotifier::Operation::PARSING, "No layout node as root in XML found", filepath);
             }
 
-            // Get path to stylesheet
-            std::string stylesheetFilepath = element_parser::parseStringAttribute("stylesheet", xmlLayout);
+            // Parse stylesheet if not done before
+            if (upStyles == NULL)
+            {
+                upStyles = parseStylesheet(xmlLayout);
+            }
 
             // Create layout
-            std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, stylesheetFilepath));
+            std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, std::move(upStyles)));
 
             // Then there should be an element
-            tinyxml2::XMLElement* xmlRoot = xmlLayout->FirstChildElement();
+            ElementTemplate const * xmlRoot = xmlLayout->getFirstChild();
 
             // Check for existence
             if (xmlRoot == NULL)
@@ -63,5 +78,14 @@ namespace eyegui
             // Return ready to use layout
             return(std::move(upLayout));
         }
+
+        std::unique_ptr<std::map<std::string, Style> > parseStylesheet(ElementTemplate const * pTemplate)
+        {
+            if (pTemplate == NULL || !element_parser::validateElement(pTemplate, ElementTemplate::Kind::LAYOUT))
+            {
+                return NULL;
+            }
+            return stylesheet_parser::parse(element_parser::parseStringAttribute(ElementTemplate::AttributeId::STYLESHEET, pTemplate));
+        }
     }
 }
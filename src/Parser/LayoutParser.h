@@ -10,6 +10,7 @@
 #define LAYOUT_PARSER_H_
 
 #include "ElementParser.h"
+#include "StylesheetParser.h"
 
 namespace eyegui
 {
@@ -21,6 +22,19 @@ namespace eyegui
 	{
 		// Parsing
 		std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath);
+
+		// Parsing of template read before, maybe on another thread. Error message is reported if template is NULL.
+		// Stylesheet is parsed here if not given
+		std::unique_ptr<Layout> parse(
+			GUI* pGUI,
+			AssetManager* pAssetManager,
+			std::string filepath,
+			ElementTemplate const * pTemplate,
+			std::string errorMessage,
+			std::unique_ptr<std::map<std::string, Style> > upStyles = NULL);
+
+		// Parsing of stylesheet referenced by template of layout. Returns NULL if template is no layout
+		std::unique_ptr<std::map<std::string, Style> > parseStylesheet(ElementTemplate const * pTemplate);
 	}
 }
 
@@ -14,7 +14,7 @@
 #include "externals/utfcpp/source/utf8.h"
 
 #include <string>
-#include <fstream>
+#include <sstream>
 #include <algorithm>
 
 namespace eyegui
@@ -33,13 +33,14 @@ namespace eyegui
             std::unique_ptr<localizationMap> upMap = std::unique_ptr<localizationMap>(new localizationMap);
 
             // Read file
-            std::ifstream in(buildPath(filepath));
+            FileView view = viewFile(filepath);
 
             // Check whether file was found
-            if (!in)
+            if (!view.isValid())
             {
                 throwError(OperationNotifier::Operation::PARSING, "Localization file not found", filepath);
             }
+            std::istringstream in(view.toString());
 
             // Some values for iteration
             unsigned int line_count = 1;
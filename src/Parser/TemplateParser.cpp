@@ -0,0 +1,389 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "TemplateParser.h"
+
+#include "PathBuilder.h"
+#include "externals/TinyXML2/tinyxml2.h"
+
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <map>
+
+namespace eyegui
+{
+    namespace template_parser
+    {
+        // Identification of compiled templates
+        static const uint32_t COMPILED_TEMPLATE_MAGIC = 0x54434745; // "EGCT"
+        static const uint32_t COMPILED_TEMPLATE_VERSION = 2;
+
+        // Nesting of elements deeper than this is refused, so recursion over templates stays bounded
+        static const uint TEMPLATE_MAX_DEPTH = 256;
+
+        // Bytes of element without attributes and children: kind, count of attributes and count of children
+        static const size_t COMPILED_ELEMENT_SIZE = 3 * sizeof(uint32_t);
+
+        // Bytes of attribute: id and value
+        static const size_t COMPILED_ATTRIBUTE_SIZE = 2 * sizeof(uint32_t);
+
+        // Read position inside of compiled template
+        struct CompiledReader
+        {
+            uchar const * pData;
+            size_t size;
+            size_t position;
+            std::vector<std::string> strings;
+
+            // Count of bytes not yet read
+            size_t left() const
+            {
+                return size - position;
+            }
+
+            // Read number, returns false at end of data
+            bool read(uint32_t& rValue)
+            {
+                if (left() < sizeof(uint32_t))
+                {
+                    return false;
+                }
+                std::memcpy(&rValue, pData + position, sizeof(uint32_t));
+                position += sizeof(uint32_t);
+                return true;
+            }
+        };
+
+        // Read value of attribute by type of its id, returns false if value is damaged
+        static bool readCompiledAttribute(CompiledReader& rReader, ElementTemplate::Attribute& rAttribute)
+        {
+            uint32_t id, value;
+            if (!rReader.read(id) || !rReader.read(value) || id >= (uint32_t)ElementTemplate::AttributeId::COUNT)
+            {
+                return false;
+            }
+            rAttribute.id = (ElementTemplate::AttributeId)id;
+            switch (ElementTemplate::getAttributeType(rAttribute.id))
+            {
+            case ElementTemplate::AttributeType::STRING:
+                if (value >= rReader.strings.size())
+                {
+                    return false;
+                }
+                rAttribute.text = rReader.strings[value];
+                return true;
+            case ElementTemplate::AttributeType::PERCENTAGE:
+                std::memcpy(&rAttribute.percentage, &value, sizeof(float));
+                return std::isfinite(rAttribute.percentage);
+            case ElementTemplate::AttributeType::BOOL:
+                rAttribute.flag = value == 1;
+                return value <= 1;
+            }
+            return false;
+        }
+
+        // Read element with children, returns NULL if data is damaged
+        static std::unique_ptr<ElementTemplate> readCompiledElement(CompiledReader& rReader, uint depth)
+        {
+            uint32_t kind, attributeCount, childCount;
+            if (depth > TEMPLATE_MAX_DEPTH
+                || !rReader.read(kind) || !rReader.read(attributeCount) || !rReader.read(childCount)
+                || kind == (uint32_t)ElementTemplate::Kind::UNKNOWN || kind >= (uint32_t)ElementTemplate::Kind::COUNT)
+            {
+                return NULL;
+            }
+
+            // Counts cannot exceed what fits into rest of data
+            ElementTemplate::attributeList attributes;
+            if (attributeCount > rReader.left() / COMPILED_ATTRIBUTE_SIZE)
+            {
+                return NULL;
+            }
+            attributes.resize(attributeCount);
+            for (auto& rAttribute : attributes)
+            {
+                if (!readCompiledAttribute(rReader, rAttribute))
+                {
+                    return NULL;
+                }
+            }
+            if (childCount > rReader.left() / COMPILED_ELEMENT_SIZE)
+            {
+                return NULL;
+            }
+
+            // Read children
+            ElementTemplate::childList children;
+            children.reserve(childCount);
+            for (uint32_t i = 0; i < childCount; i++)
+            {
+                std::unique_ptr<ElementTemplate> upChild = readCompiledElement(rReader, depth + 1);
+                if (upChild == NULL)
+                {
+                    return NULL;
+                }
+                children.push_back(std::move(upChild));
+            }
+            ElementTemplate::Kind elementKind = (ElementTemplate::Kind)kind;
+            return std::unique_ptr<ElementTemplate>(
+                new ElementTemplate(elementKind, ElementTemplate::getKindName(elementKind), std::move(attributes), std::move(children)));
+        }
+
+        // Copy xml element and children into template, returns NULL and fills error message if value of attribute does not fit its type
+        static std::unique_ptr<ElementTemplate> readXMLElement(tinyxml2::XMLElement const * xmlElement, uint depth, std::string& rErrorMessage)
+        {
+            std::string name = xmlElement->Value();
+            if (depth > TEMPLATE_MAX_DEPTH)
+            {
+                rErrorMessage = "Elements are nested too deep";
+                return NULL;
+            }
+
+            // Convert known attributes, others are not used by element parser
+            ElementTemplate::attributeList attributes;
+            for (tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FirstAttribute(); xmlAttribute != NULL; xmlAttribute = xmlAttribute->Next())
+            {
+                ElementTemplate::Attribute attribute;
+                if (!ElementTemplate::findAttributeId(xmlAttribute->Name(), attribute.id))
+                {
+                    continue;
+                }
+                if (!ElementTemplate::convertAttribute(xmlAttribute->Value(), attribute))
+                {
+                    rErrorMessage = "Attribute " + std::string(xmlAttribute->Name()) + " of " + name + " is no percentage: " + xmlAttribute->Value();
+                    return NULL;
+                }
+                attributes.push_back(std::move(attribute));
+            }
+
+            // Copy children
+            ElementTemplate::childList children;
+            for (tinyxml2::XMLElement const * xmlChild = xmlElement->FirstChildElement(); xmlChild != NULL; xmlChild = xmlChild->NextSiblingElement())
+            {
+                std::unique_ptr<ElementTemplate> upChild = readXMLElement(xmlChild, depth + 1, rErrorMessage);
+                if (upChild == NULL)
+                {
+                    return NULL;
+                }
+                children.push_back(std::move(upChild));
+            }
+            return std::unique_ptr<ElementTemplate>(
+                new ElementTemplate(ElementTemplate::findKind(name), name, std::move(attributes), std::move(children)));
+        }
+
+        // Collect values of string attributes of element and children, indices in order of first appearance
+        static void collectStrings(ElementTemplate const * pTemplate, std::map<std::string, uint32_t>& rIndices, std::vector<std::string const *>& rStrings)
+        {
+            for (const auto& rAttribute : pTemplate->getAttributes())
+            {
+                if (ElementTemplate::getAttributeType(rAttribute.id) == ElementTemplate::AttributeType::STRING
+                    && rIndices.find(rAttribute.text) == rIndices.end())
+                {
+                    rIndices[rAttribute.text] = (uint32_t)rStrings.size();
+                    rStrings.push_back(&rAttribute.text);
+                }
+            }
+            for (const auto& rupChild : pTemplate->getChildren())
+            {
+                collectStrings(rupChild.get(), rIndices, rStrings);
+            }
+        }
+
+        // Check kinds and ranges of values of element and children, returns false and fills error message at first problem
+        static bool checkCompilable(ElementTemplate const * pTemplate, std::string& rErrorMessage)
+        {
+            if (pTemplate->getKind() == ElementTemplate::Kind::UNKNOWN)
+            {
+                rErrorMessage = "Unknown element found: " + pTemplate->getName();
+                return false;
+            }
+            for (const auto& rAttribute : pTemplate->getAttributes())
+            {
+                if (!ElementTemplate::isInRange(rAttribute))
+                {
+                    rErrorMessage = "Attribute " + ElementTemplate::getAttributeName(rAttribute.id)
+                        + " of " + pTemplate->getName() + " not in range of 0% to 100%";
+                    return false;
+                }
+            }
+            for (const auto& rupChild : pTemplate->getChildren())
+            {
+                if (!checkCompilable(rupChild.get(), rErrorMessage))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Append number to data
+        static void write(uint32_t value, std::vector<uchar>& rData)
+        {
+            uchar bytes[sizeof(uint32_t)];
+            std::memcpy(bytes, &value, sizeof(uint32_t));
+            rData.insert(rData.end(), bytes, bytes + sizeof(uint32_t));
+        }
+
+        // Append element with children to data
+        static void writeCompiledElement(ElementTemplate const * pTemplate, const std::map<std::string, uint32_t>& rIndices, std::vector<uchar>& rData)
+        {
+            write((uint32_t)pTemplate->getKind(), rData);
+            write((uint32_t)pTemplate->getAttributes().size(), rData);
+            write((uint32_t)pTemplate->getChildren().size(), rData);
+            for (const auto& rAttribute : pTemplate->getAttributes())
+            {
+                uint32_t value = 0;
+                switch (ElementTemplate::getAttributeType(rAttribute.id))
+                {
+                case ElementTemplate::AttributeType::STRING:
+                    value = rIndices.at(rAttribute.text);
+                    break;
+                case ElementTemplate::AttributeType::PERCENTAGE:
+                    std::memcpy(&value, &rAttribute.percentage, sizeof(float));
+                    break;
+                case ElementTemplate::AttributeType::BOOL:
+                    value = rAttribute.flag ? 1 : 0;
+                    break;
+                }
+                write((uint32_t)rAttribute.id, rData);
+                write(value, rData);
+            }
+            for (const auto& rupChild : pTemplate->getChildren())
+            {
+                writeCompiledElement(rupChild.get(), rIndices, rData);
+            }
+        }
+
+        std::unique_ptr<ElementTemplate> parse(std::string filepath, std::string& rErrorMessage)
+        {
+            // Read file
+            FileView view = viewFile(filepath);
+            if (!view.isValid())
+            {
+                rErrorMessage = "File not found";
+                return NULL;
+            }
+
+            // Decide about format
+            if (isCompiled(view.getData(), view.getSize()))
+            {
+                return parseCompiled(view.getData(), view.getSize(), rErrorMessage);
+            }
+            return parseXML(view.getChars(), view.getSize(), rErrorMessage);
+        }
+
+        std::unique_ptr<ElementTemplate> parseXML(char const * pData, size_t size, std::string& rErrorMessage)
+        {
+            // Parse xml
+            tinyxml2::XMLDocument doc;
+            doc.Parse(pData, size);
+            if (doc.Error())
+            {
+                rErrorMessage = std::string("XML could not be parsed: ") + doc.ErrorName();
+                return NULL;
+            }
+            if (doc.FirstChildElement() == NULL)
+            {
+                rErrorMessage = "XML has no element";
+                return NULL;
+            }
+
+            // Copy into template
+            return readXMLElement(doc.FirstChildElement(), 0, rErrorMessage);
+        }
+
+        std::unique_ptr<ElementTemplate> parseCompiled(uchar const * pData, size_t size, std::string& rErrorMessage)
+        {
+            // Check header
+            CompiledReader reader;
+            reader.pData = pData;
+            reader.size = size;
+            reader.position = 0;
+            uint32_t magic, version, stringCount;
+            if (!reader.read(magic) || !reader.read(version) || !reader.read(stringCount)
+                || magic != COMPILED_TEMPLATE_MAGIC)
+            {
+                rErrorMessage = "Compiled template is damaged";
+                return NULL;
+            }
+            if (version != COMPILED_TEMPLATE_VERSION)
+            {
+                rErrorMessage = "Compiled template has unsupported version, compile it again";
+                return NULL;
+            }
+
+            // Read strings, each has at least its length
+            if (stringCount > reader.left() / sizeof(uint32_t))
+            {
+                rErrorMessage = "Compiled template is damaged";
+                return NULL;
+            }
+            reader.strings.reserve(stringCount);
+            for (uint32_t i = 0; i < stringCount; i++)
+            {
+                uint32_t length;
+                if (!reader.read(length) || length > reader.left())
+                {
+                    rErrorMessage = "Compiled template is damaged";
+                    return NULL;
+                }
+                reader.strings.push_back(std::string(reinterpret_cast<char const *>(pData + reader.position), length));
+                reader.position += length;
+            }
+
+            // Read elements
+            std::unique_ptr<ElementTemplate> upTemplate = readCompiledElement(reader, 0);
+            if (upTemplate == NULL || reader.position != size)
+            {
+                rErrorMessage = "Compiled template is damaged";
+                return NULL;
+            }
+            return upTemplate;
+        }
+
+        bool isCompiled(uchar const * pData, size_t size)
+        {
+            uint32_t magic;
+            if (size < sizeof(uint32_t))
+            {
+                return false;
+            }
+            std::memcpy(&magic, pData, sizeof(uint32_t));
+            return magic == COMPILED_TEMPLATE_MAGIC;
+        }
+
+        bool compile(ElementTemplate const * pTemplate, std::vector<uchar>& rData, std::string& rErrorMessage)
+        {
+            // Only known elements with values in range are stored
+            if (!checkCompilable(pTemplate, rErrorMessage))
+            {
+                return false;
+            }
+
+            // Intern strings
+            std::map<std::string, uint32_t> indices;
+            std::vector<std::string const *> strings;
+            collectStrings(pTemplate, indices, strings);
+
+            // Header and strings
+            rData.clear();
+            write(COMPILED_TEMPLATE_MAGIC, rData);
+            write(COMPILED_TEMPLATE_VERSION, rData);
+            write((uint32_t)strings.size(), rData);
+            for (std::string const * pString : strings)
+            {
+                write((uint32_t)pString->size(), rData);
+                rData.insert(rData.end(), pString->begin(), pString->end());
+            }
+
+            // Elements
+            writeCompiledElement(pTemplate, indices, rData);
+            return true;
+        }
+    }
+}
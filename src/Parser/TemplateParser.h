@@ -0,0 +1,42 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Parser for templates of layouts and bricks. Files are either xml or compiled
+// by the compiler tool, which is detected by their first bytes. Compiled files
+// hold each distinct string value once, followed by the elements in
+// depth-first order with kinds and attribute ids as numbers. Values of
+// percentages and bools are stored converted, strings by index. Does not
+// notify about errors, so it may be used on any thread.
+
+#ifndef TEMPLATE_PARSER_H_
+#define TEMPLATE_PARSER_H_
+
+#include "ElementTemplate.h"
+#include "Defines.h"
+
+namespace eyegui
+{
+    namespace template_parser
+    {
+        // Parsing of root element of file. Returns NULL and fills error message if file cannot be read or parsed
+        std::unique_ptr<ElementTemplate> parse(std::string filepath, std::string& rErrorMessage);
+
+        // Parsing of xml in memory
+        std::unique_ptr<ElementTemplate> parseXML(char const * pData, size_t size, std::string& rErrorMessage);
+
+        // Parsing of compiled template in memory
+        std::unique_ptr<ElementTemplate> parseCompiled(uchar const * pData, size_t size, std::string& rErrorMessage);
+
+        // Check whether data in memory is a compiled template
+        bool isCompiled(uchar const * pData, size_t size);
+
+        // Compile template into data. Returns false and fills error message if an element
+        // is unknown or a value is out of range
+        bool compile(ElementTemplate const * pTemplate, std::vector<uchar>& rData, std::string& rErrorMessage);
+    }
+}
+
+#endif // TEMPLATE_PARSER_H_
@@ -7,9 +7,62 @@
 
 #include "PathBuilder.h"
 
+#include "AssetArchive.h"
+
+#include <sys/stat.h>
+
 namespace eyegui
 {
     PathBuilder* PathBuilder::pInstance = NULL;
 
     std::string PathBuilder::rootFilepath = "";
+
+    std::shared_ptr<AssetArchive const> PathBuilder::spArchive = NULL;
+
+    std::mutex PathBuilder::archiveMutex;
+
+    FileView PathBuilder::buildFileView(std::string filepath)
+    {
+        // Try archive first
+        FileView view;
+        std::shared_ptr<AssetArchive const> spCurrentArchive = getArchive();
+        if (spCurrentArchive != NULL && spCurrentArchive->find(filepath, view))
+        {
+            return view;
+        }
+
+        // Fallback to loose file
+        std::shared_ptr<MappedFile const> spMapping = std::make_shared<MappedFile>(buildFullFilepath(filepath));
+        if (spMapping->isMapped())
+        {
+            view = FileView(spMapping, spMapping->getData(), spMapping->getSize());
+        }
+        return view;
+    }
+
+    bool PathBuilder::getFileStatus(std::string filepath, unsigned long long& rSize, long long& rTime)
+    {
+        // Try archive first
+        std::shared_ptr<AssetArchive const> spCurrentArchive = getArchive();
+        if (spCurrentArchive != NULL && spCurrentArchive->getFileStatus(filepath, rSize, rTime))
+        {
+            return true;
+        }
+
+        // Fallback to loose file
+        struct stat status;
+        if (stat(buildFullFilepath(filepath).c_str(), &status) != 0)
+        {
+            return false;
+        }
+        rSize = (unsigned long long)status.st_size;
+        rTime = (long long)status.st_mtime;
+        return true;
+    }
+
+    std::shared_ptr<AssetArchive const> PathBuilder::getArchive()
+    {
+        std::lock_guard<std::mutex> lock(archiveMutex);
+        return spArchive;
+    }
 }
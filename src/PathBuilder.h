@@ -6,18 +6,27 @@
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Helps to build full path out of relative filepath and root filepath. Root
 // filepath may only be set by eyeGUI.cpp function "setRootFilepath". Everything
-// else would be dangerous.
+// else would be dangerous. Content of files is viewed inside of the asset
+// archive when one is set and contains the file, else the loose file below
+// root filepath is used.
 
 #ifndef PATH_BUILDER_H_
 #define PATH_BUILDER_H_
 
+#include "FileView.h"
+
 #include <string>
+#include <mutex>
 
 // Defines for easier use
 #define buildPath eyegui::PathBuilder::buildFullFilepath
+#define viewFile eyegui::PathBuilder::buildFileView
 
 namespace eyegui
 {
+    // Forward declaration
+    class AssetArchive;
+
     class PathBuilder
     {
     public:
@@ -25,12 +34,21 @@ namespace eyegui
         // Only friend may set root filepath
         friend void setRootFilepath(std::string rootFilepath);
 
+        // Only friend may set asset archive
+        friend void setArchiveFilepath(std::string archiveFilepath);
+
         // Build full filepath
         static std::string buildFullFilepath(std::string filepath)
         {
             return getInstance()->internalBuildFullFilepath(filepath);
         }
 
+        // Build view of file content. May be called from any thread
+        static FileView buildFileView(std::string filepath);
+
+        // Get size and modification time of file, returns false if not found. May be called from any thread
+        static bool getFileStatus(std::string filepath, unsigned long long& rSize, long long& rTime);
+
     private:
 
         // Check for instance existence
@@ -59,8 +77,15 @@ namespace eyegui
         // The pointer to the single instance
         static PathBuilder* pInstance;
 
+        // Get asset archive, may be NULL
+        static std::shared_ptr<AssetArchive const> getArchive();
+
         // Filepath
         static std::string rootFilepath;
+
+        // Asset archive, pointer guarded by mutex
+        static std::shared_ptr<AssetArchive const> spArchive;
+        static std::mutex archiveMutex;
     };
 }
 
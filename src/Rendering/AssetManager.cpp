@@ -19,15 +19,24 @@
 #include "Font/AtlasFont.h"
 #include "Font/EmptyFont.h"
 #include "PathBuilder.h"
+#include "Parser/TemplateParser.h"
 
 #include <algorithm>
 
 namespace eyegui
 {
-    AssetManager::AssetManager(GUI const * pGUI)
+    AssetManager::AssetManager(GUI const * pGUI, RenderBackend* pBackend, std::string fontAtlasCacheDirectory)
     {
         // Save members
         mpGUI = pGUI;
+        mpBackend = pBackend;
+        mupIconAtlas = std::unique_ptr<IconAtlas>(new IconAtlas(mpBackend));
+        mupDecodingPool = std::unique_ptr<ThreadPool>(new ThreadPool());
+        mupRasterizationPool = std::unique_ptr<ThreadPool>(new ThreadPool());
+        mTextureMemoryBudget = TEXTURE_MEMORY_BUDGET;
+        mResidentTextureBytes = 0;
+        mDistanceFieldFonts = false;
+        mMaxVectorGraphicsSize = std::min((uint)std::max(mpBackend->getMaxTextureSize(), 1), VECTOR_GRAPHICS_MAX_SIZE);
 
         // Initialize FreeType Library
         if (FT_Init_FreeType(&mFreeTypeLibrary))
@@ -36,6 +45,17 @@ namespace eyegui
                 OperationNotifier::Operation::RUNTIME,
                 "Could not initialize FreeType Library");
         }
+
+        // Cache of font atlases, used by fonts from start on
+        if (!fontAtlasCacheDirectory.empty())
+        {
+            mupFontAtlasCache = std::unique_ptr<FontAtlasCache>(new FontAtlasCache(fontAtlasCacheDirectory));
+            if (!mupFontAtlasCache->isUsable())
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Directory of font atlas cache could not be created", fontAtlasCacheDirectory);
+                mupFontAtlasCache = NULL;
+            }
+        }
     }
 
     AssetManager::~AssetManager()
@@ -54,7 +74,7 @@ namespace eyegui
 
         // Fetch shader and mesh
         Shader* pShader = fetchShader(shader);
-        Mesh* pMesh = fetchMesh(mesh);
+        Mesh const * pMesh = fetchMesh(mesh);
 
         // Search in map for render item
         if (mRenderItems.find(shader) != mRenderItems.end())
@@ -67,7 +87,7 @@ namespace eyegui
             else
             {
                 // Mesh not registered for this shader
-                upRenderItem = std::unique_ptr<RenderItem>(new RenderItem(pShader, pMesh));
+                upRenderItem = std::unique_ptr<RenderItem>(new RenderItem(mpBackend, pShader, pMesh));
                 pRenderItem = upRenderItem.get();
                 mRenderItems[shader][mesh] = std::move(upRenderItem);
             }
@@ -75,7 +95,7 @@ namespace eyegui
         else
         {
             // Shader not registered
-            upRenderItem = std::unique_ptr<RenderItem>(new RenderItem(pShader, pMesh));
+            upRenderItem = std::unique_ptr<RenderItem>(new RenderItem(mpBackend, pShader, pMesh));
             pRenderItem = upRenderItem.get();
             std::map<meshes::Type, std::unique_ptr<RenderItem> > innerMap;
             innerMap[mesh] = std::move(upRenderItem);
@@ -87,54 +107,290 @@ namespace eyegui
 
     Texture const * AssetManager::fetchTexture(std::string filepath)
     {
-        // Search in map for texture and create if needed
-        std::unique_ptr<Texture>& rupTexture = mTextures[filepath];
-        Texture* pTexture = rupTexture.get();
+        // Search in map for texture
+        auto it = mTextures.find(filepath);
+        if (it != mTextures.end())
+        {
+            touchTexture(it->second);
+            return it->second.upTexture.get();
+        }
 
-        if (pTexture == NULL)
+        // Create texture
+        std::unique_ptr<Texture> upTexture;
+
+        // Check for empty string
+        if (filepath == "")
         {
-            // Check for empty string
-            if (filepath == "")
+            upTexture = std::unique_ptr<Texture>(new VectorTexture(mpBackend, &graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
+        }
+        else
+        {
+            // Determine image type
+            std::string delimiter = ".";
+            std::string input = filepath;
+            size_t pos = 0;
+            std::string token;
+            while ((pos = input.find(delimiter)) != std::string::npos)
+            {
+                token = input.substr(0, pos);
+                input.erase(0, pos + delimiter.length());
+            }
+
+            // File format case is not relevant
+            std::transform(input.begin(), input.end(), input.begin(), ::tolower);
+
+            // Check token
+            if (input.compare("png") == 0)
             {
-                rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
+                upTexture = std::unique_ptr<Texture>(new PixelTexture(mpBackend, filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
+            }
+            else if (input.compare("svg") == 0)
+            {
+                upTexture = std::unique_ptr<Texture>(new VectorTexture(mpBackend, filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
             }
             else
             {
-                // Determine image type
-                std::string delimiter = ".";
-                std::string input = filepath;
-                size_t pos = 0;
-                std::string token;
-                while ((pos = input.find(delimiter)) != std::string::npos)
-                {
-                    token = input.substr(0, pos);
-                    input.erase(0, pos + delimiter.length());
-                }
+                upTexture = std::unique_ptr<Texture>(new VectorTexture(mpBackend, &graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
+            }
+        }
 
-                // File format case is not relevant
-                std::transform(input.begin(), input.end(), input.begin(), ::tolower);
+        return insertTexture(filepath, std::move(upTexture));
+    }
 
-                // Check token
-                if (input.compare("png") == 0)
-                {
-                    rupTexture = std::unique_ptr<Texture>(new PixelTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
-                }
-                else if (input.compare("svg") == 0)
-                {
-                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
-                }
-                else
+    Texture const * AssetManager::fetchTexture(std::string filepath, const Image& rImage)
+    {
+        // Placeholder may wait for the same image
+        auto placeholderIt = mPlaceholders.find(filepath);
+        if (placeholderIt != mPlaceholders.end())
+        {
+            replacePlaceholder(placeholderIt, rImage);
+        }
+
+        // Search in map for texture and create from image if needed
+        auto it = mTextures.find(filepath);
+        if (it != mTextures.end())
+        {
+            touchTexture(it->second);
+            return it->second.upTexture.get();
+        }
+        return insertTexture(
+            filepath,
+            std::unique_ptr<Texture>(new PixelTexture(mpBackend, rImage, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get())));
+    }
+
+    Texture const * AssetManager::requestTexture(std::string filepath)
+    {
+        // Vector graphics would be rasterized at intrinsic size, which is used by no element
+        if (checkFileNameExtension(filepath, "svg"))
+        {
+            return fetchTexture(graphics::Type::PLACEHOLDER);
+        }
+
+        // Only images on disk are decoded in background, others are created immediately
+        if (mTextures.find(filepath) == mTextures.end()
+            && !checkFileNameExtension(filepath, "png"))
+        {
+            return fetchTexture(filepath);
+        }
+
+        return requestTexture(filepath, filepath, 0);
+    }
+
+    uint AssetManager::replaceDecodedTextures(uint budget)
+    {
+        uint count = 0;
+        uint bytes = 0;
+        while (count == 0 || bytes < budget)
+        {
+            // Take next decoded image
+            DecodedImage decoded;
+            {
+                std::lock_guard<std::mutex> lock(mDecodedImagesMutex);
+                if (mDecodedImages.empty())
                 {
-                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
+                    break;
                 }
+                decoded = std::move(mDecodedImages.front());
+                mDecodedImages.pop_front();
             }
-            pTexture = rupTexture.get();
-            mTextures[filepath] = std::move(rupTexture);
+
+            // Placeholder may have been replaced by image decoded elsewhere or evicted
+            auto it = mPlaceholders.find(decoded.key);
+            if (it == mPlaceholders.end())
+            {
+                continue;
+            }
+
+            // Tell about failure now, on thread of GUI
+            if (!decoded.success)
+            {
+                throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or not decodable", decoded.filepath);
+            }
+
+            // Upload image into texture
+            replacePlaceholder(it, decoded.image);
+            bytes += (uint)decoded.image.getByteCount();
+            count++;
         }
+        return count;
+    }
 
+    Texture const * AssetManager::acquireTexture(std::string filepath)
+    {
+        Texture const * pTexture = fetchTexture(filepath);
+        addReference(filepath);
+        return pTexture;
+    }
+
+    Texture const * AssetManager::acquireTexture(std::string filepath, uint size)
+    {
+        // Each size is a texture of its own
+        std::string key = filepath + "@" + std::to_string(size);
+        Texture const * pTexture = requestTexture(key, filepath, size);
+        addReference(key);
         return pTexture;
     }
 
+    uint AssetManager::getVectorGraphicsSize(int width, int height) const
+    {
+        // Power of two, not smaller than longer side
+        uint size = VECTOR_GRAPHICS_MIN_SIZE;
+        while (size < (uint)std::max(width, height) && size < mMaxVectorGraphicsSize)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+    void AssetManager::releaseTexture(Texture const * pTexture)
+    {
+        // Graphics are not counted, so they are not found
+        auto it = mTextureEntries.find(pTexture);
+        if (it == mTextureEntries.end())
+        {
+            return;
+        }
+        TextureEntry& rEntry = it->second->second;
+        if (rEntry.references > 0)
+        {
+            rEntry.references--;
+            if (rEntry.references == 0)
+            {
+                rEntry.unusedPosition = mUnusedTextures.insert(mUnusedTextures.end(), it->second->first);
+            }
+        }
+    }
+
+    void AssetManager::setTextureMemoryBudget(uint budget)
+    {
+        mTextureMemoryBudget = budget;
+    }
+
+    uint AssetManager::getResidentTextureBytes() const
+    {
+        return mResidentTextureBytes;
+    }
+
+    void AssetManager::evictTextures()
+    {
+        // Delete least recently used textures without references until budget is met
+        while (mResidentTextureBytes > mTextureMemoryBudget && !mUnusedTextures.empty())
+        {
+            auto it = mTextures.find(mUnusedTextures.front());
+            mResidentTextureBytes -= it->second.upTexture->getByteCount();
+            mPlaceholders.erase(it->first);
+            mTextureEntries.erase(it->second.upTexture.get());
+            mTextures.erase(it);
+            mUnusedTextures.pop_front();
+        }
+    }
+
+    void AssetManager::setImageCacheDirectory(std::string directory)
+    {
+        std::shared_ptr<ImageCache const> spImageCache;
+        if (!directory.empty())
+        {
+            spImageCache = std::make_shared<ImageCache>(directory);
+            if (!spImageCache->isUsable())
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Directory of image cache could not be created", directory);
+                spImageCache = NULL;
+            }
+        }
+
+        // Tasks already running keep their image cache
+        std::lock_guard<std::mutex> lock(mImageCacheMutex);
+        mspImageCache = spImageCache;
+    }
+
+    bool AssetManager::decodeImage(std::string filepath, uint size, Image& rImage)
+    {
+        std::shared_ptr<ImageCache const> spImageCache;
+        {
+            std::lock_guard<std::mutex> lock(mImageCacheMutex);
+            spImageCache = mspImageCache;
+        }
+
+        // Try image cache first
+        if (spImageCache != NULL && spImageCache->load(filepath, size, true, rImage))
+        {
+            return true;
+        }
+
+        // Decode file and flip it here if decoder has not, so thread of GUI uploads it as it is
+        if (!image_decoding::decode(filepath, rImage, size))
+        {
+            return false;
+        }
+        if (!rImage.flipped)
+        {
+            image_decoding::flipImage(rImage);
+        }
+        if (spImageCache != NULL)
+        {
+            spImageCache->store(filepath, size, rImage);
+        }
+        return true;
+    }
+
+    ElementTemplate const * AssetManager::fetchBrickTemplate(std::string filepath, std::string& rErrorMessage)
+    {
+        // Status of file decides whether cached template is still valid
+        unsigned long long size;
+        long long time;
+        if (!PathBuilder::getFileStatus(filepath, size, time))
+        {
+            mBrickTemplates.erase(filepath);
+            rErrorMessage = "File not found";
+            return NULL;
+        }
+
+        // Use cached template
+        auto it = mBrickTemplates.find(filepath);
+        if (it != mBrickTemplates.end() && it->second.size == size && it->second.time == time)
+        {
+            return it->second.upTemplate.get();
+        }
+
+        // Parse file, failures are not cached
+        std::unique_ptr<ElementTemplate> upTemplate = template_parser::parse(filepath, rErrorMessage);
+        if (upTemplate == NULL)
+        {
+            mBrickTemplates.erase(filepath);
+            return NULL;
+        }
+        BrickTemplateEntry& rEntry = mBrickTemplates[filepath];
+        rEntry.upTemplate = std::move(upTemplate);
+        rEntry.size = size;
+        rEntry.time = time;
+        return rEntry.upTemplate.get();
+    }
+
+    void AssetManager::updateIconAtlas()
+    {
+        mupIconAtlas->generateMipmaps();
+    }
+
     Texture const * AssetManager::fetchTexture(graphics::Type graphic)
     {
         // Search in map for graphic and create if needed
@@ -146,10 +402,13 @@ namespace eyegui
             switch (graphic)
             {
             case graphics::Type::CIRCLE:
-                rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::circleGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
+                rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpBackend, &graphics::circleGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
                 break;
             case graphics::Type::NOT_FOUND:
-                rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
+                rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpBackend, &graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
+                break;
+            case graphics::Type::PLACEHOLDER:
+                rupTexture = std::unique_ptr<Texture>(new AsyncTexture(mpBackend, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
                 break;
             }
             pTexture = rupTexture.get();
@@ -173,7 +432,7 @@ namespace eyegui
             {
                 // Empty font
                 rupFont = std::unique_ptr<Font>(
-                    new EmptyFont());
+                    new EmptyFont(mpBackend));
 
                 // Tell the user about this
                 throwWarning(
@@ -188,14 +447,18 @@ namespace eyegui
                     throwError(OperationNotifier::Operation::FONT_LOADING, "Font file has unknown format", filepath);
                 }
 
-                // Load font to FreeType face
+                // Load font to FreeType face, which reads from view of file until it is deleted
+                FileView view = viewFile(filepath);
                 std::unique_ptr<FT_Face> upFace = std::unique_ptr<FT_Face>(new FT_Face);
-                if (FT_New_Face(mFreeTypeLibrary, buildPath(filepath).c_str(), 0, upFace.get()))
+                if (!view.isValid() || FT_New_Memory_Face(mFreeTypeLibrary, view.getData(), (FT_Long)view.getSize(), 0, upFace.get()))
                 {
                     throwError(OperationNotifier::Operation::FONT_LOADING, "Failed to load font with FreeType Library", filepath);
                 }
                 else
                 {
+                    // Keep file as long as font exists
+                    mFontFiles[filepath] = view;
+
                     // Decide character set
                     std::set<char16_t> characters = charsets::BASIC;
                     switch (mpGUI->getCharacterSet())
@@ -211,10 +474,17 @@ namespace eyegui
                     // Give face to a font object (it will delete it in the end)
                     rupFont = std::unique_ptr<Font>(
                         new AtlasFont(
+                            mpBackend,
+                            mupRasterizationPool.get(),
+                            mupFontAtlasCache.get(),
                             filepath,
+                            mFreeTypeLibrary,
+                            view.getData(),
+                            view.getSize(),
                             std::move(upFace),
                             characters,
-                            mpGUI->getWindowHeight()));
+                            mpGUI->getWindowHeight(),
+                            mDistanceFieldFonts));
                 }
             }
 
@@ -236,6 +506,42 @@ namespace eyegui
         }
     }
 
+    FontAtlasStatistics AssetManager::getFontAtlasStatistics() const
+    {
+        FontAtlasStatistics statistics;
+        for (const auto& rPair : mFonts)
+        {
+            uint atlasPixels = 0;
+            uint glyphPixels = 0;
+            rPair.second->getAtlasPixelCounts(atlasPixels, glyphPixels);
+            statistics.atlasBytes += atlasPixels;
+            statistics.glyphBytes += glyphPixels;
+        }
+        return statistics;
+    }
+
+    bool AssetManager::uploadGlyphs()
+    {
+        bool outdated = false;
+        for (auto& rPair : mFonts)
+        {
+            if (rPair.second->uploadGlyphs())
+            {
+                outdated = true;
+            }
+        }
+        return outdated;
+    }
+
+    void AssetManager::setDistanceFieldFonts(bool distanceField)
+    {
+        mDistanceFieldFonts = distanceField;
+        for (auto& rPair : mFonts)
+        {
+            rPair.second->setDistanceField(distanceField, mpGUI->getWindowHeight());
+        }
+    }
+
     std::unique_ptr<TextFlow> AssetManager::AssetManager::createTextFlow(
         FontSize fontSize,
         TextFlowAlignment alignment,
@@ -246,14 +552,92 @@ namespace eyegui
             std::unique_ptr<TextFlow>(
                 new TextFlow(
                     mpGUI,
+                    mpBackend,
                     mpGUI->getDefaultFont(),
                     fontSize,
                     alignment,
                     verticalAlignment,
                     fetchShader(shaders::Type::FONT),
+                    fetchShader(shaders::Type::DISTANCE_FIELD_FONT),
                     content)));
     }
 
+    Texture const * AssetManager::insertTexture(std::string filepath, std::unique_ptr<Texture> upTexture)
+    {
+        // New texture is not used yet
+        auto it = mTextures.insert(std::make_pair(filepath, TextureEntry())).first;
+        TextureEntry& rEntry = it->second;
+        mTextureEntries.erase(rEntry.upTexture.get());
+        rEntry.upTexture = std::move(upTexture);
+        mTextureEntries[rEntry.upTexture.get()] = it;
+        rEntry.references = 0;
+        rEntry.unusedPosition = mUnusedTextures.insert(mUnusedTextures.end(), filepath);
+        mResidentTextureBytes += rEntry.upTexture->getByteCount();
+        return rEntry.upTexture.get();
+    }
+
+    Texture const * AssetManager::requestTexture(std::string key, std::string filepath, uint size)
+    {
+        // Already loaded or requested
+        auto it = mTextures.find(key);
+        if (it != mTextures.end())
+        {
+            touchTexture(it->second);
+            return it->second.upTexture.get();
+        }
+
+        // Create placeholder
+        std::unique_ptr<AsyncTexture> upTexture = std::unique_ptr<AsyncTexture>(
+            new AsyncTexture(mpBackend, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mupIconAtlas.get()));
+        mPlaceholders[key] = upTexture.get();
+
+        // Decode image in background
+        mupDecodingPool->enqueue([this, key, filepath, size]()
+        {
+            DecodedImage decoded;
+            decoded.key = key;
+            decoded.filepath = filepath;
+            decoded.success = decodeImage(filepath, size, decoded.image);
+            if (!decoded.success)
+            {
+                image_decoding::decodeVectorGraphics(graphics::notFoundGraphics, decoded.image);
+            }
+
+            std::lock_guard<std::mutex> lock(mDecodedImagesMutex);
+            mDecodedImages.push_back(std::move(decoded));
+        });
+
+        return insertTexture(key, std::move(upTexture));
+    }
+
+    void AssetManager::addReference(std::string key)
+    {
+        // Texture is no longer unused
+        TextureEntry& rEntry = mTextures[key];
+        if (rEntry.references == 0)
+        {
+            mUnusedTextures.erase(rEntry.unusedPosition);
+        }
+        rEntry.references++;
+    }
+
+    void AssetManager::touchTexture(TextureEntry& rEntry)
+    {
+        // Move unused texture to end of list, as it has been used most recently
+        if (rEntry.references == 0)
+        {
+            mUnusedTextures.splice(mUnusedTextures.end(), mUnusedTextures, rEntry.unusedPosition);
+        }
+    }
+
+    void AssetManager::replacePlaceholder(std::map<std::string, AsyncTexture*>::iterator it, const Image& rImage)
+    {
+        mResidentTextureBytes -= it->second->getByteCount();
+        it->second->replace(rImage);
+        mResidentTextureBytes += it->second->getByteCount();
+        mPlaceholders.erase(it);
+    }
+
     Shader* AssetManager::fetchShader(shaders::Type shader)
     {
         // Search in map for shader and create if needed
@@ -265,31 +649,28 @@ namespace eyegui
             switch (shader)
             {
             case shaders::Type::COLOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pColorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, shaders::pStaticVertexShader, shaders::pColorFragmentShader));
                 break;
             case shaders::Type::CIRCLE:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, shaders::pStaticVertexShader, shaders::pCircleFragmentShader));
                 break;
             case shaders::Type::SEPARATOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSeparatorFragmentShader));
-                break;
             case shaders::Type::BLOCK:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBlockFragmentShader));
-                break;
             case shaders::Type::PICTURE:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pPictureFragmentShader));
-                break;
             case shaders::Type::CIRCLE_BUTTON:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleButtonFragmentShader));
-                break;
             case shaders::Type::BOX_BUTTON:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxButtonFragmentShader));
-                break;
             case shaders::Type::SENSOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSensorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, composeVertexShader(false).c_str(), composeFragmentShader(shader, false).c_str()));
+                rupShader->setUniformBlockBinding(shaders::pQuadBlockName, shaders::QUAD_BLOCK_BINDING);
                 break;
             case shaders::Type::FONT:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pFontFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, shaders::pStaticVertexShader, shaders::pFontFragmentShader));
+                break;
+            case shaders::Type::DISTANCE_FIELD_FONT:
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, shaders::pStaticVertexShader, shaders::pDistanceFieldFontFragmentShader));
+                break;
+            case shaders::Type::LAYER:
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, shaders::pStaticVertexShader, shaders::pLayerFragmentShader));
                 break;
             }
             pShader = rupShader.get();
@@ -299,7 +680,35 @@ namespace eyegui
         return pShader;
     }
 
-    Mesh* AssetManager::fetchMesh(meshes::Type mesh)
+    Shader const * AssetManager::fetchInstancedShader(shaders::Type shader)
+    {
+        // Search in map for shader and create if needed
+        std::unique_ptr<Shader>& rupShader = mInstancedShaders[shader];
+        Shader* pShader = rupShader.get();
+
+        if (pShader == NULL)
+        {
+            switch (shader)
+            {
+            case shaders::Type::SEPARATOR:
+            case shaders::Type::BLOCK:
+            case shaders::Type::PICTURE:
+            case shaders::Type::CIRCLE_BUTTON:
+            case shaders::Type::BOX_BUTTON:
+            case shaders::Type::SENSOR:
+                rupShader = std::unique_ptr<Shader>(new Shader(mpBackend, composeVertexShader(true).c_str(), composeFragmentShader(shader, true).c_str()));
+                break;
+            default:
+                // No instanced variant available
+                return NULL;
+            }
+            pShader = rupShader.get();
+        }
+
+        return pShader;
+    }
+
+    Mesh const * AssetManager::fetchMesh(meshes::Type mesh)
     {
         // Search in map for mesh and create if needed
         std::unique_ptr<Mesh>& rupMesh = mMeshes[mesh];
@@ -310,10 +719,10 @@ namespace eyegui
             switch (mesh)
             {
             case meshes::Type::QUAD:
-                rupMesh = std::unique_ptr<Mesh>(new Mesh(&meshes::quadVertices, &meshes::quadTextureCoordinates));
+                rupMesh = std::unique_ptr<Mesh>(new Mesh(mpBackend, &meshes::quadVertices, &meshes::quadTextureCoordinates));
                 break;
             case meshes::Type::LINE:
-                rupMesh = std::unique_ptr<Mesh>(new Mesh(&meshes::lineVertices, &meshes::lineTextureCoordinates));
+                rupMesh = std::unique_ptr<Mesh>(new Mesh(mpBackend, &meshes::lineVertices, &meshes::lineTextureCoordinates));
                 break;
             }
             pMesh = rupMesh.get();
@@ -322,4 +731,68 @@ namespace eyegui
 
         return pMesh;
     }
+
+    std::string AssetManager::composeVertexShader(bool instanced) const
+    {
+        if (instanced)
+        {
+            return shaders::pInstancedVertexShader;
+        }
+        return std::string(shaders::pShaderVersion) + shaders::pQuadBlockDeclarations + shaders::pQuadBlockVertexShaderBody;
+    }
+
+    std::string AssetManager::composeFragmentShader(shaders::Type shader, bool instanced) const
+    {
+        // Choose body of shader
+        char const * pBody = NULL;
+        bool usesIcon = false;
+        switch (shader)
+        {
+        case shaders::Type::SEPARATOR:
+            pBody = shaders::pSeparatorFragmentShaderBody;
+            break;
+        case shaders::Type::BLOCK:
+            pBody = shaders::pBlockFragmentShaderBody;
+            break;
+        case shaders::Type::PICTURE:
+            pBody = shaders::pPictureFragmentShaderBody;
+            usesIcon = true;
+            break;
+        case shaders::Type::CIRCLE_BUTTON:
+            pBody = shaders::pCircleButtonFragmentShaderBody;
+            usesIcon = true;
+            break;
+        case shaders::Type::BOX_BUTTON:
+            pBody = shaders::pBoxButtonFragmentShaderBody;
+            usesIcon = true;
+            break;
+        case shaders::Type::SENSOR:
+            pBody = shaders::pSensorFragmentShaderBody;
+            usesIcon = true;
+            break;
+        default:
+            throwError(OperationNotifier::Operation::BUG, "Shader is not composed of declarations and body");
+            return "";
+        }
+
+        // Values come either from instance attributes or from uniform block
+        std::string source = shaders::pShaderVersion;
+        if (instanced)
+        {
+            source += shaders::pInstancedFragmentShaderDeclarations;
+            source += shaders::pIconFetchDeclarations;
+        }
+        else
+        {
+            source += shaders::pQuadBlockDeclarations;
+            if (usesIcon)
+            {
+                source += shaders::pIconFragmentShaderDeclarations;
+                source += shaders::pIconFetchDeclarations;
+            }
+        }
+        source += shaders::pQuadFragmentShaderAliases;
+        source += pBody;
+        return source;
+    }
 }
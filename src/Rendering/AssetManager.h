@@ -14,22 +14,35 @@
 #include "Shader.h"
 #include "Mesh.h"
 #include "Textures/Texture.h"
+#include "Textures/Image.h"
 #include "RenderItem.h"
 #include "Font/Font.h"
 #include "Font/TextFlow.h"
+#include "Backend/RenderBackend.h"
+#include "Textures/AsyncTexture.h"
+#include "Textures/IconAtlas.h"
+#include "Textures/ImageCache.h"
+#include "Font/FontAtlasCache.h"
+#include "ThreadPool.h"
+#include "FileView.h"
+#include "Parser/ElementTemplate.h"
 
 #include "externals/FreeType2/include/ft2build.h"
 #include FT_FREETYPE_H
 
 #include <memory>
 #include <map>
+#include <unordered_map>
+#include <deque>
+#include <list>
+#include <mutex>
 
 namespace eyegui
 {
     // Available assets
-    namespace shaders { enum class Type { COLOR, CIRCLE, SEPARATOR, BLOCK, PICTURE, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, FONT }; }
+    namespace shaders { enum class Type { COLOR, CIRCLE, SEPARATOR, BLOCK, PICTURE, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, FONT, DISTANCE_FIELD_FONT, LAYER }; }
     namespace meshes { enum class Type { QUAD, LINE }; }
-    namespace graphics { enum class Type { CIRCLE, NOT_FOUND }; }
+    namespace graphics { enum class Type { CIRCLE, NOT_FOUND, PLACEHOLDER }; }
 
     // Forward declaration
     class GUI;
@@ -38,8 +51,8 @@ namespace eyegui
     {
     public:
 
-        // Constructor
-        AssetManager(GUI const * pGUI);
+        // Constructor. Atlases of fonts are kept in directory across runs, unless it is empty
+        AssetManager(GUI const * pGUI, RenderBackend* pBackend, std::string fontAtlasCacheDirectory);
 
         // Destructor
         virtual ~AssetManager();
@@ -47,18 +60,85 @@ namespace eyegui
         // Fetch render item
         RenderItem const * fetchRenderItem(shaders::Type shader, meshes::Type mesh);
 
+        // Fetch variant of shader which reads per instance attributes, available
+        // for the shaders of elements (NULL for others)
+        Shader const * fetchInstancedShader(shaders::Type shader);
+
+        // Fetch mesh
+        Mesh const * fetchMesh(meshes::Type mesh);
+
         // Fetch texture
         Texture const * fetchTexture(std::string filepath);
 
-        // Fetch graphics
+        // Fetch texture, created from image decoded before if not yet loaded
+        Texture const * fetchTexture(std::string filepath, const Image& rImage);
+
+        // Request texture, decoded in background if not yet loaded. Returns placeholder
+        // meanwhile, which is replaced later. Texture can be fetched as usual afterwards.
+        // Vector graphics are rasterized per size when acquired, so nothing is requested for them
+        Texture const * requestTexture(std::string filepath);
+
+        // Replace placeholders with images decoded in background until budget
+        // in bytes is spent. At least one is replaced. Returns count of replaced
+        uint replaceDecodedTextures(uint budget);
+
+        // Fetch texture and count reference to it. Textures with references are never evicted
+        Texture const * acquireTexture(std::string filepath);
+
+        // Acquire vector graphics rasterized with longer side at size in pixels. Texture is
+        // placeholder until rasterized in background, which is told by isLoaded of texture
+        Texture const * acquireTexture(std::string filepath, uint size);
+
+        // Get size at which vector graphics are rasterized for element drawn with width and
+        // height in pixels. Sizes are powers of two, so many elements share one texture
+        uint getVectorGraphicsSize(int width, int height) const;
+
+        // Remove reference to texture, graphics are ignored
+        void releaseTexture(Texture const * pTexture);
+
+        // Set budget for memory of textures from files in bytes
+        void setTextureMemoryBudget(uint budget);
+
+        // Get bytes of pixel data of textures from files (without mipmaps)
+        uint getResidentTextureBytes() const;
+
+        // Delete least recently used textures without references while memory is above budget.
+        // They are loaded again when fetched
+        void evictTextures();
+
+        // Set directory where decoded images are kept across runs. Empty string disables it
+        void setImageCacheDirectory(std::string directory);
+
+        // Decode image of file with rows flipped for upload, using the image cache when set.
+        // Size is used for vector graphics only. May be called from any thread
+        bool decodeImage(std::string filepath, uint size, Image& rImage);
+
+        // Generate mipmaps of icon atlas where icons were added, called before drawing
+        void updateIconAtlas();
+
+        // Fetch graphics. Placeholder is transparent and never loaded
         Texture const * fetchTexture(graphics::Type graphic);
 
+        // Fetch template of brick, parsed again when size or modification time of file changed.
+        // Returns NULL and fills error message if file cannot be read or parsed
+        ElementTemplate const * fetchBrickTemplate(std::string filepath, std::string& rErrorMessage);
+
         // Fetch font
         Font const * fetchFont(std::string filepath);
 
         // Resize font atlases (should be called by GUI only)
         void resizeFontAtlases();
 
+        // Set whether fonts are drawn from distance fields (should be called by GUI only)
+        void setDistanceFieldFonts(bool distanceField);
+
+        // Get memory of atlases of all fonts
+        FontAtlasStatistics getFontAtlasStatistics() const;
+
+        // Upload glyphs of fonts rasterized on first use. Returns whether glyphs
+        // were replaced or moved, so text flows must calculate their meshes again
+        bool uploadGlyphs();
+
         // Create text flow and return it as unique pointer
         std::unique_ptr<TextFlow> createTextFlow(
             FontSize fontSize,
@@ -68,21 +148,83 @@ namespace eyegui
 
     private:
 
+        // Image decoded in background
+        struct DecodedImage
+        {
+            std::string key; // Of texture in map
+            std::string filepath;
+            Image image;
+            bool success; // Otherwise image shows that nothing was found
+        };
+
+        // Texture from file with count of references
+        struct TextureEntry
+        {
+            std::unique_ptr<Texture> upTexture;
+            uint references;
+            std::list<std::string>::iterator unusedPosition; // Valid without references
+        };
+
+        // Parsed brick with status of its file
+        struct BrickTemplateEntry
+        {
+            std::unique_ptr<ElementTemplate> upTemplate;
+            unsigned long long size;
+            long long time;
+        };
+
+        // Add texture without references
+        Texture const * insertTexture(std::string filepath, std::unique_ptr<Texture> upTexture);
+
+        // Request texture with key, decoded in background from file at size
+        Texture const * requestTexture(std::string key, std::string filepath, uint size);
+
+        // Count reference to existing texture
+        void addReference(std::string key);
+
+        // Remember usage of texture for order of eviction
+        void touchTexture(TextureEntry& rEntry);
+
+        // Replace placeholder with decoded image
+        void replacePlaceholder(std::map<std::string, AsyncTexture*>::iterator it, const Image& rImage);
+
         // Fetch shader
         Shader* fetchShader(shaders::Type shader);
 
-        // Fetch mesh
-        Mesh* fetchMesh(meshes::Type mesh);
+        // Compose vertex shader of element, reading values either from uniform block or instance
+        std::string composeVertexShader(bool instanced) const;
+
+        // Compose fragment shader of element from declarations and body
+        std::string composeFragmentShader(shaders::Type shader, bool instanced) const;
 
         // Members
         GUI const * mpGUI;
+        RenderBackend* mpBackend;
         FT_Library mFreeTypeLibrary;
         std::map<shaders::Type, std::unique_ptr<Shader> > mShaders;
+        std::map<shaders::Type, std::unique_ptr<Shader> > mInstancedShaders;
         std::map<meshes::Type, std::unique_ptr<Mesh> > mMeshes;
         std::map<shaders::Type, std::map<meshes::Type, std::unique_ptr<RenderItem> > > mRenderItems;
-        std::map<std::string, std::unique_ptr<Texture> > mTextures;
+        std::unique_ptr<IconAtlas> mupIconAtlas; // Textures free their space in it, so declared before them
+        std::map<std::string, TextureEntry> mTextures;
+        std::unordered_map<Texture const *, std::map<std::string, TextureEntry>::iterator> mTextureEntries; // Entry of each texture for release
+        std::list<std::string> mUnusedTextures; // Least recently used first
+        uint mTextureMemoryBudget;
+        uint mResidentTextureBytes;
+        uint mMaxVectorGraphicsSize;
         std::map<graphics::Type, std::unique_ptr<Texture> > mGraphics;
+        std::map<std::string, BrickTemplateEntry> mBrickTemplates;
+        std::unique_ptr<ThreadPool> mupRasterizationPool; // Used by fonts while filling atlases, so declared before them
+        std::unique_ptr<FontAtlasCache> mupFontAtlasCache; // NULL if disabled, used by fonts
+        std::map<std::string, FileView> mFontFiles; // Read by faces of fonts, so declared before them
         std::map<std::string, std::unique_ptr<Font> > mFonts;
+        bool mDistanceFieldFonts;
+        std::map<std::string, AsyncTexture*> mPlaceholders; // Textures waiting for decoded image
+        std::mutex mImageCacheMutex; // Guards pointer, image cache itself may be used by any thread
+        std::shared_ptr<ImageCache const> mspImageCache;
+        std::mutex mDecodedImagesMutex;
+        std::deque<DecodedImage> mDecodedImages; // Filled by decoding threads
+        std::unique_ptr<ThreadPool> mupDecodingPool; // Last member, so decoding stops before anything is deleted
     };
 }
 
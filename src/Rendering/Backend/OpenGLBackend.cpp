@@ -0,0 +1,668 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "OpenGLBackend.h"
+
+#include "OperationNotifier.h"
+#include "externals/GLM/glm/gtc/type_ptr.hpp"
+
+namespace eyegui
+{
+    OpenGLBackend::OpenGLBackend(RenderStateCache* pStateCache) : RenderBackend(pStateCache)
+    {
+        // Initialize members
+        mViewport[0] = 0;
+        mViewport[1] = 0;
+        mViewport[2] = 0;
+        mViewport[3] = 0;
+        mApplicationFramebuffer = 0;
+        mApplicationFramebufferKnown = false;
+        mMaxTextureSize = 0;
+        mUniformBufferOffsetAlignment = 0;
+    }
+
+    OpenGLBackend::~OpenGLBackend()
+    {
+        // Nothing to do
+    }
+
+    void OpenGLBackend::init()
+    {
+        mGLSetup.init();
+
+        // Limits do not change, so they are queried once
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &mMaxTextureSize);
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &mUniformBufferOffsetAlignment);
+    }
+
+    void OpenGLBackend::beginFrame(int viewportX, int viewportY, int viewportWidth, int viewportHeight)
+    {
+        mGLSetup.setup(viewportX, viewportY, viewportWidth, viewportHeight);
+        mViewport[0] = viewportX;
+        mViewport[1] = viewportY;
+        mViewport[2] = viewportWidth;
+        mViewport[3] = viewportHeight;
+        mApplicationFramebufferKnown = false;
+        mStateQueryCount += mGLSetup.getQueryCount();
+        mAvoidedStateQueryCount += mGLSetup.getAvoidedQueryCount();
+        mpStateCache->beginFrame();
+    }
+
+    void OpenGLBackend::endFrame()
+    {
+        mpStateCache->endFrame();
+        mGLSetup.restore();
+    }
+
+    void OpenGLBackend::setStateRestoration(StateRestoration restoration)
+    {
+        mGLSetup.setRestoration(restoration);
+    }
+
+    uint OpenGLBackend::createShaderProgram(char const * pVertexShaderSource, char const * pFragmentShaderSource)
+    {
+        // Vertex shader
+        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &pVertexShaderSource, NULL);
+        glCompileShader(vertexShader);
+        evaluateShaderLog(vertexShader);
+
+        // Fragment shader
+        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &pFragmentShaderSource, NULL);
+        glCompileShader(fragmentShader);
+        evaluateShaderLog(fragmentShader);
+
+        // Create program
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+
+        // Delete shader
+        glDetachShader(program, fragmentShader);
+        glDetachShader(program, vertexShader);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+
+        return program;
+    }
+
+    void OpenGLBackend::deleteShaderProgram(uint program)
+    {
+        mpStateCache->forgetProgram(program);
+        glDeleteProgram(program);
+    }
+
+    std::map<std::string, int> OpenGLBackend::getUniformLocations(uint program)
+    {
+        std::map<std::string, int> locations;
+
+        // Extract all uniforms of shader
+        int total = -1;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &total);
+        for (int i = 0; i < total; i++)
+        {
+            // Prepare some values
+            int nameLength = -1;
+            int number = -1;
+            GLenum type = GL_ZERO;
+            char name[100];
+
+            // Get information about uniform
+            glGetActiveUniform(program, GLuint(i), sizeof(name) - 1, &nameLength, &number, &type, name);
+
+            // Add end of string
+            name[nameLength] = 0;
+
+            // Save mapping from name to location in map
+            locations[name] = glGetUniformLocation(program, name);
+        }
+
+        return locations;
+    }
+
+    int OpenGLBackend::getAttributeLocation(uint program, std::string name)
+    {
+        return glGetAttribLocation(program, name.c_str());
+    }
+
+    void OpenGLBackend::useProgram(uint program)
+    {
+        if (mpStateCache->changeProgram(program))
+        {
+            glUseProgram(program);
+            mShaderBindCount++;
+        }
+    }
+
+    void OpenGLBackend::setUniformBlockBinding(uint program, std::string blockName, uint bindingPoint)
+    {
+        // Block may be optimized away by shader compiler
+        GLuint index = glGetUniformBlockIndex(program, blockName.c_str());
+        if (index != GL_INVALID_INDEX)
+        {
+            glUniformBlockBinding(program, index, bindingPoint);
+        }
+    }
+
+    void OpenGLBackend::setUniform(int location, const int rValue)
+    {
+        glUniform1i(location, rValue);
+    }
+
+    void OpenGLBackend::setUniform(int location, const float rValue)
+    {
+        glUniform1fv(location, 1, &rValue);
+    }
+
+    void OpenGLBackend::setUniform(int location, const glm::vec2& rValue)
+    {
+        glUniform2fv(location, 1, glm::value_ptr(rValue));
+    }
+
+    void OpenGLBackend::setUniform(int location, const glm::vec3& rValue)
+    {
+        glUniform3fv(location, 1, glm::value_ptr(rValue));
+    }
+
+    void OpenGLBackend::setUniform(int location, const glm::vec4& rValue)
+    {
+        glUniform4fv(location, 1, glm::value_ptr(rValue));
+    }
+
+    void OpenGLBackend::setUniform(int location, const glm::mat4& rValue)
+    {
+        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(rValue));
+    }
+
+    uint OpenGLBackend::createBuffer()
+    {
+        GLuint buffer = 0;
+        glGenBuffers(1, &buffer);
+        return buffer;
+    }
+
+    void OpenGLBackend::fillBuffer(uint buffer, void const * pData, uint byteCount, bool dynamic)
+    {
+        // Use copy target, so binding of array buffer is neither queried nor changed
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, byteCount, pData, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    void OpenGLBackend::updateBuffer(uint buffer, uint byteOffset, void const * pData, uint byteCount)
+    {
+        // Use copy target, so bindings of array and uniform buffers are untouched
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, byteOffset, byteCount, pData);
+
+        // Unbind it, so application copying through same target never writes into buffer of eyeGUI
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    void OpenGLBackend::bindUniformBuffer(uint buffer, uint bindingPoint, uint byteOffset, uint byteCount)
+    {
+        glBindBufferRange(GL_UNIFORM_BUFFER, bindingPoint, buffer, byteOffset, byteCount);
+    }
+
+    uint OpenGLBackend::getUniformBufferOffsetAlignment()
+    {
+        return (uint)mUniformBufferOffsetAlignment;
+    }
+
+    void OpenGLBackend::deleteBuffer(uint buffer)
+    {
+        mpStateCache->forgetArrayBuffer(buffer);
+        glDeleteBuffers(1, &buffer);
+    }
+
+    uint OpenGLBackend::createVertexArray()
+    {
+        GLuint vertexArray = 0;
+        glGenVertexArrays(1, &vertexArray);
+        return vertexArray;
+    }
+
+    void OpenGLBackend::setVertexAttribute(uint vertexArray, int location, uint buffer, int componentCount)
+    {
+        // Attribute may be optimized away by shader compiler
+        if (location < 0)
+        {
+            return;
+        }
+
+        // Save currently set buffer and vertex array object
+        const StateRestoration& rRestoration = mGLSetup.getRestoration();
+        GLint oldBuffer = 0, oldVAO = 0;
+        bool restoreBuffer = saveApplicationState(GL_ARRAY_BUFFER_BINDING, rRestoration.arrayBuffer, oldBuffer);
+        bool restoreVAO = saveApplicationState(GL_VERTEX_ARRAY_BINDING, rRestoration.vertexArray, oldVAO);
+
+        // Connect buffer to attribute
+        bindVertexArray(vertexArray);
+        glEnableVertexAttribArray(location);
+        bindArrayBuffer(buffer);
+        glVertexAttribPointer(location, componentCount, GL_FLOAT, GL_FALSE, 0, NULL);
+
+        // Restore old settings
+        if (restoreBuffer) { glBindBuffer(GL_ARRAY_BUFFER, oldBuffer); }
+        if (restoreVAO) { glBindVertexArray(oldVAO); }
+    }
+
+    void OpenGLBackend::setInstanceAttribute(uint vertexArray, int location, uint buffer, int componentCount, uint stride, uint offset)
+    {
+        // Attribute may be optimized away by shader compiler
+        if (location < 0)
+        {
+            return;
+        }
+
+        // Save currently set buffer and vertex array object
+        const StateRestoration& rRestoration = mGLSetup.getRestoration();
+        GLint oldBuffer = 0, oldVAO = 0;
+        bool restoreBuffer = saveApplicationState(GL_ARRAY_BUFFER_BINDING, rRestoration.arrayBuffer, oldBuffer);
+        bool restoreVAO = saveApplicationState(GL_VERTEX_ARRAY_BINDING, rRestoration.vertexArray, oldVAO);
+
+        // Connect buffer to attribute and advance it per instance
+        bindVertexArray(vertexArray);
+        glEnableVertexAttribArray(location);
+        bindArrayBuffer(buffer);
+        glVertexAttribPointer(location, componentCount, GL_FLOAT, GL_FALSE, stride, (GLvoid const *)(size_t)offset);
+        glVertexAttribDivisor(location, 1);
+
+        // Restore old settings
+        if (restoreBuffer) { glBindBuffer(GL_ARRAY_BUFFER, oldBuffer); }
+        if (restoreVAO) { glBindVertexArray(oldVAO); }
+    }
+
+    void OpenGLBackend::bindVertexArray(uint vertexArray)
+    {
+        if (mpStateCache->changeVertexArray(vertexArray))
+        {
+            glBindVertexArray(vertexArray);
+        }
+    }
+
+    void OpenGLBackend::deleteVertexArray(uint vertexArray)
+    {
+        mpStateCache->forgetVertexArray(vertexArray);
+        glDeleteVertexArrays(1, &vertexArray);
+    }
+
+    uint OpenGLBackend::createTexture()
+    {
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        return texture;
+    }
+
+    void OpenGLBackend::fillTexture(
+        uint texture,
+        int width,
+        int height,
+        PixelFormat format,
+        uchar const * pData,
+        TextureFilter minFilter,
+        TextureFilter magFilter,
+        TextureWrap wrap)
+    {
+        // Enable writing of rows which are not aligned to four bytes
+        GLint oldUnpackAlignment = 0;
+        bool restoreUnpackAlignment = saveApplicationState(GL_UNPACK_ALIGNMENT, mGLSetup.getRestoration().unpackAlignment, oldUnpackAlignment);
+        if (mpStateCache->changeUnpackAlignment(1))
+        {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        }
+
+        // Bind texture (uploads go to active slot)
+        if (mpStateCache->changeActiveSlot(0))
+        {
+            glActiveTexture(GL_TEXTURE0);
+        }
+        setTextureBinding(texture, 0);
+
+        // Wrapping
+        switch (wrap)
+        {
+        case TextureWrap::CLAMP:
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            break;
+        case TextureWrap::MIRROR:
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
+            break;
+        case TextureWrap::REPEAT:
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            break;
+        }
+
+        // Load it to GPU
+        switch (format)
+        {
+        case PixelFormat::RED:
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pData);
+            break;
+        case PixelFormat::RGB:
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, pData);
+            break;
+        case PixelFormat::RGBA:
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pData);
+            break;
+        }
+
+        // Filtering of minification
+        switch (minFilter)
+        {
+        case TextureFilter::NEAREST:
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            break;
+        case TextureFilter::LINEAR:
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            break;
+        case TextureFilter::LINEAR_MIPMAP:
+            glGenerateMipmap(GL_TEXTURE_2D);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            break;
+        }
+
+        // Filtering of magnification (no mipmaps used there)
+        glTexParameteri(
+            GL_TEXTURE_2D,
+            GL_TEXTURE_MAG_FILTER,
+            magFilter == TextureFilter::NEAREST ? GL_NEAREST : GL_LINEAR);
+
+        // Unbind texture
+        setTextureBinding(0, 0);
+
+        // Reset unpack alignment
+        if (restoreUnpackAlignment) { glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment); }
+    }
+
+    void OpenGLBackend::fillTextureRegion(
+        uint texture,
+        int x,
+        int y,
+        int width,
+        int height,
+        PixelFormat format,
+        uchar const * pData)
+    {
+        // Enable writing of rows which are not aligned to four bytes
+        GLint oldUnpackAlignment = 0;
+        bool restoreUnpackAlignment = saveApplicationState(GL_UNPACK_ALIGNMENT, mGLSetup.getRestoration().unpackAlignment, oldUnpackAlignment);
+        if (mpStateCache->changeUnpackAlignment(1))
+        {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        }
+
+        // Choose format
+        GLenum glFormat = GL_RGBA;
+        switch (format)
+        {
+        case PixelFormat::RED:
+            glFormat = GL_RED;
+            break;
+        case PixelFormat::RGB:
+            glFormat = GL_RGB;
+            break;
+        case PixelFormat::RGBA:
+            glFormat = GL_RGBA;
+            break;
+        }
+
+        // Write into texture
+        if (mpStateCache->changeActiveSlot(0))
+        {
+            glActiveTexture(GL_TEXTURE0);
+        }
+        setTextureBinding(texture, 0);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, glFormat, GL_UNSIGNED_BYTE, pData);
+        setTextureBinding(0, 0);
+
+        // Reset unpack alignment
+        if (restoreUnpackAlignment) { glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment); }
+    }
+
+    void OpenGLBackend::copyTextureRegions(
+        uint sourceTexture,
+        uint targetTexture,
+        const std::vector<TextureRegionCopy>& rRegions)
+    {
+        // Remember bound framebuffer, as copying may happen while drawing
+        GLint previousFramebuffer;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer);
+        mStateQueryCount++;
+
+        // Read from source through temporary framebuffer
+        GLuint framebuffer;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, sourceTexture, 0);
+        if (glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Framebuffer for copying texture is incomplete");
+        }
+
+        // Write into target
+        if (mpStateCache->changeActiveSlot(0))
+        {
+            glActiveTexture(GL_TEXTURE0);
+        }
+        setTextureBinding(targetTexture, 0);
+        for (const TextureRegionCopy& rRegion : rRegions)
+        {
+            glCopyTexSubImage2D(
+                GL_TEXTURE_2D,
+                0,
+                rRegion.targetX,
+                rRegion.targetY,
+                rRegion.sourceX,
+                rRegion.sourceY,
+                rRegion.width,
+                rRegion.height);
+        }
+        setTextureBinding(0, 0);
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, previousFramebuffer);
+        glDeleteFramebuffers(1, &framebuffer);
+    }
+
+    void OpenGLBackend::generateMipmaps(uint texture, int maxLevel)
+    {
+        if (mpStateCache->changeActiveSlot(0))
+        {
+            glActiveTexture(GL_TEXTURE0);
+        }
+        setTextureBinding(texture, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        setTextureBinding(0, 0);
+    }
+
+    void OpenGLBackend::bindTexture(uint texture, uint slot)
+    {
+        if (setTextureBinding(texture, slot))
+        {
+            mTextureBindCount++;
+        }
+    }
+
+    void OpenGLBackend::deleteTexture(uint texture)
+    {
+        mpStateCache->forgetTexture(texture);
+        glDeleteTextures(1, &texture);
+    }
+
+    int OpenGLBackend::getMaxTextureSize()
+    {
+        return (int)mMaxTextureSize;
+    }
+
+    uint OpenGLBackend::createFramebuffer(uint texture)
+    {
+        // Remember bound framebuffer, as creation may happen while drawing
+        GLint previousFramebuffer;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+        mStateQueryCount++;
+
+        GLuint framebuffer;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Framebuffer for offscreen rendering is incomplete");
+        }
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousFramebuffer);
+
+        return framebuffer;
+    }
+
+    void OpenGLBackend::beginFramebuffer(uint framebuffer, int width, int height)
+    {
+        // Framebuffer of application is only queried when needed
+        if (!mApplicationFramebufferKnown)
+        {
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &mApplicationFramebuffer);
+            mStateQueryCount++;
+            mApplicationFramebufferKnown = true;
+        }
+
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        glViewport(0, 0, width, height);
+
+        // Clear without touching clear color of application
+        const GLfloat transparent[] = { 0, 0, 0, 0 };
+        glClearBufferfv(GL_COLOR, 0, transparent);
+
+        // Alpha blending of colors, but alpha is accumulated. Results in premultiplied colors
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void OpenGLBackend::endFramebuffer()
+    {
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mApplicationFramebuffer);
+        glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void OpenGLBackend::deleteFramebuffer(uint framebuffer)
+    {
+        glDeleteFramebuffers(1, &framebuffer);
+    }
+
+    void OpenGLBackend::setBlending(Blending blending)
+    {
+        switch (blending)
+        {
+        case Blending::ALPHA:
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+        case Blending::PREMULTIPLIED:
+            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+        }
+    }
+
+    void OpenGLBackend::drawArrays(Primitive primitive, uint vertexCount, uint firstVertex)
+    {
+        mDrawCallCount++;
+        switch (primitive)
+        {
+        case Primitive::TRIANGLES:
+            glDrawArrays(GL_TRIANGLES, firstVertex, vertexCount);
+            break;
+        case Primitive::LINES:
+            glDrawArrays(GL_LINES, firstVertex, vertexCount);
+            break;
+        }
+    }
+
+    void OpenGLBackend::drawArraysInstanced(Primitive primitive, uint vertexCount, uint instanceCount)
+    {
+        mDrawCallCount++;
+        switch (primitive)
+        {
+        case Primitive::TRIANGLES:
+            glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, instanceCount);
+            break;
+        case Primitive::LINES:
+            glDrawArraysInstanced(GL_LINES, 0, vertexCount, instanceCount);
+            break;
+        }
+    }
+
+    bool OpenGLBackend::setTextureBinding(uint texture, uint slot)
+    {
+        // Nothing to do when texture is already bound to slot
+        if (!mpStateCache->changeTexture(slot, texture))
+        {
+            return false;
+        }
+
+        // Choose slot
+        if (mpStateCache->changeActiveSlot(slot))
+        {
+            glActiveTexture(GL_TEXTURE0 + slot);
+        }
+
+        // Bind texture
+        glBindTexture(GL_TEXTURE_2D, texture);
+        return true;
+    }
+
+    void OpenGLBackend::bindArrayBuffer(uint buffer)
+    {
+        if (mpStateCache->changeArrayBuffer(buffer))
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        }
+    }
+
+    bool OpenGLBackend::saveApplicationState(GLenum name, bool restore, GLint& rValue)
+    {
+        // Inside of frames, setup has saved state already
+        if (mpStateCache->isInsideFrame())
+        {
+            return false;
+        }
+
+        // Outside of frames, state is queried only when application relies on it
+        if (!restore)
+        {
+            mAvoidedStateQueryCount++;
+            return false;
+        }
+        glGetIntegerv(name, &rValue);
+        mStateQueryCount++;
+        return true;
+    }
+
+    void OpenGLBackend::evaluateShaderLog(GLuint handle) const
+    {
+        // Get length of compiling log
+        GLint log_length = 0;
+        glGetShaderiv(handle, GL_INFO_LOG_LENGTH, &log_length);
+
+        if (log_length > 1)
+        {
+            // Copy log to chars
+            GLchar *log = new GLchar[log_length];
+            glGetShaderInfoLog(handle, log_length, NULL, log);
+
+            // Print it
+            throwError(
+                OperationNotifier::Operation::BUG,
+                "A shader throws errors at compilation:\n" + std::string(log));
+
+            // Delete chars
+            delete[] log;
+        }
+    }
+}
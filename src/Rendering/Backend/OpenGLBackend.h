@@ -0,0 +1,133 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Render backend using OpenGL 3.3 core profile. Needs a current context
+// created by the application.
+
+#ifndef OPENGL_BACKEND_H_
+#define OPENGL_BACKEND_H_
+
+#include "RenderBackend.h"
+#include "Rendering/GLSetup.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+namespace eyegui
+{
+    class OpenGLBackend : public RenderBackend
+    {
+    public:
+
+        // Constructor
+        OpenGLBackend(RenderStateCache* pStateCache);
+
+        // Destructor
+        virtual ~OpenGLBackend();
+
+        // Initialization
+        virtual void init();
+
+        // Begin frame and setup state for rendering
+        virtual void beginFrame(int viewportX, int viewportY, int viewportWidth, int viewportHeight);
+
+        // End frame and restore state of application
+        virtual void endFrame();
+
+        // Set which state of application is saved and restored
+        virtual void setStateRestoration(StateRestoration restoration);
+
+        // Shader programs
+        virtual uint createShaderProgram(char const * pVertexShaderSource, char const * pFragmentShaderSource);
+        virtual void deleteShaderProgram(uint program);
+        virtual std::map<std::string, int> getUniformLocations(uint program);
+        virtual int getAttributeLocation(uint program, std::string name);
+        virtual void useProgram(uint program);
+        virtual void setUniformBlockBinding(uint program, std::string blockName, uint bindingPoint);
+        virtual void setUniform(int location, const int rValue);
+        virtual void setUniform(int location, const float rValue);
+        virtual void setUniform(int location, const glm::vec2& rValue);
+        virtual void setUniform(int location, const glm::vec3& rValue);
+        virtual void setUniform(int location, const glm::vec4& rValue);
+        virtual void setUniform(int location, const glm::mat4& rValue);
+
+        // Buffers
+        virtual uint createBuffer();
+        virtual void fillBuffer(uint buffer, void const * pData, uint byteCount, bool dynamic);
+        virtual void updateBuffer(uint buffer, uint byteOffset, void const * pData, uint byteCount);
+        virtual void bindUniformBuffer(uint buffer, uint bindingPoint, uint byteOffset, uint byteCount);
+        virtual uint getUniformBufferOffsetAlignment();
+        virtual void deleteBuffer(uint buffer);
+
+        // Vertex array objects
+        virtual uint createVertexArray();
+        virtual void setVertexAttribute(uint vertexArray, int location, uint buffer, int componentCount);
+        virtual void setInstanceAttribute(uint vertexArray, int location, uint buffer, int componentCount, uint stride, uint offset);
+        virtual void bindVertexArray(uint vertexArray);
+        virtual void deleteVertexArray(uint vertexArray);
+
+        // Textures
+        virtual uint createTexture();
+        virtual void fillTexture(
+            uint texture,
+            int width,
+            int height,
+            PixelFormat format,
+            uchar const * pData,
+            TextureFilter minFilter,
+            TextureFilter magFilter,
+            TextureWrap wrap);
+        virtual void fillTextureRegion(
+            uint texture,
+            int x,
+            int y,
+            int width,
+            int height,
+            PixelFormat format,
+            uchar const * pData);
+        virtual void copyTextureRegions(
+            uint sourceTexture,
+            uint targetTexture,
+            const std::vector<TextureRegionCopy>& rRegions);
+        virtual void generateMipmaps(uint texture, int maxLevel);
+        virtual void bindTexture(uint texture, uint slot = 0);
+        virtual void deleteTexture(uint texture);
+        virtual int getMaxTextureSize();
+
+        // Framebuffers
+        virtual uint createFramebuffer(uint texture);
+        virtual void beginFramebuffer(uint framebuffer, int width, int height);
+        virtual void endFramebuffer();
+        virtual void deleteFramebuffer(uint framebuffer);
+        virtual void setBlending(Blending blending);
+
+        // Drawing
+        virtual void drawArrays(Primitive primitive, uint vertexCount, uint firstVertex = 0);
+        virtual void drawArraysInstanced(Primitive primitive, uint vertexCount, uint instanceCount);
+
+    private:
+
+        // Evaluate shader compiling log
+        void evaluateShaderLog(GLuint handle) const;
+
+        // Bind texture to slot if not already bound, returns whether it was bound
+        bool setTextureBinding(uint texture, uint slot);
+
+        // Bind array buffer if not already bound
+        void bindArrayBuffer(uint buffer);
+
+        // Query state of application outside of frames if it is restored. Returns whether it was queried
+        bool saveApplicationState(GLenum name, bool restore, GLint& rValue);
+
+        // Members
+        GLSetup mGLSetup;
+        GLint mViewport[4]; // Viewport of frame
+        GLint mApplicationFramebuffer; // Queried at first usage of own framebuffer in frame
+        bool mApplicationFramebufferKnown;
+        GLint mMaxTextureSize;
+        GLint mUniformBufferOffsetAlignment;
+    };
+}
+
+#endif // OPENGL_BACKEND_H_
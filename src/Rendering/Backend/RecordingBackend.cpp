@@ -0,0 +1,429 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "RecordingBackend.h"
+
+#include "externals/GLM/glm/gtc/type_ptr.hpp"
+
+#include <sstream>
+#include <algorithm>
+
+namespace eyegui
+{
+    RecordingBackend::RecordingBackend(RenderStateCache* pStateCache) : RenderBackend(pStateCache)
+    {
+        // Initialize members
+        mNextHandle = 1; // Zero is reserved for "nothing bound"
+        mCurrentProgram = 0;
+        mCurrentVertexArray = 0;
+    }
+
+    RecordingBackend::~RecordingBackend()
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::init()
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::beginFrame(int viewportX, int viewportY, int viewportWidth, int viewportHeight)
+    {
+        mDrawCommands.clear();
+        mpStateCache->beginFrame();
+    }
+
+    void RecordingBackend::endFrame()
+    {
+        // Keep commands of finished frame and reset bindings like application would do
+        mpStateCache->endFrame();
+        mLastFrameDrawCommands.swap(mDrawCommands);
+        mCurrentProgram = 0;
+        mCurrentVertexArray = 0;
+        mBoundTextures.clear();
+        mBoundUniformBuffers.clear();
+    }
+
+    uint RecordingBackend::createShaderProgram(char const * pVertexShaderSource, char const * pFragmentShaderSource)
+    {
+        uint handle = mNextHandle++;
+        Program& rProgram = mPrograms[handle];
+
+        // Uniforms of both shaders share locations
+        std::vector<std::string> uniforms = extractNames(pVertexShaderSource, "uniform");
+        std::vector<std::string> fragmentUniforms = extractNames(pFragmentShaderSource, "uniform");
+        uniforms.insert(uniforms.end(), fragmentUniforms.begin(), fragmentUniforms.end());
+        for (const std::string& rName : uniforms)
+        {
+            if (rProgram.uniformLocations.find(rName) == rProgram.uniformLocations.end())
+            {
+                int location = (int)rProgram.uniformLocations.size();
+                rProgram.uniformLocations[rName] = location;
+                rProgram.uniformNames[location] = rName;
+            }
+        }
+
+        // Uniform blocks are not bound to any binding point initially
+        std::vector<std::string> blocks = extractBlockNames(pVertexShaderSource);
+        std::vector<std::string> fragmentBlocks = extractBlockNames(pFragmentShaderSource);
+        blocks.insert(blocks.end(), fragmentBlocks.begin(), fragmentBlocks.end());
+        for (const std::string& rName : blocks)
+        {
+            rProgram.blockBindings[rName] = 0;
+        }
+
+        // Attributes are inputs of vertex shader
+        for (const std::string& rName : extractNames(pVertexShaderSource, "in"))
+        {
+            if (rProgram.attributeLocations.find(rName) == rProgram.attributeLocations.end())
+            {
+                int location = (int)rProgram.attributeLocations.size();
+                rProgram.attributeLocations[rName] = location;
+            }
+        }
+
+        return handle;
+    }
+
+    void RecordingBackend::deleteShaderProgram(uint program)
+    {
+        mpStateCache->forgetProgram(program);
+        mPrograms.erase(program);
+    }
+
+    std::map<std::string, int> RecordingBackend::getUniformLocations(uint program)
+    {
+        return mPrograms[program].uniformLocations;
+    }
+
+    int RecordingBackend::getAttributeLocation(uint program, std::string name)
+    {
+        const std::map<std::string, int>& rLocations = mPrograms[program].attributeLocations;
+        auto it = rLocations.find(name);
+        return (it != rLocations.end()) ? it->second : -1;
+    }
+
+    void RecordingBackend::useProgram(uint program)
+    {
+        if (mpStateCache->changeProgram(program))
+        {
+            mCurrentProgram = program;
+            mShaderBindCount++;
+        }
+    }
+
+    void RecordingBackend::setUniformBlockBinding(uint program, std::string blockName, uint bindingPoint)
+    {
+        auto programIt = mPrograms.find(program);
+        if (programIt != mPrograms.end())
+        {
+            auto blockIt = programIt->second.blockBindings.find(blockName);
+            if (blockIt != programIt->second.blockBindings.end())
+            {
+                blockIt->second = bindingPoint;
+            }
+        }
+    }
+
+    void RecordingBackend::setUniform(int location, const int rValue)
+    {
+        float value = (float)rValue;
+        setUniform(location, &value, 1);
+    }
+
+    void RecordingBackend::setUniform(int location, const float rValue)
+    {
+        setUniform(location, &rValue, 1);
+    }
+
+    void RecordingBackend::setUniform(int location, const glm::vec2& rValue)
+    {
+        setUniform(location, glm::value_ptr(rValue), 2);
+    }
+
+    void RecordingBackend::setUniform(int location, const glm::vec3& rValue)
+    {
+        setUniform(location, glm::value_ptr(rValue), 3);
+    }
+
+    void RecordingBackend::setUniform(int location, const glm::vec4& rValue)
+    {
+        setUniform(location, glm::value_ptr(rValue), 4);
+    }
+
+    void RecordingBackend::setUniform(int location, const glm::mat4& rValue)
+    {
+        setUniform(location, glm::value_ptr(rValue), 16);
+    }
+
+    uint RecordingBackend::createBuffer()
+    {
+        return mNextHandle++;
+    }
+
+    void RecordingBackend::fillBuffer(uint buffer, void const * pData, uint byteCount, bool dynamic)
+    {
+        // Only size is kept, content is recorded by updates
+        mBufferData[buffer].assign(byteCount / sizeof(float), 0.0f);
+    }
+
+    void RecordingBackend::updateBuffer(uint buffer, uint byteOffset, void const * pData, uint byteCount)
+    {
+        std::vector<float>& rData = mBufferData[buffer];
+        uint first = byteOffset / sizeof(float);
+        uint count = byteCount / sizeof(float);
+        if (rData.size() < first + count)
+        {
+            rData.resize(first + count, 0.0f);
+        }
+        float const * pValues = static_cast<float const *>(pData);
+        std::copy(pValues, pValues + count, rData.begin() + first);
+    }
+
+    void RecordingBackend::bindUniformBuffer(uint buffer, uint bindingPoint, uint byteOffset, uint byteCount)
+    {
+        UniformBufferRange& rRange = mBoundUniformBuffers[bindingPoint];
+        rRange.buffer = buffer;
+        rRange.first = byteOffset / sizeof(float);
+        rRange.count = byteCount / sizeof(float);
+    }
+
+    uint RecordingBackend::getUniformBufferOffsetAlignment()
+    {
+        // Value of common hardware
+        return 256;
+    }
+
+    void RecordingBackend::deleteBuffer(uint buffer)
+    {
+        mBufferData.erase(buffer);
+    }
+
+    uint RecordingBackend::createVertexArray()
+    {
+        return mNextHandle++;
+    }
+
+    void RecordingBackend::setVertexAttribute(uint vertexArray, int location, uint buffer, int componentCount)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::setInstanceAttribute(uint vertexArray, int location, uint buffer, int componentCount, uint stride, uint offset)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::bindVertexArray(uint vertexArray)
+    {
+        if (mpStateCache->changeVertexArray(vertexArray))
+        {
+            mCurrentVertexArray = vertexArray;
+        }
+    }
+
+    void RecordingBackend::deleteVertexArray(uint vertexArray)
+    {
+        mpStateCache->forgetVertexArray(vertexArray);
+    }
+
+    uint RecordingBackend::createTexture()
+    {
+        return mNextHandle++;
+    }
+
+    void RecordingBackend::fillTexture(
+        uint texture,
+        int width,
+        int height,
+        PixelFormat format,
+        uchar const * pData,
+        TextureFilter minFilter,
+        TextureFilter magFilter,
+        TextureWrap wrap)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::fillTextureRegion(
+        uint texture,
+        int x,
+        int y,
+        int width,
+        int height,
+        PixelFormat format,
+        uchar const * pData)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::copyTextureRegions(
+        uint sourceTexture,
+        uint targetTexture,
+        const std::vector<TextureRegionCopy>& rRegions)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::generateMipmaps(uint texture, int maxLevel)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::bindTexture(uint texture, uint slot)
+    {
+        if (mpStateCache->changeTexture(slot, texture))
+        {
+            mBoundTextures[slot] = texture;
+            mTextureBindCount++;
+        }
+    }
+
+    void RecordingBackend::deleteTexture(uint texture)
+    {
+        mpStateCache->forgetTexture(texture);
+    }
+
+    int RecordingBackend::getMaxTextureSize()
+    {
+        // Minimum required by OpenGL 3.3 is 1024, use value of common hardware
+        return 16384;
+    }
+
+    uint RecordingBackend::createFramebuffer(uint texture)
+    {
+        return mNextHandle++;
+    }
+
+    void RecordingBackend::beginFramebuffer(uint framebuffer, int width, int height)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::endFramebuffer()
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::deleteFramebuffer(uint framebuffer)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::setBlending(Blending blending)
+    {
+        // Nothing to do
+    }
+
+    void RecordingBackend::drawArrays(Primitive primitive, uint vertexCount, uint firstVertex)
+    {
+        drawArraysInstanced(primitive, vertexCount, 1);
+    }
+
+    void RecordingBackend::drawArraysInstanced(Primitive primitive, uint vertexCount, uint instanceCount)
+    {
+        mDrawCallCount++;
+        DrawCommand command;
+        command.shaderProgram = mCurrentProgram;
+        command.vertexCount = vertexCount;
+        command.instanceCount = instanceCount;
+
+        // Texture in first slot
+        auto it = mBoundTextures.find(0);
+        if (it != mBoundTextures.end())
+        {
+            command.texture = it->second;
+        }
+
+        // Snapshot of uniforms
+        auto programIt = mPrograms.find(mCurrentProgram);
+        if (programIt != mPrograms.end())
+        {
+            command.uniforms = programIt->second.uniformValues;
+
+            // Content of uniform blocks is stored as a whole under name of block
+            for (const auto& rBlock : programIt->second.blockBindings)
+            {
+                auto rangeIt = mBoundUniformBuffers.find(rBlock.second);
+                if (rangeIt != mBoundUniformBuffers.end())
+                {
+                    const UniformBufferRange& rRange = rangeIt->second;
+                    const std::vector<float>& rData = mBufferData[rRange.buffer];
+                    uint first = std::min(rRange.first, (uint)rData.size());
+                    uint last = std::min(rRange.first + rRange.count, (uint)rData.size());
+                    command.uniforms[rBlock.first] = std::vector<float>(rData.begin() + first, rData.begin() + last);
+                }
+            }
+        }
+
+        mDrawCommands.push_back(command);
+    }
+
+    std::vector<DrawCommand> RecordingBackend::getRecordedDrawCommands() const
+    {
+        return mLastFrameDrawCommands;
+    }
+
+    std::vector<std::string> RecordingBackend::extractNames(char const * pSource, std::string qualifier) const
+    {
+        std::vector<std::string> names;
+
+        // Go over tokens and take the one after qualifier and type
+        std::istringstream stream(pSource);
+        std::string token;
+        while (stream >> token)
+        {
+            if (token == qualifier)
+            {
+                std::string type, name;
+                if (stream >> type >> name && name[0] != '{')
+                {
+                    // Cut off semicolon, initialization or array brackets
+                    names.push_back(name.substr(0, name.find_first_of(";=[")));
+                }
+            }
+        }
+
+        return names;
+    }
+
+    std::vector<std::string> RecordingBackend::extractBlockNames(char const * pSource) const
+    {
+        std::vector<std::string> names;
+
+        // Block is uniform followed by name and opening brace
+        std::istringstream stream(pSource);
+        std::string token;
+        while (stream >> token)
+        {
+            if (token == "uniform")
+            {
+                std::string name, brace;
+                if (stream >> name >> brace && brace[0] == '{')
+                {
+                    names.push_back(name);
+                }
+            }
+        }
+
+        return names;
+    }
+
+    void RecordingBackend::setUniform(int location, float const * pValues, int count)
+    {
+        auto programIt = mPrograms.find(mCurrentProgram);
+        if (programIt != mPrograms.end())
+        {
+            auto nameIt = programIt->second.uniformNames.find(location);
+            if (nameIt != programIt->second.uniformNames.end())
+            {
+                programIt->second.uniformValues[nameIt->second] = std::vector<float>(pValues, pValues + count);
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Render backend without any graphics API. Hands out handles, keeps track of
+// bound program, texture and uniform values and records each draw call into
+// memory. Can be used to run the GUI without window or context, e.g. to
+// profile the CPU side of a frame or to count draw calls.
+
+#ifndef RECORDING_BACKEND_H_
+#define RECORDING_BACKEND_H_
+
+#include "RenderBackend.h"
+
+namespace eyegui
+{
+    class RecordingBackend : public RenderBackend
+    {
+    public:
+
+        // Constructor
+        RecordingBackend(RenderStateCache* pStateCache);
+
+        // Destructor
+        virtual ~RecordingBackend();
+
+        // Initialization
+        virtual void init();
+
+        // Begin frame and clear recorded draw commands
+        virtual void beginFrame(int viewportX, int viewportY, int viewportWidth, int viewportHeight);
+
+        // End frame and keep recorded draw commands
+        virtual void endFrame();
+
+        // Shader programs
+        virtual uint createShaderProgram(char const * pVertexShaderSource, char const * pFragmentShaderSource);
+        virtual void deleteShaderProgram(uint program);
+        virtual std::map<std::string, int> getUniformLocations(uint program);
+        virtual int getAttributeLocation(uint program, std::string name);
+        virtual void useProgram(uint program);
+        virtual void setUniformBlockBinding(uint program, std::string blockName, uint bindingPoint);
+        virtual void setUniform(int location, const int rValue);
+        virtual void setUniform(int location, const float rValue);
+        virtual void setUniform(int location, const glm::vec2& rValue);
+        virtual void setUniform(int location, const glm::vec3& rValue);
+        virtual void setUniform(int location, const glm::vec4& rValue);
+        virtual void setUniform(int location, const glm::mat4& rValue);
+
+        // Buffers
+        virtual uint createBuffer();
+        virtual void fillBuffer(uint buffer, void const * pData, uint byteCount, bool dynamic);
+        virtual void updateBuffer(uint buffer, uint byteOffset, void const * pData, uint byteCount);
+        virtual void bindUniformBuffer(uint buffer, uint bindingPoint, uint byteOffset, uint byteCount);
+        virtual uint getUniformBufferOffsetAlignment();
+        virtual void deleteBuffer(uint buffer);
+
+        // Vertex array objects
+        virtual uint createVertexArray();
+        virtual void setVertexAttribute(uint vertexArray, int location, uint buffer, int componentCount);
+        virtual void setInstanceAttribute(uint vertexArray, int location, uint buffer, int componentCount, uint stride, uint offset);
+        virtual void bindVertexArray(uint vertexArray);
+        virtual void deleteVertexArray(uint vertexArray);
+
+        // Textures
+        virtual uint createTexture();
+        virtual void fillTexture(
+            uint texture,
+            int width,
+            int height,
+            PixelFormat format,
+            uchar const * pData,
+            TextureFilter minFilter,
+            TextureFilter magFilter,
+            TextureWrap wrap);
+        virtual void fillTextureRegion(
+            uint texture,
+            int x,
+            int y,
+            int width,
+            int height,
+            PixelFormat format,
+            uchar const * pData);
+        virtual void copyTextureRegions(
+            uint sourceTexture,
+            uint targetTexture,
+            const std::vector<TextureRegionCopy>& rRegions);
+        virtual void generateMipmaps(uint texture, int maxLevel);
+        virtual void bindTexture(uint texture, uint slot = 0);
+        virtual void deleteTexture(uint texture);
+        virtual int getMaxTextureSize();
+
+        // Framebuffers
+        virtual uint createFramebuffer(uint texture);
+        virtual void beginFramebuffer(uint framebuffer, int width, int height);
+        virtual void endFramebuffer();
+        virtual void deleteFramebuffer(uint framebuffer);
+        virtual void setBlending(Blending blending);
+
+        // Drawing
+        virtual void drawArrays(Primitive primitive, uint vertexCount, uint firstVertex = 0);
+        virtual void drawArraysInstanced(Primitive primitive, uint vertexCount, uint instanceCount);
+
+        // Recording
+        virtual std::vector<DrawCommand> getRecordedDrawCommands() const;
+
+    private:
+
+        // Recorded state of shader program
+        struct Program
+        {
+            std::map<std::string, int> uniformLocations;
+            std::map<int, std::string> uniformNames;
+            std::map<std::string, int> attributeLocations;
+            std::map<std::string, std::vector<float> > uniformValues;
+            std::map<std::string, uint> blockBindings;
+        };
+
+        // Region of buffer bound to binding point of uniform blocks, in floats
+        struct UniformBufferRange
+        {
+            uint buffer;
+            uint first;
+            uint count;
+        };
+
+        // Collect names following given qualifier and type in shader source
+        std::vector<std::string> extractNames(char const * pSource, std::string qualifier) const;
+
+        // Collect names of uniform blocks in shader source
+        std::vector<std::string> extractBlockNames(char const * pSource) const;
+
+        // Set value of uniform in currently used program
+        void setUniform(int location, float const * pValues, int count);
+
+        // Members
+        uint mNextHandle;
+        std::map<uint, Program> mPrograms;
+        uint mCurrentProgram;
+        uint mCurrentVertexArray;
+        std::map<uint, uint> mBoundTextures;
+        std::map<uint, std::vector<float> > mBufferData;
+        std::map<uint, UniformBufferRange> mBoundUniformBuffers;
+        std::vector<DrawCommand> mDrawCommands;
+        std::vector<DrawCommand> mLastFrameDrawCommands;
+    };
+}
+
+#endif // RECORDING_BACKEND_H_
@@ -0,0 +1,271 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Abstract render backend. All rendering related classes like shaders, meshes,
+// render items, textures, fonts and text flows talk only through this
+// interface to the graphics API. This way, updating and drawing of the GUI
+// can be executed without any window or context, e.g. for profiling.
+
+#ifndef RENDER_BACKEND_H_
+#define RENDER_BACKEND_H_
+
+#include "eyeGUI.h"
+#include "Defines.h"
+#include "RenderStateCache.h"
+
+#include "externals/GLM/glm/glm.hpp"
+
+#include <string>
+#include <map>
+#include <vector>
+
+namespace eyegui
+{
+    class RenderBackend
+    {
+    public:
+
+        // Primitive used for drawing
+        enum class Primitive
+        {
+            TRIANGLES, LINES
+        };
+
+        // Pixel format of texture data
+        enum class PixelFormat
+        {
+            RED, RGB, RGBA
+        };
+
+        // Filter of texture (mipmaps are generated for LINEAR_MIPMAP)
+        enum class TextureFilter
+        {
+            NEAREST, LINEAR, LINEAR_MIPMAP
+        };
+
+        // Wrapping of texture
+        enum class TextureWrap
+        {
+            CLAMP, MIRROR, REPEAT
+        };
+
+        // Blending of drawn colors with framebuffer
+        enum class Blending
+        {
+            ALPHA, PREMULTIPLIED
+        };
+
+        // Region of texture copied to position in other texture
+        struct TextureRegionCopy
+        {
+            int sourceX;
+            int sourceY;
+            int targetX;
+            int targetY;
+            int width;
+            int height;
+        };
+
+        // Constructor, state cache is consulted before binding program, vertex array object or texture
+        RenderBackend(RenderStateCache* pStateCache)
+        {
+            mpStateCache = pStateCache;
+            resetCounters();
+        }
+
+        // Destructor
+        virtual ~RenderBackend() {}
+
+        // Initialization (called once before any other method)
+        virtual void init() = 0;
+
+        // Begin frame and setup state for rendering
+        virtual void beginFrame(int viewportX, int viewportY, int viewportWidth, int viewportHeight) = 0;
+
+        // End frame and restore state of application
+        virtual void endFrame() = 0;
+
+        // Set which state of application is saved at begin and restored at end of frame
+        virtual void setStateRestoration(StateRestoration restoration) {}
+
+        // *** Shader programs ***
+
+        // Create shader program from sources, returns handle
+        virtual uint createShaderProgram(char const * pVertexShaderSource, char const * pFragmentShaderSource) = 0;
+
+        // Delete shader program
+        virtual void deleteShaderProgram(uint program) = 0;
+
+        // Get locations of all active uniforms in program
+        virtual std::map<std::string, int> getUniformLocations(uint program) = 0;
+
+        // Get location of vertex attribute in program
+        virtual int getAttributeLocation(uint program, std::string name) = 0;
+
+        // Use shader program for filling uniforms and rendering
+        virtual void useProgram(uint program) = 0;
+
+        // Connect uniform block of program with binding point (ignored if block is not active)
+        virtual void setUniformBlockBinding(uint program, std::string blockName, uint bindingPoint) = 0;
+
+        // Fill uniform of currently used program
+        virtual void setUniform(int location, const int rValue) = 0;
+        virtual void setUniform(int location, const float rValue) = 0;
+        virtual void setUniform(int location, const glm::vec2& rValue) = 0;
+        virtual void setUniform(int location, const glm::vec3& rValue) = 0;
+        virtual void setUniform(int location, const glm::vec4& rValue) = 0;
+        virtual void setUniform(int location, const glm::mat4& rValue) = 0;
+
+        // *** Buffers ***
+
+        // Create buffer, returns handle
+        virtual uint createBuffer() = 0;
+
+        // Fill data into buffer
+        virtual void fillBuffer(uint buffer, void const * pData, uint byteCount, bool dynamic) = 0;
+
+        // Update region of buffer, which must have been filled with sufficient size before
+        virtual void updateBuffer(uint buffer, uint byteOffset, void const * pData, uint byteCount) = 0;
+
+        // Bind region of buffer to binding point of uniform blocks. Offset must be
+        // multiple of uniform buffer offset alignment
+        virtual void bindUniformBuffer(uint buffer, uint bindingPoint, uint byteOffset, uint byteCount) = 0;
+
+        // Get alignment of offsets when binding regions of uniform buffers
+        virtual uint getUniformBufferOffsetAlignment() = 0;
+
+        // Delete buffer
+        virtual void deleteBuffer(uint buffer) = 0;
+
+        // *** Vertex array objects ***
+
+        // Create vertex array object, returns handle
+        virtual uint createVertexArray() = 0;
+
+        // Connect buffer with attribute location of vertex array object
+        virtual void setVertexAttribute(uint vertexArray, int location, uint buffer, int componentCount) = 0;
+
+        // Connect buffer with attribute location of vertex array object, advanced once per
+        // instance. Stride and offset are in bytes
+        virtual void setInstanceAttribute(uint vertexArray, int location, uint buffer, int componentCount, uint stride, uint offset) = 0;
+
+        // Bind vertex array object for rendering
+        virtual void bindVertexArray(uint vertexArray) = 0;
+
+        // Delete vertex array object
+        virtual void deleteVertexArray(uint vertexArray) = 0;
+
+        // *** Textures ***
+
+        // Create texture, returns handle
+        virtual uint createTexture() = 0;
+
+        // Fill whole texture with data (data may be NULL to only allocate memory)
+        virtual void fillTexture(
+            uint texture,
+            int width,
+            int height,
+            PixelFormat format,
+            uchar const * pData,
+            TextureFilter minFilter,
+            TextureFilter magFilter,
+            TextureWrap wrap) = 0;
+
+        // Fill region of texture with data
+        virtual void fillTextureRegion(
+            uint texture,
+            int x,
+            int y,
+            int width,
+            int height,
+            PixelFormat format,
+            uchar const * pData) = 0;
+
+        // Copy regions between textures of same format without reading them back. Textures
+        // must be filled before and must differ, mipmaps of target are not updated
+        virtual void copyTextureRegions(
+            uint sourceTexture,
+            uint targetTexture,
+            const std::vector<TextureRegionCopy>& rRegions) = 0;
+
+        // Generate mipmaps of texture again, after regions were filled. Levels
+        // deeper than given one are neither generated nor sampled
+        virtual void generateMipmaps(uint texture, int maxLevel) = 0;
+
+        // Bind texture to slot
+        virtual void bindTexture(uint texture, uint slot = 0) = 0;
+
+        // Delete texture
+        virtual void deleteTexture(uint texture) = 0;
+
+        // Get maximal supported size of textures
+        virtual int getMaxTextureSize() = 0;
+
+        // *** Framebuffers ***
+
+        // Create framebuffer rendering into texture, which must be filled before. Returns handle
+        virtual uint createFramebuffer(uint texture) = 0;
+
+        // Render into framebuffer until end is called. Framebuffer is cleared and
+        // colors are written premultiplied with alpha, ready to be composited
+        virtual void beginFramebuffer(uint framebuffer, int width, int height) = 0;
+
+        // Render into framebuffer of application again
+        virtual void endFramebuffer() = 0;
+
+        // Delete framebuffer
+        virtual void deleteFramebuffer(uint framebuffer) = 0;
+
+        // Set blending of following draw calls (alpha blending is set at begin of frame)
+        virtual void setBlending(Blending blending) = 0;
+
+        // *** Drawing ***
+
+        // Draw with bound program, vertex array object and textures, beginning at first vertex
+        virtual void drawArrays(Primitive primitive, uint vertexCount, uint firstVertex = 0) = 0;
+
+        // Draw multiple instances with bound program, vertex array object and textures
+        virtual void drawArraysInstanced(Primitive primitive, uint vertexCount, uint instanceCount) = 0;
+
+        // *** Recording ***
+
+        // Get draw commands recorded during last frame (empty if not supported)
+        virtual std::vector<DrawCommand> getRecordedDrawCommands() const { return std::vector<DrawCommand>(); }
+
+        // *** Counters ***
+
+        // Reset counters of draw calls, shader binds, texture binds and state queries
+        void resetCounters()
+        {
+            mDrawCallCount = 0;
+            mShaderBindCount = 0;
+            mTextureBindCount = 0;
+            mStateQueryCount = 0;
+            mAvoidedStateQueryCount = 0;
+        }
+
+        // Getter for counters since last reset
+        uint getDrawCallCount() const { return mDrawCallCount; }
+        uint getShaderBindCount() const { return mShaderBindCount; }
+        uint getTextureBindCount() const { return mTextureBindCount; }
+        uint getStateQueryCount() const { return mStateQueryCount; }
+        uint getAvoidedStateQueryCount() const { return mAvoidedStateQueryCount; }
+
+    protected:
+
+        // Cache of bound state, consulted by implementations
+        RenderStateCache* mpStateCache;
+
+        // Counters, incremented by implementations
+        uint mDrawCallCount;
+        uint mShaderBindCount;
+        uint mTextureBindCount;
+        uint mStateQueryCount;
+        uint mAvoidedStateQueryCount;
+    };
+}
+
+#endif // RENDER_BACKEND_H_
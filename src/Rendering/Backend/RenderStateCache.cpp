@@ -0,0 +1,146 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "RenderStateCache.h"
+
+namespace eyegui
+{
+    // Value of state which is not known
+    static const uint UNKNOWN = 0xFFFFFFFF;
+
+    RenderStateCache::RenderStateCache()
+    {
+        // Initialize members
+        mEnabled = true;
+        mInsideFrame = false;
+        invalidate();
+        resetCounters();
+    }
+
+    void RenderStateCache::setEnabled(bool enabled)
+    {
+        mEnabled = enabled;
+        invalidate();
+    }
+
+    void RenderStateCache::beginFrame()
+    {
+        invalidate();
+        mInsideFrame = true;
+    }
+
+    void RenderStateCache::endFrame()
+    {
+        invalidate();
+        mInsideFrame = false;
+    }
+
+    bool RenderStateCache::changeProgram(uint program)
+    {
+        return change(mProgram, program);
+    }
+
+    bool RenderStateCache::changeVertexArray(uint vertexArray)
+    {
+        return change(mVertexArray, vertexArray);
+    }
+
+    bool RenderStateCache::changeArrayBuffer(uint buffer)
+    {
+        return change(mArrayBuffer, buffer);
+    }
+
+    bool RenderStateCache::changeActiveSlot(uint slot)
+    {
+        return change(mActiveSlot, slot);
+    }
+
+    bool RenderStateCache::changeTexture(uint slot, uint texture)
+    {
+        if (slot >= mTextures.size())
+        {
+            mTextures.resize(slot + 1, UNKNOWN);
+        }
+        return change(mTextures[slot], texture);
+    }
+
+    bool RenderStateCache::changeUnpackAlignment(uint alignment)
+    {
+        return change(mUnpackAlignment, alignment);
+    }
+
+    void RenderStateCache::forgetProgram(uint program)
+    {
+        if (mProgram == program)
+        {
+            mProgram = UNKNOWN;
+        }
+    }
+
+    void RenderStateCache::forgetVertexArray(uint vertexArray)
+    {
+        if (mVertexArray == vertexArray)
+        {
+            mVertexArray = UNKNOWN;
+        }
+    }
+
+    void RenderStateCache::forgetArrayBuffer(uint buffer)
+    {
+        if (mArrayBuffer == buffer)
+        {
+            mArrayBuffer = UNKNOWN;
+        }
+    }
+
+    void RenderStateCache::forgetTexture(uint texture)
+    {
+        for (uint& rTexture : mTextures)
+        {
+            if (rTexture == texture)
+            {
+                rTexture = UNKNOWN;
+            }
+        }
+    }
+
+    void RenderStateCache::resetCounters()
+    {
+        mIssuedCount = 0;
+        mSkippedCount = 0;
+    }
+
+    void RenderStateCache::invalidate()
+    {
+        mProgram = UNKNOWN;
+        mVertexArray = UNKNOWN;
+        mArrayBuffer = UNKNOWN;
+        mActiveSlot = UNKNOWN;
+        mTextures.assign(mTextures.size(), UNKNOWN);
+        mUnpackAlignment = UNKNOWN;
+    }
+
+    bool RenderStateCache::change(uint& rKnown, uint value)
+    {
+        // Outside of frames, nothing is counted or remembered
+        if (!mInsideFrame)
+        {
+            return true;
+        }
+
+        // Skip if value is already set
+        if (mEnabled && rKnown == value)
+        {
+            mSkippedCount++;
+            return false;
+        }
+
+        rKnown = value;
+        mIssuedCount++;
+        return true;
+    }
+}
@@ -0,0 +1,85 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Tracker of bound program, vertex array object, array buffer, textures and
+// unpack alignment. Owned by GUI
+// and consulted by the render backend before changing state. Between begin
+// and end of a frame, changes to the already bound state are skipped. Outside
+// of frames, the application may change state at will, so everything is
+// forgotten and every change is issued.
+
+#ifndef RENDER_STATE_CACHE_H_
+#define RENDER_STATE_CACHE_H_
+
+#include "Defines.h"
+
+#include <vector>
+
+namespace eyegui
+{
+    class RenderStateCache
+    {
+    public:
+
+        // Constructor
+        RenderStateCache();
+
+        // Enable or disable filtering of redundant changes
+        void setEnabled(bool enabled);
+
+        // Frame begins, state set by application is unknown
+        void beginFrame();
+
+        // Frame ends, application may change state afterwards
+        void endFrame();
+
+        // Is frame running, so state of application is saved by setup of frame
+        bool isInsideFrame() const { return mInsideFrame; }
+
+        // Returns whether change must be issued to graphics API
+        bool changeProgram(uint program);
+        bool changeVertexArray(uint vertexArray);
+        bool changeArrayBuffer(uint buffer);
+        bool changeActiveSlot(uint slot);
+        bool changeTexture(uint slot, uint texture);
+        bool changeUnpackAlignment(uint alignment);
+
+        // Forget deleted objects, as their handles may be reused
+        void forgetProgram(uint program);
+        void forgetVertexArray(uint vertexArray);
+        void forgetArrayBuffer(uint buffer);
+        void forgetTexture(uint texture);
+
+        // Reset counters of issued and skipped changes
+        void resetCounters();
+
+        // Getter for counters since last reset
+        uint getIssuedCount() const { return mIssuedCount; }
+        uint getSkippedCount() const { return mSkippedCount; }
+
+    private:
+
+        // Forget all known state
+        void invalidate();
+
+        // Compare known state with new value and remember it
+        bool change(uint& rKnown, uint value);
+
+        // Members
+        bool mEnabled;
+        bool mInsideFrame;
+        uint mProgram;
+        uint mVertexArray;
+        uint mArrayBuffer;
+        uint mActiveSlot;
+        std::vector<uint> mTextures; // Bound texture per slot
+        uint mUnpackAlignment;
+        uint mIssuedCount;
+        uint mSkippedCount;
+    };
+}
+
+#endif // RENDER_STATE_CACHE_H_
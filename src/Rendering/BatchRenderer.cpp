@@ -0,0 +1,336 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "BatchRenderer.h"
+
+#include "GUI.h"
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace eyegui
+{
+    BatchRenderer::BatchRenderer(GUI const * pGUI, AssetManager* pAssetManager, RenderBackend* pBackend)
+    {
+        // Initialize members
+        mpGUI = pGUI;
+        mpAssetManager = pAssetManager;
+        mpBackend = pBackend;
+        mpQuad = mpAssetManager->fetchMesh(meshes::Type::QUAD);
+        mInstancing = true;
+        mDepth = 0;
+        mInstanceBuffer = mpBackend->createBuffer();
+        mQuadBlockBuffer = mpBackend->createBuffer();
+
+        // Slots of uniform block buffer must respect alignment of offsets
+        uint alignment = std::max(mpBackend->getUniformBufferOffsetAlignment(), (uint)1);
+        mQuadBlockStride = ((uint)sizeof(QuadInstance) + alignment - 1) / alignment * alignment;
+        mQuadBlockSlot = QUAD_BLOCK_SLOTS; // Buffer is allocated at first usage
+    }
+
+    BatchRenderer::~BatchRenderer()
+    {
+        for (auto& rPair : mBatches)
+        {
+            mpBackend->deleteVertexArray(rPair.second.vertexArray);
+        }
+        mpBackend->deleteBuffer(mInstanceBuffer);
+        mpBackend->deleteBuffer(mQuadBlockBuffer);
+    }
+
+    void BatchRenderer::setInstancing(bool instancing)
+    {
+        flush();
+        mInstancing = instancing;
+    }
+
+    void BatchRenderer::drawQuad(shaders::Type shader, const QuadInstance& rInstance, Texture const * pTexture)
+    {
+        if (!mInstancing)
+        {
+            drawImmediately(shader, rInstance, pTexture);
+            return;
+        }
+
+        // Collect instance for flush
+        Entry entry;
+        entry.depth = mDepth;
+        entry.sublayer = (shader == shaders::Type::SEPARATOR) ? Sublayer::SEPARATOR : Sublayer::BODY;
+        entry.shader = shader;
+        entry.instance = (uint)mInstances.size();
+        entry.pTexture = pTexture;
+        entry.pTextFlow = NULL;
+        mEntries.push_back(entry);
+        mInstances.push_back(rInstance);
+    }
+
+    void BatchRenderer::drawText(TextFlow const * pTextFlow, float scale, glm::vec4 color)
+    {
+        if (!mInstancing)
+        {
+            pTextFlow->draw(scale, color);
+            return;
+        }
+
+        // Remember text flow, drawn at flush between the quads
+        Entry entry;
+        entry.depth = mDepth;
+        entry.sublayer = Sublayer::TEXT;
+        entry.shader = shaders::Type::FONT;
+        entry.instance = 0;
+        entry.pTexture = NULL;
+        entry.pTextFlow = pTextFlow;
+        entry.textScale = scale;
+        entry.textColor = color;
+        mEntries.push_back(entry);
+    }
+
+    void BatchRenderer::flush()
+    {
+        if (mEntries.empty())
+        {
+            return;
+        }
+
+        // Pages of icon atlas need mipmaps of icons added since last flush
+        mpAssetManager->updateIconAtlas();
+
+        // Sort by depth, sublayer and shader. Stable sort keeps order of drawing within
+        std::stable_sort(mEntries.begin(), mEntries.end(),
+            [](const Entry& rA, const Entry& rB)
+        {
+            if (rA.depth != rB.depth) { return rA.depth < rB.depth; }
+            if (rA.sublayer != rB.sublayer) { return rA.sublayer < rB.sublayer; }
+            return (int)rA.shader < (int)rB.shader;
+        });
+
+        // Go over runs of entries with same key
+        uint begin = 0;
+        while (begin < mEntries.size())
+        {
+            const Entry& rFirst = mEntries[begin];
+            if (rFirst.pTextFlow != NULL)
+            {
+                // Text is drawn on its own
+                rFirst.pTextFlow->draw(rFirst.textScale, rFirst.textColor);
+                begin++;
+                continue;
+            }
+
+            // Find end of run
+            uint end = begin + 1;
+            while (end < mEntries.size()
+                && mEntries[end].depth == rFirst.depth
+                && mEntries[end].sublayer == rFirst.sublayer
+                && mEntries[end].shader == rFirst.shader)
+            {
+                end++;
+            }
+
+            drawInstanced(rFirst.shader, begin, end);
+            begin = end;
+        }
+
+        // Keep memory for next frame
+        mEntries.clear();
+        mInstances.clear();
+    }
+
+    void BatchRenderer::drawImmediately(shaders::Type shader, const QuadInstance& rInstance, Texture const * pTexture)
+    {
+        // Icon may be placed in page of icon atlas
+        QuadInstance instance = rInstance;
+        if (pTexture != NULL)
+        {
+            mpAssetManager->updateIconAtlas();
+            instance.iconRect = pTexture->getAtlasRect();
+        }
+
+        // Bind render item before setting values and drawing
+        RenderItem const * pRenderItem = mpAssetManager->fetchRenderItem(shader, meshes::Type::QUAD);
+        pRenderItem->bind();
+        Shader const * pShader = pRenderItem->getShader();
+
+        // Each quad uses its own slot, so no update waits for preceding draw calls.
+        // When all slots are used, buffer is orphaned by allocating it again
+        if (mQuadBlockSlot >= QUAD_BLOCK_SLOTS)
+        {
+            mpBackend->fillBuffer(mQuadBlockBuffer, NULL, QUAD_BLOCK_SLOTS * mQuadBlockStride, true);
+            mQuadBlockSlot = 0;
+        }
+        uint offset = mQuadBlockSlot * mQuadBlockStride;
+        mQuadBlockSlot++;
+
+        // Upload all values of quad at once into uniform block
+        mpBackend->updateBuffer(mQuadBlockBuffer, offset, &instance, sizeof(QuadInstance));
+        mpBackend->bindUniformBuffer(mQuadBlockBuffer, shaders::QUAD_BLOCK_BINDING, offset, sizeof(QuadInstance));
+        pShader->fillValue(shaders::Uniform::TIME, mpGUI->getAccPeriodicTime());
+
+        // Bind icon texture
+        if (pTexture != NULL)
+        {
+            pTexture->bind(0);
+        }
+
+        // Draw render item
+        pRenderItem->draw();
+    }
+
+    void BatchRenderer::drawInstanced(shaders::Type shader, uint begin, uint end)
+    {
+        Batch const & rBatch = fetchBatch(shader);
+
+        // Bind shader and vertex array object once for all instances
+        rBatch.pShader->bind();
+        mpBackend->bindVertexArray(rBatch.vertexArray);
+        rBatch.pShader->fillValue(shaders::Uniform::TIME, mpGUI->getAccPeriodicTime());
+
+        // Collect instances until all texture slots are occupied
+        mUploadedInstances.clear();
+        mSlotTextures.clear();
+        for (uint i = begin; i <= end; i++)
+        {
+            // Decide slot of texture, icons in same page of atlas share it
+            int slot = 0;
+            bool slotFound = true;
+            uint texture = 0;
+            if (i < end && mEntries[i].pTexture != NULL)
+            {
+                texture = mEntries[i].pTexture->getTextureHandle();
+                auto it = std::find(mSlotTextures.begin(), mSlotTextures.end(), texture);
+                if (it != mSlotTextures.end())
+                {
+                    slot = (int)(it - mSlotTextures.begin());
+                }
+                else if ((int)mSlotTextures.size() < shaders::INSTANCED_ICON_SLOTS)
+                {
+                    slot = (int)mSlotTextures.size();
+                    mSlotTextures.push_back(texture);
+                }
+                else
+                {
+                    slotFound = false;
+                }
+            }
+
+            // Draw collected instances at end or when slots are exhausted
+            if ((i == end || !slotFound) && !mUploadedInstances.empty())
+            {
+                for (uint j = 0; j < mSlotTextures.size(); j++)
+                {
+                    mpBackend->bindTexture(mSlotTextures[j], j);
+                }
+                mpBackend->fillBuffer(
+                    mInstanceBuffer,
+                    mUploadedInstances.data(),
+                    (uint)(mUploadedInstances.size() * sizeof(QuadInstance)),
+                    true);
+                mpBackend->drawArraysInstanced(
+                    RenderBackend::Primitive::TRIANGLES,
+                    mpQuad->getVertexCount(),
+                    (uint)mUploadedInstances.size());
+                mUploadedInstances.clear();
+
+                // Start over with texture of current entry
+                if (!slotFound)
+                {
+                    mSlotTextures.clear();
+                    mSlotTextures.push_back(texture);
+                    slot = 0;
+                }
+            }
+
+            // Add instance of entry
+            if (i < end)
+            {
+                mUploadedInstances.push_back(mInstances[mEntries[i].instance]);
+                mUploadedInstances.back().icon.w = (float)slot;
+                if (mEntries[i].pTexture != NULL)
+                {
+                    mUploadedInstances.back().iconRect = mEntries[i].pTexture->getAtlasRect();
+                }
+            }
+        }
+    }
+
+    BatchRenderer::Batch const & BatchRenderer::fetchBatch(shaders::Type shader)
+    {
+        auto it = mBatches.find(shader);
+        if (it != mBatches.end())
+        {
+            return it->second;
+        }
+
+        Batch batch;
+        batch.pShader = mpAssetManager->fetchInstancedShader(shader);
+        batch.vertexArray = mpBackend->createVertexArray();
+
+        // Vertices and texture coordinates of quad
+        mpBackend->setVertexAttribute(
+            batch.vertexArray,
+            batch.pShader->getAttributeLocation("posAttribute"),
+            mpQuad->getVertexBuffer(),
+            3);
+        mpBackend->setVertexAttribute(
+            batch.vertexArray,
+            batch.pShader->getAttributeLocation("uvAttribute"),
+            mpQuad->getTextureCoordinateBuffer(),
+            2);
+
+        // Matrix occupies four locations, one per column
+        uint stride = sizeof(QuadInstance);
+        int matrixLocation = batch.pShader->getAttributeLocation("instanceMatrix");
+        if (matrixLocation >= 0)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                mpBackend->setInstanceAttribute(
+                    batch.vertexArray,
+                    matrixLocation + i,
+                    mInstanceBuffer,
+                    4,
+                    stride,
+                    (uint)(offsetof(QuadInstance, matrix) + i * sizeof(glm::vec4)));
+            }
+        }
+
+        // Vectors
+        const std::pair<std::string, uint> vectors[] =
+        {
+            { "instanceColor", (uint)offsetof(QuadInstance, color) },
+            { "instanceHighlightColor", (uint)offsetof(QuadInstance, highlightColor) },
+            { "instanceSelectionColor", (uint)offsetof(QuadInstance, selectionColor) },
+            { "instanceIconColor", (uint)offsetof(QuadInstance, iconColor) },
+            { "instanceDimColor", (uint)offsetof(QuadInstance, dimColor) },
+            { "instanceState", (uint)offsetof(QuadInstance, state) },
+            { "instanceInteraction", (uint)offsetof(QuadInstance, interaction) },
+            { "instanceIcon", (uint)offsetof(QuadInstance, icon) },
+            { "instanceIconRect", (uint)offsetof(QuadInstance, iconRect) }
+        };
+        for (const auto& rVector : vectors)
+        {
+            mpBackend->setInstanceAttribute(
+                batch.vertexArray,
+                batch.pShader->getAttributeLocation(rVector.first),
+                mInstanceBuffer,
+                4,
+                stride,
+                rVector.second);
+        }
+
+        // Each icon sampler reads its own texture slot
+        batch.pShader->bind();
+        for (int i = 0; i < shaders::INSTANCED_ICON_SLOTS; i++)
+        {
+            batch.pShader->fillValue((shaders::Uniform)((int)shaders::Uniform::ICON_0 + i), i);
+        }
+
+        mBatches[shader] = batch;
+        return mBatches[shader];
+    }
+}
@@ -0,0 +1,153 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Renderer for quads of elements like blocks, pictures, buttons, sensors and
+// separators. Owned by GUI and reachable by elements through their layout.
+// With instancing, quads are collected during the walk through the element
+// tree and drawn at flush with one instanced draw call per depth in the tree
+// and shader type. Elements in the same depth do not overlap, so sorting by
+// depth keeps the order of drawing. Text is drawn in between at its position.
+// Without instancing, every quad is drawn immediately, getting its values
+// through one upload into a uniform block.
+
+#ifndef BATCH_RENDERER_H_
+#define BATCH_RENDERER_H_
+
+#include "Rendering/AssetManager.h"
+#include "Rendering/Backend/RenderBackend.h"
+
+#include "externals/GLM/glm/glm.hpp"
+
+#include <vector>
+#include <map>
+
+namespace eyegui
+{
+    // Forward declaration
+    class GUI;
+
+    // Values of one quad, shared by all shaders of elements. Consists only of
+    // vectors and matrices with four components, so it can be uploaded as it is,
+    // either as instance attributes or into uniform block with std140 layout
+    struct QuadInstance
+    {
+        // Constructor
+        QuadInstance() :
+            matrix(1.0f),
+            color(0.0f),
+            highlightColor(0.0f),
+            selectionColor(0.0f),
+            iconColor(0.0f),
+            dimColor(0.0f),
+            state(0.0f),
+            interaction(0.0f),
+            icon(1.0f, 1.0f, 0.0f, 0.0f),
+            iconRect(0.0f, 0.0f, 1.0f, 1.0f) {}
+
+        glm::mat4 matrix;
+        glm::vec4 color; // Color of buttons, background color of blocks or separator color
+        glm::vec4 highlightColor;
+        glm::vec4 selectionColor;
+        glm::vec4 iconColor;
+        glm::vec4 dimColor;
+        glm::vec4 state; // Alpha, activity, dimming and highlight
+        glm::vec4 interaction; // Selection, threshold, pressing and penetration
+        glm::vec4 icon; // Scale of icon uv, orientation and texture slot (slot is set by renderer)
+        glm::vec4 iconRect; // Offset and scale of icon uv in texture, set by renderer for pages of icon atlas
+    };
+    static_assert(sizeof(QuadInstance) == 208, "QuadInstance must match std140 layout of uniform block");
+
+    class BatchRenderer
+    {
+    public:
+
+        // Constructor
+        BatchRenderer(GUI const * pGUI, AssetManager* pAssetManager, RenderBackend* pBackend);
+
+        // Destructor
+        virtual ~BatchRenderer();
+
+        // Enable or disable instancing (flushes collected quads)
+        void setInstancing(bool instancing);
+
+        // Is instancing enabled
+        bool isInstancing() const { return mInstancing; }
+
+        // Element drawing starts, following quads are one level deeper in tree
+        void enterElement() { mDepth++; }
+
+        // Element drawing ends
+        void leaveElement() { mDepth--; }
+
+        // Draw quad with shader of element and optional texture for icon
+        void drawQuad(shaders::Type shader, const QuadInstance& rInstance, Texture const * pTexture = NULL);
+
+        // Draw text flow at current position in order of drawing
+        void drawText(TextFlow const * pTextFlow, float scale, glm::vec4 color);
+
+        // Draw everything collected so far
+        void flush();
+
+    private:
+
+        // Count of slots in buffer of uniform block before it is orphaned
+        static const uint QUAD_BLOCK_SLOTS = 256;
+
+        // Order of drawing inside one depth of the tree
+        enum class Sublayer
+        {
+            BODY, SEPARATOR, TEXT
+        };
+
+        // Collected quad or text
+        struct Entry
+        {
+            int depth;
+            Sublayer sublayer;
+            shaders::Type shader;
+            uint instance;
+            Texture const * pTexture;
+            TextFlow const * pTextFlow;
+            float textScale;
+            glm::vec4 textColor;
+        };
+
+        // Instanced shader and vertex array object per shader type
+        struct Batch
+        {
+            Shader const * pShader;
+            uint vertexArray;
+        };
+
+        // Draw quad immediately by updating uniform block
+        void drawImmediately(shaders::Type shader, const QuadInstance& rInstance, Texture const * pTexture);
+
+        // Draw instances of entries in range, all sharing one shader type
+        void drawInstanced(shaders::Type shader, uint begin, uint end);
+
+        // Get batch of shader type, created at first usage
+        Batch const & fetchBatch(shaders::Type shader);
+
+        // Members
+        GUI const * mpGUI;
+        AssetManager* mpAssetManager;
+        RenderBackend* mpBackend;
+        Mesh const * mpQuad;
+        bool mInstancing;
+        int mDepth;
+        std::vector<QuadInstance> mInstances;
+        std::vector<Entry> mEntries;
+        std::vector<QuadInstance> mUploadedInstances;
+        std::vector<uint> mSlotTextures; // Handles, so icons sharing page of atlas share slot
+        std::map<shaders::Type, Batch> mBatches;
+        uint mInstanceBuffer;
+        uint mQuadBlockBuffer;
+        uint mQuadBlockStride;
+        uint mQuadBlockSlot;
+    };
+}
+
+#endif // BATCH_RENDERER_H_
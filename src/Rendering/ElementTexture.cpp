@@ -0,0 +1,128 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "ElementTexture.h"
+
+#include "Helper.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    ElementTexture::ElementTexture(AssetManager* pAssetManager)
+    {
+        // Initialize members
+        mpAssetManager = pAssetManager;
+        mVectorGraphics = false;
+        mpTexture = NULL;
+        mpPendingTexture = NULL;
+        mRequestedSize = 0;
+        mAspectRatio = 0;
+    }
+
+    ElementTexture::~ElementTexture()
+    {
+        release();
+    }
+
+    void ElementTexture::set(std::string filepath)
+    {
+        // Acquire new texture before releasing old one, as they may be the same. Vector
+        // graphics show placeholder until rasterized for the size known at update
+        bool vectorGraphics = checkFileNameExtension(filepath, "svg");
+        Texture const * pTexture = NULL;
+        if (filepath == EMPTY_STRING_ATTRIBUTE)
+        {
+            pTexture = mpAssetManager->fetchTexture(graphics::Type::NOT_FOUND);
+        }
+        else if (vectorGraphics)
+        {
+            pTexture = mpAssetManager->fetchTexture(graphics::Type::PLACEHOLDER);
+        }
+        else
+        {
+            pTexture = mpAssetManager->acquireTexture(filepath);
+        }
+        release();
+
+        mFilepath = filepath;
+        mVectorGraphics = vectorGraphics;
+        mpTexture = pTexture;
+        mRequestedSize = 0;
+        mAspectRatio = 0;
+    }
+
+    bool ElementTexture::update(int width, int height)
+    {
+        bool changed = false;
+
+        // Only vector graphics are rasterized for their size
+        if (mVectorGraphics && width > 0 && height > 0)
+        {
+            // Request rasterization when size changed
+            uint size = mpAssetManager->getVectorGraphicsSize(width, height);
+            if (size != mRequestedSize)
+            {
+                Texture const * pPendingTexture = mpAssetManager->acquireTexture(mFilepath, size);
+                if (mpPendingTexture != NULL)
+                {
+                    mpAssetManager->releaseTexture(mpPendingTexture);
+                }
+                mpPendingTexture = pPendingTexture;
+                mRequestedSize = size;
+            }
+
+            // Use pending texture when rasterized
+            if (mpPendingTexture != NULL && mpPendingTexture->isLoaded())
+            {
+                mpAssetManager->releaseTexture(mpTexture);
+                mpTexture = mpPendingTexture;
+                mpPendingTexture = NULL;
+                changed = true;
+            }
+        }
+
+        // Remember aspect ratio when image is loaded, rasterizations may round it differently.
+        // Image decoded in background replaces placeholder, so element has to be drawn again
+        if (mAspectRatio == 0 && mpTexture->isLoaded())
+        {
+            mAspectRatio = mpTexture->getAspectRatio();
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    Texture const * ElementTexture::get() const
+    {
+        return mpTexture;
+    }
+
+    float ElementTexture::getAspectRatio() const
+    {
+        if (mAspectRatio > 0)
+        {
+            return mAspectRatio;
+        }
+        return mpTexture->getAspectRatio();
+    }
+
+    void ElementTexture::release()
+    {
+        // Graphics are ignored by asset manager
+        if (mpTexture != NULL)
+        {
+            mpAssetManager->releaseTexture(mpTexture);
+            mpTexture = NULL;
+        }
+        if (mpPendingTexture != NULL)
+        {
+            mpAssetManager->releaseTexture(mpPendingTexture);
+            mpPendingTexture = NULL;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Texture used by an element, like icon of button or image of picture. Holds
+// reference in asset manager while used. Vector graphics are rasterized again
+// for the size the element is drawn at, rounded up to a power of two. Until
+// rasterization in background is done, the texture used before stays. When
+// the file was just set, a transparent placeholder is shown instead, as the
+// size is not known before the first update.
+
+#ifndef ELEMENT_TEXTURE_H_
+#define ELEMENT_TEXTURE_H_
+
+#include "Rendering/AssetManager.h"
+
+namespace eyegui
+{
+    class ElementTexture
+    {
+    public:
+
+        // Constructor
+        ElementTexture(AssetManager* pAssetManager);
+
+        // Destructor, releases texture
+        virtual ~ElementTexture();
+
+        // Set image file, empty filepath shows that nothing was found
+        void set(std::string filepath);
+
+        // Request rasterization for drawn size in pixels. Returns whether texture changed or finished loading
+        bool update(int width, int height);
+
+        // Get texture for drawing
+        Texture const * get() const;
+
+        // Get aspect ratio of image, independent from size of rasterization
+        float getAspectRatio() const;
+
+    private:
+
+        // Release texture and pending one
+        void release();
+
+        // Members
+        AssetManager* mpAssetManager;
+        std::string mFilepath;
+        bool mVectorGraphics;
+        Texture const * mpTexture;
+        Texture const * mpPendingTexture; // Rasterized for new size in background
+        uint mRequestedSize; // Size of pending texture or texture in use
+        float mAspectRatio; // Zero until image is loaded
+    };
+}
+
+#endif // ELEMENT_TEXTURE_H_
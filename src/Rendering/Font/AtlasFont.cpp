@@ -7,27 +7,120 @@
 
 #include "AtlasFont.h"
 
+#include "SkylinePacker.h"
 #include "OperationNotifier.h"
 #include "Defines.h"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 namespace eyegui
 {
+	// Distance transform of one line with squared distances, after Felzenszwalb and Huttenlocher.
+	// Values are replaced by squared distance to nearest zero. Buffers must hold count plus one values
+	static void transformDistanceLine(float* pValues, int count, std::vector<float>& rDistances, std::vector<int>& rParabolas, std::vector<float>& rBoundaries)
+	{
+		const float infinity = 1e20f;
+		int k = 0;
+		rParabolas[0] = 0;
+		rBoundaries[0] = -infinity;
+		rBoundaries[1] = infinity;
+		for (int q = 1; q < count; q++)
+		{
+			int p = rParabolas[k];
+			float s = ((pValues[q] + (float)(q * q)) - (pValues[p] + (float)(p * p))) / (float)(2 * q - 2 * p);
+			while (s <= rBoundaries[k])
+			{
+				k--;
+				p = rParabolas[k];
+				s = ((pValues[q] + (float)(q * q)) - (pValues[p] + (float)(p * p))) / (float)(2 * q - 2 * p);
+			}
+			k++;
+			rParabolas[k] = q;
+			rBoundaries[k] = s;
+			rBoundaries[k + 1] = infinity;
+		}
+		k = 0;
+		for (int q = 0; q < count; q++)
+		{
+			while (rBoundaries[k + 1] < (float)q)
+			{
+				k++;
+			}
+			int p = rParabolas[k];
+			rDistances[q] = (float)((q - p) * (q - p)) + pValues[p];
+		}
+		std::copy(rDistances.begin(), rDistances.begin() + count, pValues);
+	}
+
+	// Squared distance of every cell of grid to nearest cell with zero
+	static void transformDistanceGrid(std::vector<float>& rGrid, int width, int height)
+	{
+		int count = std::max(width, height);
+		std::vector<float> line(count);
+		std::vector<float> distances(count + 1);
+		std::vector<int> parabolas(count + 1);
+		std::vector<float> boundaries(count + 1);
+		for (int x = 0; x < width; x++)
+		{
+			for (int y = 0; y < height; y++) { line[y] = rGrid[y * width + x]; }
+			transformDistanceLine(line.data(), height, distances, parabolas, boundaries);
+			for (int y = 0; y < height; y++) { rGrid[y * width + x] = line[y]; }
+		}
+		for (int y = 0; y < height; y++)
+		{
+			transformDistanceLine(rGrid.data() + y * width, width, distances, parabolas, boundaries);
+		}
+	}
+
 	AtlasFont::AtlasFont(
+		RenderBackend* pBackend,
+		ThreadPool* pRasterizationPool,
+		FontAtlasCache const * pFontAtlasCache,
 		std::string filepath,
+		FT_Library freeTypeLibrary,
+		uchar const * pFontData,
+		size_t fontDataSize,
 		std::unique_ptr<FT_Face> upFace,
 		std::set<char16_t> characterSet,
-		int windowHeight) : Font()
+		int windowHeight,
+		bool distanceField) : Font()
 	{
 		// Fill members
+		mpBackend = pBackend;
+		mpRasterizationPool = pRasterizationPool;
+		mpFontAtlasCache = pFontAtlasCache;
 		mFilepath = filepath;
+		mFreeTypeLibrary = freeTypeLibrary;
+		mpFontData = pFontData;
+		mFontDataSize = fontDataSize;
 		mupFace = std::move(upFace);
 		mCharacterSet = characterSet;
+		mDistanceField = distanceField;
+		mDistanceFieldFilled = false;
+		mDistanceFieldLinePixelHeight = 0;
+		mTallGlyphGeneration = 0;
+		mMediumGlyphGeneration = 0;
+		mSmallGlyphGeneration = 0;
+
+		// Identify font data and character set for atlases in cache
+		mFontHash = 0;
+		mCharacterSetHash = 0;
+		if (mpFontAtlasCache != NULL)
+		{
+			std::vector<char16_t> characters(mCharacterSet.begin(), mCharacterSet.end());
+			mFontHash = FontAtlasCache::hash(mpFontData, mFontDataSize);
+			mCharacterSetHash = FontAtlasCache::hash(characters.data(), characters.size() * sizeof(char16_t));
+		}
 
 		// Initilialize textures
-		glGenTextures(1, &mTallTexture);
-		glGenTextures(1, &mMediumTexture);
-		glGenTextures(1, &mSmallTexture);
+		mTallTexture = mpBackend->createTexture();
+		mMediumTexture = mpBackend->createTexture();
+		mSmallTexture = mpBackend->createTexture();
+		mDistanceFieldTexture = mpBackend->createTexture();
 
 		// Update pixel heights
 		fillPixelHeights(windowHeight);
@@ -39,12 +132,17 @@ namespace eyegui
 	AtlasFont::~AtlasFont()
 	{
 		// Delete textures
-		glDeleteTextures(1, &mTallTexture);
-		glDeleteTextures(1, &mMediumTexture);
-		glDeleteTextures(1, &mSmallTexture);
+		mpBackend->deleteTexture(mTallTexture);
+		mpBackend->deleteTexture(mMediumTexture);
+		mpBackend->deleteTexture(mSmallTexture);
+		mpBackend->deleteTexture(mDistanceFieldTexture);
 
-		// Delete used face
+		// Delete used faces
 		FT_Done_Face(*(mupFace.get()));
+		for (FT_Face face : mWorkerFaces)
+		{
+			FT_Done_Face(face);
+		}
 	}
 
 	void AtlasFont::resizeFontAtlases(int windowHeight)
@@ -56,6 +154,47 @@ namespace eyegui
 		fillAtlases();
 	}
 
+	void AtlasFont::setDistanceField(bool distanceField, int windowHeight)
+	{
+		if (distanceField == mDistanceField)
+		{
+			return;
+		}
+		mDistanceField = distanceField;
+
+		// Free memory of bitmap atlases, filled again when switching back
+		if (mDistanceField)
+		{
+			for (uint texture : { mTallTexture, mMediumTexture, mSmallTexture })
+			{
+				mpBackend->fillTexture(
+					texture,
+					1,
+					1,
+					RenderBackend::PixelFormat::RED,
+					NULL,
+					RenderBackend::TextureFilter::LINEAR,
+					RenderBackend::TextureFilter::NEAREST,
+					RenderBackend::TextureWrap::CLAMP);
+			}
+			mupTallGlyphCache.reset();
+			mupMediumGlyphCache.reset();
+			mupSmallGlyphCache.reset();
+			mAtlasUsages.erase(mTallTexture);
+			mAtlasUsages.erase(mMediumTexture);
+			mAtlasUsages.erase(mSmallTexture);
+		}
+
+		// Update pixel heights and glyphs
+		fillPixelHeights(windowHeight);
+		fillAtlases();
+	}
+
+	bool AtlasFont::isDistanceField() const
+	{
+		return mDistanceField;
+	}
+
 	Glyph const * AtlasFont::getGlyph(FontSize fontSize, char16_t character) const
 	{
 		Glyph const * pGlyph = NULL;
@@ -63,19 +202,73 @@ namespace eyegui
 		switch (fontSize)
 		{
 		case FontSize::TALL:
-			pGlyph = getGlyph(mTallGlyphs, character);
+			pGlyph = getGlyph(mTallGlyphs, mupTallGlyphCache.get(), mTallPixelHeight, character);
 			break;
 		case FontSize::MEDIUM:
-			pGlyph = getGlyph(mMediumGlyphs, character);
+			pGlyph = getGlyph(mMediumGlyphs, mupMediumGlyphCache.get(), mMediumPixelHeight, character);
 			break;
 		case FontSize::SMALL:
-			pGlyph = getGlyph(mSmallGlyphs, character);
+			pGlyph = getGlyph(mSmallGlyphs, mupSmallGlyphCache.get(), mSmallPixelHeight, character);
 			break;
 		}
 
 		return pGlyph;
 	}
 
+	void AtlasFont::getAtlasPixelCounts(uint& rAtlasPixels, uint& rGlyphPixels) const
+	{
+		rAtlasPixels = 0;
+		rGlyphPixels = 0;
+		for (const auto& rPair : mAtlasUsages)
+		{
+			rAtlasPixels += rPair.second.atlasPixels;
+			rGlyphPixels += rPair.second.glyphPixels;
+		}
+	}
+
+	bool AtlasFont::uploadGlyphs()
+	{
+		// Only text of size whose cache changed has to calculate its meshes again
+		bool outdated = false;
+		if (mupTallGlyphCache != NULL && mupTallGlyphCache->upload())
+		{
+			mTallGlyphGeneration++;
+			outdated = true;
+		}
+		if (mupMediumGlyphCache != NULL && mupMediumGlyphCache->upload())
+		{
+			mMediumGlyphGeneration++;
+			outdated = true;
+		}
+		if (mupSmallGlyphCache != NULL && mupSmallGlyphCache->upload())
+		{
+			mSmallGlyphGeneration++;
+			outdated = true;
+		}
+		if (mupDistanceFieldGlyphCache != NULL && mupDistanceFieldGlyphCache->upload())
+		{
+			mTallGlyphGeneration++;
+			mMediumGlyphGeneration++;
+			mSmallGlyphGeneration++;
+			outdated = true;
+		}
+		return outdated;
+	}
+
+	uint AtlasFont::getGlyphGeneration(FontSize fontSize) const
+	{
+		switch (fontSize)
+		{
+		case FontSize::TALL:
+			return mTallGlyphGeneration;
+		case FontSize::MEDIUM:
+			return mMediumGlyphGeneration;
+		case FontSize::SMALL:
+			return mSmallGlyphGeneration;
+		}
+		return 0;
+	}
+
 	float AtlasFont::getLineHeight(FontSize fontSize) const
 	{
 		// Values seems to be not correct (not depending on bitmap size)
@@ -106,8 +299,14 @@ namespace eyegui
 		}
 	}
 
-	GLuint AtlasFont::getAtlasTextureHandle(FontSize fontSize) const
+	uint AtlasFont::getAtlasTextureHandle(FontSize fontSize) const
 	{
+		// All sizes share distance field atlas
+		if (mDistanceField)
+		{
+			return mDistanceFieldTexture;
+		}
+
 		switch (fontSize)
 		{
 		case FontSize::TALL:
@@ -122,21 +321,79 @@ namespace eyegui
 		}
 	}
 
-	Glyph const * AtlasFont::getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const
+	Glyph const * AtlasFont::getGlyph(
+		std::map<char16_t, Glyph>& rGlyphMap,
+		GlyphCache* pGlyphCache,
+		int pixelHeight,
+		char16_t character) const
 	{
-		auto it = rGlyphMap.find(character);
+		// Distance fields of all sizes share one cache
+		if (mDistanceField)
+		{
+			pGlyphCache = mupDistanceFieldGlyphCache.get();
+		}
 
+		// Glyph of character set or rasterized before
+		auto it = rGlyphMap.find(character);
 		if (it != rGlyphMap.end())
 		{
+			if (pGlyphCache != NULL)
+			{
+				pGlyphCache->touch(character);
+			}
 			return &(it->second);
 		}
-		else
+
+		// Glyph outside of character set, which is rasterized into cache on first use
+		FT_Face& rFace = *(mupFace.get());
+		if (pGlyphCache == NULL || FT_Get_Char_Index(rFace, character) == 0)
 		{
 			return NULL;
 		}
+		Glyph glyph;
+		if (!pGlyphCache->find(character, glyph))
+		{
+			FT_Set_Pixel_Sizes(rFace, 0, mDistanceField ? FONT_DISTANCE_FIELD_PIXEL_HEIGHT : pixelHeight);
+			GlyphBitmap bitmap;
+			std::vector<char16_t> outdated;
+			bool inserted =
+				rasterizeGlyph(rFace, character, mDistanceField, bitmap)
+				&& pGlyphCache->insert(character, bitmap.glyph, bitmap.width, bitmap.height, bitmap.pixels, outdated);
+			glyph = bitmap.glyph;
+
+			// Forget glyphs which were replaced or moved in cache
+			for (char16_t outdatedCharacter : outdated)
+			{
+				if (mDistanceField)
+				{
+					mTallGlyphs.erase(outdatedCharacter);
+					mMediumGlyphs.erase(outdatedCharacter);
+					mSmallGlyphs.erase(outdatedCharacter);
+				}
+				else
+				{
+					rGlyphMap.erase(outdatedCharacter);
+				}
+			}
+
+			if (!inserted)
+			{
+				return NULL;
+			}
+		}
+
+		// Distance field is at reference height
+		if (mDistanceField)
+		{
+			glyph = scaleDistanceFieldGlyph(glyph, pixelHeight);
+		}
+
+		Glyph& rGlyph = rGlyphMap[character];
+		rGlyph = glyph;
+		return &rGlyph;
 	}
 
-	int AtlasFont::calculatePadding(int pixelHeight)
+	int AtlasFont::calculatePadding(int pixelHeight) const
 	{
 		return std::max(
 			FONT_MINIMAL_CHARACTER_PADDING,
@@ -152,234 +409,485 @@ namespace eyegui
 
 	void AtlasFont::fillAtlases()
 	{
+		// Distance fields are rasterized once, later only scaled
+		if (mDistanceField)
+		{
+			if (!mDistanceFieldFilled)
+			{
+				fillDistanceFieldAtlas();
+				mDistanceFieldFilled = true;
+			}
+			scaleDistanceFieldGlyphs(mTallPixelHeight, mTallGlyphs, mTallLinePixelHeight);
+			scaleDistanceFieldGlyphs(mMediumPixelHeight, mMediumGlyphs, mMediumLinePixelHeight);
+			scaleDistanceFieldGlyphs(mSmallPixelHeight, mSmallGlyphs, mSmallLinePixelHeight);
+			return;
+		}
+
+		// Load atlases of all sizes from cache or rasterize them at once, so threads share the work
+		std::vector<FontAtlasEntry> atlases;
+		prepareAtlases({ mTallPixelHeight, mMediumPixelHeight, mSmallPixelHeight }, false, atlases);
+
 		fillAtlas(
-			mTallPixelHeight,
+			atlases[0],
 			mTallGlyphs,
 			mTallLinePixelHeight,
 			mTallTexture,
-			calculatePadding(mTallPixelHeight));
+			calculatePadding(mTallPixelHeight),
+			mupTallGlyphCache);
 		fillAtlas(
-			mMediumPixelHeight,
+			atlases[1],
 			mMediumGlyphs,
 			mMediumLinePixelHeight,
 			mMediumTexture,
-			calculatePadding(mMediumPixelHeight));
+			calculatePadding(mMediumPixelHeight),
+			mupMediumGlyphCache);
 		fillAtlas(
-			mSmallPixelHeight,
+			atlases[2],
 			mSmallGlyphs,
 			mSmallLinePixelHeight,
 			mSmallTexture,
-			calculatePadding(mSmallPixelHeight));
+			calculatePadding(mSmallPixelHeight),
+			mupSmallGlyphCache);
 	}
 
 	void AtlasFont::fillAtlas(
-		int pixelHeight,
+		const FontAtlasEntry& rAtlas,
 		std::map<char16_t, Glyph>& rGlyphMap,
 		float& rLineHeight,
-		GLuint textureHandle,
-		int padding)
+		uint textureHandle,
+		int padding,
+		std::unique_ptr<GlyphCache>& rupGlyphCache)
+	{
+		// Set line height
+		rLineHeight = rAtlas.lineHeight;
+
+		// Bitmaps are shown at the size they are rasterized
+		uploadAtlas(rAtlas, rGlyphMap, textureHandle, RenderBackend::TextureFilter::NEAREST);
+
+		// Glyphs outside of character set are rasterized again at new height
+		rupGlyphCache = std::unique_ptr<GlyphCache>(
+			new GlyphCache(
+				mpBackend,
+				rAtlas.cellSize,
+				padding,
+				RenderBackend::TextureFilter::NEAREST));
+	}
+
+	void AtlasFont::fillDistanceFieldAtlas()
+	{
+		// Atlas at reference height
+		std::vector<FontAtlasEntry> atlases;
+		prepareAtlases({ FONT_DISTANCE_FIELD_PIXEL_HEIGHT }, true, atlases);
+		mDistanceFieldLinePixelHeight = atlases[0].lineHeight;
+
+		// Distance fields are interpolated when scaled
+		uploadAtlas(atlases[0], mDistanceFieldGlyphs, mDistanceFieldTexture, RenderBackend::TextureFilter::LINEAR);
+
+		// Cache for glyphs outside of character set
+		mupDistanceFieldGlyphCache = std::unique_ptr<GlyphCache>(
+			new GlyphCache(
+				mpBackend,
+				atlases[0].cellSize,
+				FONT_MINIMAL_CHARACTER_PADDING,
+				RenderBackend::TextureFilter::LINEAR));
+	}
+
+	void AtlasFont::prepareAtlases(
+		const std::vector<int>& rPixelHeights,
+		bool distanceField,
+		std::vector<FontAtlasEntry>& rAtlases)
 	{
-		// Some typedef, keeps track of combination of each glyph and its bitmap
-		typedef std::pair<Glyph*, std::vector<unsigned char> > glyphBitmapPair;
+		// Load atlases found in cache
+		rAtlases.clear();
+		rAtlases.resize(rPixelHeights.size());
+		std::vector<FontAtlasKey> keys;
+		std::vector<int> missing;
+		std::vector<int> missingPixelHeights;
+		for (int i = 0; i < rPixelHeights.size(); i++)
+		{
+			keys.push_back(buildAtlasKey(rPixelHeights[i], distanceField));
+			if (mpFontAtlasCache == NULL || !mpFontAtlasCache->load(keys[i], rAtlases[i]))
+			{
+				missing.push_back(i);
+				missingPixelHeights.push_back(rPixelHeights[i]);
+			}
+		}
+		if (missing.empty())
+		{
+			return;
+		}
 
-		// Store bitmaps temporarily
-		std::vector<glyphBitmapPair> bitmaps;
+		// Rasterize remaining ones at once
+		std::vector<std::vector<GlyphBitmap> > bitmaps;
+		rasterizeCharacterSet(missingPixelHeights, distanceField, bitmaps);
 
-		// Reference to face
+		// Pack them and store them in cache
 		FT_Face& rFace = *(mupFace.get());
+		for (int i = 0; i < missing.size(); i++)
+		{
+			const FontAtlasKey& rKey = keys[missing[i]];
+			FontAtlasEntry& rAtlas = rAtlases[missing[i]];
+			FT_Set_Pixel_Sizes(rFace, 0, rKey.pixelHeight);
+			rAtlas.lineHeight = (float)(rFace->height) / 64; // Given in 1/64 pixel
+			rAtlas.cellSize = calculateCellSize(rKey.padding) + 2 * rKey.distanceFieldSpread;
+			packAtlas(bitmaps[i], rKey.padding, rAtlas);
+			if (mpFontAtlasCache != NULL)
+			{
+				mpFontAtlasCache->store(rKey, rAtlas);
+			}
+		}
+	}
 
-		// Set the height for generation of glyphs
-		FT_Set_Pixel_Sizes(rFace, 0, pixelHeight);
+	FontAtlasKey AtlasFont::buildAtlasKey(int pixelHeight, bool distanceField) const
+	{
+		FontAtlasKey key;
+		key.fontHash = mFontHash;
+		key.characterSetHash = mCharacterSetHash;
+		key.pixelHeight = pixelHeight;
+		key.padding = distanceField ? FONT_MINIMAL_CHARACTER_PADDING : calculatePadding(pixelHeight);
+		key.distanceFieldSpread = distanceField ? FONT_DISTANCE_FIELD_SPREAD : 0;
+		return key;
+	}
 
-		// Set line height
-		rLineHeight = (float)(rFace->height) / 64; // Given in 1/64 pixel
+	void AtlasFont::rasterizeCharacterSet(
+		const std::vector<int>& rPixelHeights,
+		bool distanceField,
+		std::vector<std::vector<GlyphBitmap> >& rBitmaps)
+	{
+		// Split characters of each pixel height into chunks, taken by threads one after another
+		std::vector<char16_t> characters(mCharacterSet.begin(), mCharacterSet.end());
+		std::vector<std::pair<int, int> > chunks; // Index of pixel height and first character
+		for (int i = 0; i < rPixelHeights.size(); i++)
+		{
+			for (int j = 0; j < characters.size(); j += FONT_RASTERIZATION_CHUNK_SIZE)
+			{
+				chunks.push_back(std::make_pair(i, j));
+			}
+		}
+		std::vector<std::vector<GlyphBitmap> > bitmaps(rPixelHeights.size(), std::vector<GlyphBitmap>(characters.size()));
+		std::vector<std::vector<uchar> > found(rPixelHeights.size(), std::vector<uchar>(characters.size(), 0));
+		std::atomic<int> nextChunk(0);
+		auto rasterizeChunks = [&](FT_Face face)
+		{
+			for (int chunk = nextChunk++; chunk < (int)chunks.size(); chunk = nextChunk++)
+			{
+				int height = chunks[chunk].first;
+				int end = std::min(chunks[chunk].second + FONT_RASTERIZATION_CHUNK_SIZE, (int)characters.size());
+				FT_Set_Pixel_Sizes(face, 0, rPixelHeights[height]);
+				for (int i = chunks[chunk].second; i < end; i++)
+				{
+					found[height][i] = rasterizeGlyph(face, characters[i], distanceField, bitmaps[height][i]) ? 1 : 0;
+				}
+			}
+		};
 
-		// Go over character set and collect glyphs and bitmaps
-		for (char16_t c : mCharacterSet)
+		// Faces must not be shared by threads, so each worker gets its own. They are opened
+		// in this thread, since library must not be used by multiple threads at once
+		int workerCount = std::min((int)mpRasterizationPool->getThreadCount(), (int)chunks.size() - 1);
+		while ((int)mWorkerFaces.size() < workerCount)
 		{
-			// Load current glyph in face
-			if (FT_Load_Char(rFace, c, FT_LOAD_RENDER))
+			FT_Face face;
+			if (FT_New_Memory_Face(mFreeTypeLibrary, mpFontData, (FT_Long)mFontDataSize, 0, &face))
 			{
-				throwWarning(
-					OperationNotifier::Operation::RUNTIME,
-					"Failed to find following character in font file: " + c,
-					mFilepath);
-				continue;
+				break;
 			}
+			mWorkerFaces.push_back(face);
+		}
+		workerCount = std::min(workerCount, (int)mWorkerFaces.size());
+
+		// Rasterize in workers and this thread until all chunks are taken
+		std::mutex mutex;
+		std::condition_variable condition;
+		int finishedWorkers = 0;
+		for (int i = 0; i < workerCount; i++)
+		{
+			FT_Face face = mWorkerFaces[i];
+			mpRasterizationPool->enqueue([&, face]()
+			{
+				rasterizeChunks(face);
+				std::lock_guard<std::mutex> lock(mutex);
+				finishedWorkers++;
+				condition.notify_one();
+			});
+		}
+		rasterizeChunks(*(mupFace.get()));
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [&]() { return finishedWorkers == workerCount; });
+		}
 
-			// Determine width and height
-			int bitmapWidth = rFace->glyph->bitmap.width;
-			int bitmapHeight = rFace->glyph->bitmap.rows;
+		// Keep bitmaps of found glyphs and tell about missing ones
+		rBitmaps.clear();
+		rBitmaps.resize(rPixelHeights.size());
+		for (int i = 0; i < rPixelHeights.size(); i++)
+		{
+			for (int j = 0; j < characters.size(); j++)
+			{
+				if (found[i][j])
+				{
+					rBitmaps[i].push_back(std::move(bitmaps[i][j]));
+				}
+				else
+				{
+					throwWarning(
+						OperationNotifier::Operation::RUNTIME,
+						"Failed to find following character in font file: " + characters[j],
+						mFilepath);
+				}
+			}
+		}
+	}
 
-			// Save some values of the glyph
-			rGlyphMap[c].advance = glm::vec2(
-				(float)(rFace->glyph->advance.x) / 64,   // Given in 1/64 pixel
-				(float)(rFace->glyph->advance.y) / 64);  // Given in 1/64 pixel
-			rGlyphMap[c].size = glm::ivec2(bitmapWidth, bitmapHeight);
-			rGlyphMap[c].bearing = glm::ivec2(
+	bool AtlasFont::rasterizeGlyph(FT_Face face, char16_t character, bool distanceField, GlyphBitmap& rBitmap) const
+	{
+		// Load glyph in face at its current pixel size
+		FT_Face& rFace = face;
+		if (FT_Load_Char(rFace, character, FT_LOAD_RENDER))
+		{
+			return false;
+		}
+		const FT_Bitmap& rFaceBitmap = rFace->glyph->bitmap;
+		int bitmapWidth = rFaceBitmap.width;
+		int bitmapHeight = rFaceBitmap.rows;
+
+		// Save some values of the glyph
+		Glyph& rGlyph = rBitmap.glyph;
+		rBitmap.character = character;
+		rGlyph.advance = glm::vec2(
+			(float)(rFace->glyph->advance.x) / 64,   // Given in 1/64 pixel
+			(float)(rFace->glyph->advance.y) / 64);  // Given in 1/64 pixel
+		rGlyph.texture = 0;
+
+		if (!distanceField)
+		{
+			rGlyph.size = glm::vec2(bitmapWidth, bitmapHeight);
+			rGlyph.bearing = glm::vec2(
 				rFace->glyph->bitmap_left,
 				rFace->glyph->bitmap_top);
 
 			// Go over rows and write it mirrored into own buffer
-			std::vector<unsigned char> mirrorBuffer;
+			rBitmap.width = bitmapWidth;
+			rBitmap.height = bitmapHeight;
+			rBitmap.pixels.clear();
+			rBitmap.pixels.reserve(bitmapWidth * bitmapHeight);
 			for (int i = bitmapHeight - 1; i >= 0; i--)
 			{
 				for (int j = 0; j < bitmapWidth; j++)
 				{
-					mirrorBuffer.push_back(rFace->glyph->bitmap.buffer[i*bitmapWidth + j]);
+					rBitmap.pixels.push_back(rFaceBitmap.buffer[i * rFaceBitmap.pitch + j]);
 				}
 			}
+			return true;
+		}
 
-			// Fetch current glyph and bitmap and store it in vector as pair
-			bitmaps.push_back(
-				glyphBitmapPair(
-					&rGlyphMap[c],
-					mirrorBuffer));
+		// Field extends bitmap by spread, so outline can be blended outside of it
+		const int spread = FONT_DISTANCE_FIELD_SPREAD;
+		int fieldWidth = bitmapWidth + 2 * spread;
+		int fieldHeight = bitmapHeight + 2 * spread;
+		rGlyph.size = glm::vec2(fieldWidth, fieldHeight);
+		rGlyph.bearing = glm::vec2(
+			rFace->glyph->bitmap_left - spread,
+			rFace->glyph->bitmap_top + spread);
+
+		// Squared distances of pixels outside to inside and inside to outside
+		std::vector<float> outside(fieldWidth * fieldHeight);
+		std::vector<float> inside(fieldWidth * fieldHeight);
+		for (int y = 0; y < fieldHeight; y++)
+		{
+			for (int x = 0; x < fieldWidth; x++)
+			{
+				int bitmapX = x - spread;
+				int bitmapY = y - spread;
+				bool covered =
+					bitmapX >= 0 && bitmapX < bitmapWidth
+					&& bitmapY >= 0 && bitmapY < bitmapHeight
+					&& rFaceBitmap.buffer[bitmapY * rFaceBitmap.pitch + bitmapX] >= 128;
+				outside[y * fieldWidth + x] = covered ? 0 : 1e20f;
+				inside[y * fieldWidth + x] = covered ? 1e20f : 0;
+			}
+		}
+		transformDistanceGrid(outside, fieldWidth, fieldHeight);
+		transformDistanceGrid(inside, fieldWidth, fieldHeight);
+
+		// Outline is at half intensity, rows mirrored like bitmaps
+		rBitmap.width = fieldWidth;
+		rBitmap.height = fieldHeight;
+		rBitmap.pixels.resize(fieldWidth * fieldHeight);
+		for (int y = 0; y < fieldHeight; y++)
+		{
+			for (int x = 0; x < fieldWidth; x++)
+			{
+				int i = y * fieldWidth + x;
+				float distance = outside[i] > 0
+					? std::sqrt(outside[i]) - 0.5f
+					: 0.5f - std::sqrt(inside[i]);
+				float value = 0.5f - distance / (2.f * spread);
+				value = std::min(std::max(value, 0.f), 1.f);
+				rBitmap.pixels[(fieldHeight - 1 - y) * fieldWidth + x] = (uchar)(value * 255.f + 0.5f);
+			}
 		}
+		return true;
+	}
+
+	int AtlasFont::calculateCellSize(int padding) const
+	{
+		// Line height or widest advance of face at its current pixel size
+		FT_Face& rFace = *(mupFace.get());
+		FT_Pos extent = std::max(rFace->size->metrics.height, rFace->size->metrics.max_advance);
+		return (int)((extent + 63) / 64) + 2 * padding; // Given in 1/64 pixel
+	}
 
-		// Decide, which resolution is minimum when texture would be quadratic
-		int sumPixelWidth = 0;
-		for (const glyphBitmapPair& rGlyphBitmapPair : bitmaps)
+	void AtlasFont::scaleDistanceFieldGlyphs(
+		int pixelHeight,
+		std::map<char16_t, Glyph>& rGlyphMap,
+		float& rLineHeight) const
+	{
+		rGlyphMap.clear();
+		for (const auto& rPair : mDistanceFieldGlyphs)
 		{
-			sumPixelWidth += rGlyphBitmapPair.first->size.x + 2 * padding;
+			rGlyphMap[rPair.first] = scaleDistanceFieldGlyph(rPair.second, pixelHeight);
 		}
-		int pixelCount = (pixelHeight + 2 * padding) * sumPixelWidth;
-		float sqrtPixelCount = sqrt((float)pixelCount);
+		rLineHeight = mDistanceFieldLinePixelHeight * ((float)pixelHeight / (float)FONT_DISTANCE_FIELD_PIXEL_HEIGHT);
+	}
+
+	Glyph AtlasFont::scaleDistanceFieldGlyph(const Glyph& rGlyph, int pixelHeight) const
+	{
+		float scale = (float)pixelHeight / (float)FONT_DISTANCE_FIELD_PIXEL_HEIGHT;
+		Glyph glyph = rGlyph;
+		glyph.size *= scale;
+		glyph.bearing *= scale;
+		glyph.advance *= scale;
+		return glyph;
+	}
 
-		int i = 5;
-		while (pow(2, i) < sqrtPixelCount)
+	void AtlasFont::packAtlas(
+		std::vector<GlyphBitmap>& rBitmaps,
+		int padding,
+		FontAtlasEntry& rAtlas) const
+	{
+		// Place highest bitmaps first, which keeps skyline flat
+		std::vector<GlyphBitmap*> order;
+		int widestBitmap = 0;
+		uint glyphPixels = 0;
+		for (GlyphBitmap& rBitmap : rBitmaps)
 		{
-			i++;
+			order.push_back(&rBitmap);
+			widestBitmap = std::max(widestBitmap, rBitmap.width + 2 * padding);
+			glyphPixels += (uint)(rBitmap.width * rBitmap.height);
 		}
-		int xResolution = (int)pow(2, i);
+		std::stable_sort(order.begin(), order.end(), [](GlyphBitmap const * pA, GlyphBitmap const * pB)
+		{
+			return pA->height > pB->height || (pA->height == pB->height && pA->width > pB->width);
+		});
 
 		// Get the maximum resolution of textures on this GPU
-		int maxTextureResolution;
-		glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureResolution);
+		int maxTextureResolution = mpBackend->getMaxTextureSize();
 
-		if (xResolution > maxTextureResolution)
+		// Try widths of power of two until area is wider than high and keep smallest area
+		int width = 32;
+		while (width < widestBitmap)
 		{
-			throwError(
-				OperationNotifier::Operation::RUNTIME,
-				"Too many and too big glyphs for texture atlas. GPU supported texture size is insufficient",
-				mFilepath);
+			width *= 2;
 		}
-
-		// Build up rows with vectors of words
-		std::vector<int> rows;
-		std::vector<std::vector<glyphBitmapPair const *> > bitmapOrder;
-		for (const glyphBitmapPair& rGlyphBitmapPair : bitmaps)
+		int bestWidth = 0;
+		int bestHeight = 0;
+		std::vector<glm::ivec2> bestPositions;
+		std::vector<glm::ivec2> positions(order.size());
+		for (; width <= maxTextureResolution; width *= 2)
 		{
-			// Try different rows
-			int width = rGlyphBitmapPair.first->size.x + 2 * padding;
-			bool check = false;
-
-			for (int j = 0; j < rows.size(); j++)
+			SkylinePacker packer(width);
+			for (int i = 0; i < order.size(); i++)
 			{
-				// Does this word fit in this row?
-				if ((rows[j] + width) < xResolution)
-				{
-					rows[j] += width;
-					bitmapOrder[j].push_back(&rGlyphBitmapPair);
-					check = true;
-					break;
-				}
+				packer.insert(
+					order[i]->width + 2 * padding,
+					order[i]->height + 2 * padding,
+					positions[i].x,
+					positions[i].y);
 			}
-			if (!check)
+			int height = std::max(packer.getHeight(), 1);
+			if (height <= maxTextureResolution
+				&& (bestWidth == 0 || (long long)width * height < (long long)bestWidth * bestHeight))
 			{
-				// No more room in existing rows, add more
-				rows.push_back(width);
-				std::vector<glyphBitmapPair const *> rowBitmapOrder;
-				rowBitmapOrder.push_back(&rGlyphBitmapPair);
-				bitmapOrder.push_back(rowBitmapOrder);
+				bestWidth = width;
+				bestHeight = height;
+				bestPositions = positions;
+			}
+			if (height <= width)
+			{
+				break;
 			}
 		}
 
-		// Calculate necessary rows
-		i = 5;
-		int yResolution = (int)rows.size() * (pixelHeight + 2 * padding);
-		while (pow(2, i) < yResolution)
-		{
-			i++;
-		}
-
-		// Let's make y resolution also power of two
-		yResolution = (int)pow(2, i);
-
-		// Do check for vertical resolution as well
-		if (yResolution > maxTextureResolution)
+		if (bestWidth == 0)
 		{
 			throwError(
 				OperationNotifier::Operation::RUNTIME,
 				"Too many and too big glyphs for texture atlas. GPU supported texture size is insufficient",
 				mFilepath);
+			return;
 		}
 
-		// Enable writing of non power of two
-		GLint oldUnpackAlignment;
-		glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
-		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-		// Initialize texture for atlas
-		glBindTexture(GL_TEXTURE_2D, textureHandle);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-		std::vector<GLubyte> emptyData(xResolution * yResolution, 0);
-		glTexImage2D(
-			GL_TEXTURE_2D,
-			0,
-			GL_RED,
-			xResolution,
-			yResolution,
-			0,
-			GL_RED,
-			GL_UNSIGNED_BYTE,
-			emptyData.data());
-
-		// Write bitmaps into texture and save further values to the glyph
-		int yPen = yResolution - pixelHeight - 2 * padding;
-		for (int i = 0; i < bitmapOrder.size(); i++)
-		{
-			int xPen = 0;
-			for (int j = 0; j < bitmapOrder[i].size(); j++)
+		// Compose atlas and save glyphs with further values
+		rAtlas.width = bestWidth;
+		rAtlas.height = bestHeight;
+		rAtlas.glyphPixels = glyphPixels;
+		rAtlas.glyphs.clear();
+		rAtlas.pixels.assign((size_t)bestWidth * bestHeight, 0);
+		for (int i = 0; i < order.size(); i++)
+		{
+			GlyphBitmap& rBitmap = *(order[i]);
+			int x = bestPositions[i].x + padding;
+			int y = bestPositions[i].y + padding;
+			for (int row = 0; row < rBitmap.height; row++)
 			{
-				int bitmapWidth = bitmapOrder[i][j]->first->size.x;
-				int bitmapHeight = bitmapOrder[i][j]->first->size.y;
-
-				// Write into texture
-				glTexSubImage2D(
-					GL_TEXTURE_2D,
-					0,
-					xPen + padding,
-					yPen + padding,
-					bitmapWidth,
-					bitmapHeight,
-					GL_RED,
-					GL_UNSIGNED_BYTE,
-					bitmapOrder[i][j]->second.data());
-
-				// Save further values to glyph structure
-				bitmapOrder[i][j]->first->atlasPosition = glm::vec4(
-					(float)(xPen + padding) / xResolution,
-					(float)(yPen + padding) / yResolution,
-					(float)(xPen + padding + bitmapWidth) / xResolution,
-					(float)(yPen + padding + bitmapHeight) / yResolution);
-
-				// Advance pen
-				xPen += bitmapWidth + 2 * padding;
+				std::memcpy(
+					rAtlas.pixels.data() + (size_t)(y + row) * bestWidth + x,
+					rBitmap.pixels.data() + (size_t)row * rBitmap.width,
+					rBitmap.width);
 			}
+			Glyph& rGlyph = rAtlas.glyphs[rBitmap.character];
+			rGlyph = rBitmap.glyph;
+			rGlyph.atlasPosition = glm::vec4(
+				(float)x / bestWidth,
+				(float)y / bestHeight,
+				(float)(x + rBitmap.width) / bestWidth,
+				(float)(y + rBitmap.height) / bestHeight);
+		}
+	}
 
-			// Advance pen
-			yPen -= pixelHeight + 2 * padding;
+	void AtlasFont::uploadAtlas(
+		const FontAtlasEntry& rAtlas,
+		std::map<char16_t, Glyph>& rGlyphMap,
+		uint textureHandle,
+		RenderBackend::TextureFilter magFilter)
+	{
+		// Glyphs did not fit into texture
+		if (rAtlas.width == 0)
+		{
+			return;
 		}
 
-		// Unbind texture
-		glBindTexture(GL_TEXTURE_2D, 0);
+		// Glyphs are in texture of atlas
+		rGlyphMap = rAtlas.glyphs;
+		for (auto& rPair : rGlyphMap)
+		{
+			rPair.second.texture = textureHandle;
+		}
 
-		// Reset unpack alignment
-		glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
+		// Upload whole atlas at once
+		mpBackend->fillTexture(
+			textureHandle,
+			rAtlas.width,
+			rAtlas.height,
+			RenderBackend::PixelFormat::RED,
+			rAtlas.pixels.data(),
+			RenderBackend::TextureFilter::LINEAR,
+			magFilter,
+			RenderBackend::TextureWrap::CLAMP);
+
+		// Remember usage of atlas
+		AtlasUsage& rUsage = mAtlasUsages[textureHandle];
+		rUsage.atlasPixels = (uint)(rAtlas.width * rAtlas.height);
+		rUsage.glyphPixels = rAtlas.glyphPixels;
 	}
 }
@@ -5,15 +5,25 @@
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Font implementation using FreeType library to render glyphs as bitmaps
-// onto a texture atlas.
+// onto a texture atlas. Either bitmaps are rasterized for each font size,
+// again when the window is resized, or glyphs are rasterized once at a
+// reference height into an atlas of signed distance fields. Glyphs of all
+// sizes are then scaled from it, so resizing rasterizes nothing. Glyphs
+// outside of the character set are rasterized on first use into caches.
+// The character set is rasterized by a pool of threads, each one reading the
+// font from memory with a face of its own. Finished atlases are kept in an
+// optional cache on disk and loaded from it instead of rasterized again.
 
 #ifndef ATLAS_FONT_H_
 #define ATLAS_FONT_H_
 
 #include "Font.h"
+#include "GlyphCache.h"
+#include "FontAtlasCache.h"
 
+#include "Rendering/Backend/RenderBackend.h"
+#include "ThreadPool.h"
 #include "externals/FreeType2/include/ft2build.h"
-#include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <memory>
 #include <map>
@@ -28,12 +38,20 @@ namespace eyegui
 	{
 	public:
 
-		// Constructor (takes responsibility for face)
+		// Constructor (takes responsibility for face). Font data is read by faces of threads
+		// and must stay valid as long as font exists. Font atlas cache may be NULL
 		AtlasFont(
+			RenderBackend* pBackend,
+			ThreadPool* pRasterizationPool,
+			FontAtlasCache const * pFontAtlasCache,
 			std::string filepath,
+			FT_Library freeTypeLibrary,
+			uchar const * pFontData,
+			size_t fontDataSize,
 			std::unique_ptr<FT_Face> upFace,
 			std::set<char16_t> characterSet,
-			int windowHeight);
+			int windowHeight,
+			bool distanceField);
 
 		// Destructor
 		virtual ~AtlasFont();
@@ -41,22 +59,71 @@ namespace eyegui
 		// Resize font atlases
 		virtual void resizeFontAtlases(int windowHeight);
 
-		// Get glyph (may return NULL if not found)
+		// Set whether glyphs are scaled from one distance field atlas instead of bitmaps per size
+		virtual void setDistanceField(bool distanceField, int windowHeight);
+
+		// Are glyphs distance fields
+		virtual bool isDistanceField() const;
+
+		// Get glyph, rasterized on first use when outside of character set (may return NULL if not found)
 		virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const;
 
+		// Upload glyphs rasterized on first use. Returns whether glyphs were replaced or moved
+		virtual bool uploadGlyphs();
+
+		// Get generation of glyphs of font size
+		virtual uint getGlyphGeneration(FontSize fontSize) const;
+
 		// Get height of line
 		virtual float getLineHeight(FontSize fontSize) const;
 
-		// Get handle of texture atlas
+		// Get count of pixels in atlases of character set and count of them covered by glyphs
+		virtual void getAtlasPixelCounts(uint& rAtlasPixels, uint& rGlyphPixels) const;
+
+		// Get handle of texture atlas of character set
 		virtual uint getAtlasTextureHandle(FontSize fontSize) const;
 
 	private:
 
-		// Get glyph (may return NULL if not found)
-		Glyph const * getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const;
+		// Bitmap of glyph waiting for its place in atlas, rows from bottom to top
+		struct GlyphBitmap
+		{
+			char16_t character;
+			Glyph glyph;
+			int width;
+			int height;
+			std::vector<uchar> pixels;
+		};
+
+		// Pixels of atlas and pixels of it covered by glyphs
+		struct AtlasUsage
+		{
+			uint atlasPixels;
+			uint glyphPixels;
+		};
+
+		// Get glyph from map or rasterize it into cache (may return NULL if not found)
+		Glyph const * getGlyph(
+			std::map<char16_t, Glyph>& rGlyphMap,
+			GlyphCache* pGlyphCache,
+			int pixelHeight,
+			char16_t character) const;
 
 		// Calculate padding
-		int calculatePadding(int pixelHeight);
+		int calculatePadding(int pixelHeight) const;
+
+		// Calculate size of cells in glyph cache for current pixel size of face
+		int calculateCellSize(int padding) const;
+
+		// Rasterize glyph at current pixel size of face as bitmap or distance field. Returns false if not
+		// found. Threads may call it at the same time with different faces
+		bool rasterizeGlyph(FT_Face face, char16_t character, bool distanceField, GlyphBitmap& rBitmap) const;
+
+		// Rasterize character set at each pixel height with pool of threads. Missing glyphs are left out
+		void rasterizeCharacterSet(
+			const std::vector<int>& rPixelHeights,
+			bool distanceField,
+			std::vector<std::vector<GlyphBitmap> >& rBitmaps);
 
 		// Fill pixel heights
 		void fillPixelHeights(int windowHeight);
@@ -64,34 +131,97 @@ namespace eyegui
 		// Fill all atlases
 		void fillAtlases();
 
-		// Fill atlas
+		// Fill atlas and create cache for glyphs outside of character set
 		void fillAtlas(
-			int pixelHeight,
+			const FontAtlasEntry& rAtlas,
 			std::map<char16_t, Glyph>& rGlyphMap,
 			float& rLineHeight,
-			GLuint textureHandle,
-			int padding);
+			uint textureHandle,
+			int padding,
+			std::unique_ptr<GlyphCache>& rupGlyphCache);
+
+		// Fill atlas of distance fields at reference height
+		void fillDistanceFieldAtlas();
+
+		// Load atlases of character set at each pixel height from cache. Missing ones are
+		// rasterized at once, packed and stored in cache
+		void prepareAtlases(
+			const std::vector<int>& rPixelHeights,
+			bool distanceField,
+			std::vector<FontAtlasEntry>& rAtlases);
+
+		// Build key of atlas in cache
+		FontAtlasKey buildAtlasKey(int pixelHeight, bool distanceField) const;
+
+		// Fill glyphs of pixel height by scaling glyphs of distance field atlas
+		void scaleDistanceFieldGlyphs(
+			int pixelHeight,
+			std::map<char16_t, Glyph>& rGlyphMap,
+			float& rLineHeight) const;
+
+		// Scale glyph of distance field atlas to pixel height
+		Glyph scaleDistanceFieldGlyph(const Glyph& rGlyph, int pixelHeight) const;
+
+		// Place bitmaps with skyline packer into atlas. Width of atlas stays zero if they do not fit
+		void packAtlas(
+			std::vector<GlyphBitmap>& rBitmaps,
+			int padding,
+			FontAtlasEntry& rAtlas) const;
+
+		// Fill glyph map with glyphs of atlas and upload its pixels at once
+		void uploadAtlas(
+			const FontAtlasEntry& rAtlas,
+			std::map<char16_t, Glyph>& rGlyphMap,
+			uint textureHandle,
+			RenderBackend::TextureFilter magFilter);
 
 		// Members
-		std::unique_ptr<FT_Face> mupFace;
+		RenderBackend* mpBackend;
+		ThreadPool* mpRasterizationPool;
+		FontAtlasCache const * mpFontAtlasCache;
+		uint64_t mFontHash;
+		uint64_t mCharacterSetHash;
+		FT_Library mFreeTypeLibrary;
+		uchar const * mpFontData;
+		size_t mFontDataSize;
+		std::unique_ptr<FT_Face> mupFace; // Used by this thread
+		std::vector<FT_Face> mWorkerFaces; // Opened when needed, one per thread of pool
 		std::set<char16_t> mCharacterSet;
 
-		std::map<char16_t, Glyph> mTallGlyphs;
-		std::map<char16_t, Glyph> mMediumGlyphs;
-		std::map<char16_t, Glyph> mSmallGlyphs;
+		// Glyphs outside of character set are added on first use
+		mutable std::map<char16_t, Glyph> mTallGlyphs;
+		mutable std::map<char16_t, Glyph> mMediumGlyphs;
+		mutable std::map<char16_t, Glyph> mSmallGlyphs;
+
+		std::unique_ptr<GlyphCache> mupTallGlyphCache;
+		std::unique_ptr<GlyphCache> mupMediumGlyphCache;
+		std::unique_ptr<GlyphCache> mupSmallGlyphCache;
 
 		float mTallLinePixelHeight;
 		float mMediumLinePixelHeight;
 		float mSmallLinePixelHeight;
 
-		GLuint mTallTexture;
-		GLuint mMediumTexture;
-		GLuint mSmallTexture;
+		uint mTallTexture;
+		uint mMediumTexture;
+		uint mSmallTexture;
 
 		int mTallPixelHeight;
 		int mMediumPixelHeight;
 		int mSmallPixelHeight;
 
+		uint mTallGlyphGeneration; // Increased when glyphs in cache of size are outdated
+		uint mMediumGlyphGeneration;
+		uint mSmallGlyphGeneration;
+
+		bool mDistanceField;
+		bool mDistanceFieldFilled; // Atlas is filled at first usage
+		std::map<char16_t, Glyph> mDistanceFieldGlyphs; // At reference height
+		float mDistanceFieldLinePixelHeight;
+		uint mDistanceFieldTexture;
+		std::unique_ptr<GlyphCache> mupDistanceFieldGlyphCache; // Shared by all sizes
+
+		std::map<uint, AtlasUsage> mAtlasUsages; // Per texture of character set
+
 		std::string mFilepath;
 	};
 }
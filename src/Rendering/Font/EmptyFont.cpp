@@ -11,34 +11,29 @@
 
 namespace eyegui
 {
-	EmptyFont::EmptyFont() : Font()
+	EmptyFont::EmptyFont(RenderBackend* pBackend) : Font()
 	{
+		// Save members
+		mpBackend = pBackend;
+
 		// Create some empty texture just in case...
-		glGenTextures(1, &mTexture);
-
-		std::vector<GLubyte> emptyData(4 * 4, 0);
-		glBindTexture(GL_TEXTURE_2D, mTexture);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		glTexImage2D(
-			GL_TEXTURE_2D,
-			0,
-			GL_RED,
+		mTexture = mpBackend->createTexture();
+
+		std::vector<uchar> emptyData(4 * 4, 0);
+		mpBackend->fillTexture(
+			mTexture,
 			4,
 			4,
-			0,
-			GL_RED,
-			GL_UNSIGNED_BYTE,
-			emptyData.data());
-
-		glBindTexture(GL_TEXTURE_2D, 0);
+			RenderBackend::PixelFormat::RED,
+			emptyData.data(),
+			RenderBackend::TextureFilter::NEAREST,
+			RenderBackend::TextureFilter::NEAREST,
+			RenderBackend::TextureWrap::CLAMP);
 	}
 
 	EmptyFont::~EmptyFont()
 	{
-		glDeleteTextures(1, &mTexture);
+		mpBackend->deleteTexture(mTexture);
 	}
 
 	void EmptyFont::resizeFontAtlases(int windowHeight)
@@ -46,16 +41,42 @@ namespace eyegui
 		// Nothing to do
 	}
 
+	void EmptyFont::setDistanceField(bool distanceField, int windowHeight)
+	{
+		// Nothing to do
+	}
+
+	bool EmptyFont::isDistanceField() const
+	{
+		return false;
+	}
+
 	Glyph const * EmptyFont::getGlyph(FontSize fontSize, char16_t character) const
 	{
 		return NULL;
 	}
 
+	bool EmptyFont::uploadGlyphs()
+	{
+		return false;
+	}
+
+	uint EmptyFont::getGlyphGeneration(FontSize fontSize) const
+	{
+		return 0;
+	}
+
 	float EmptyFont::getLineHeight(FontSize fontSize) const
 	{
 		return 0;
 	}
 
+	void EmptyFont::getAtlasPixelCounts(uint& rAtlasPixels, uint& rGlyphPixels) const
+	{
+		rAtlasPixels = 0;
+		rGlyphPixels = 0;
+	}
+
 	uint EmptyFont::getAtlasTextureHandle(FontSize fontSize) const
 	{
 		return mTexture;
@@ -12,8 +12,8 @@
 
 #include "Font.h"
 
+#include "Rendering/Backend/RenderBackend.h"
 #include "externals/GLM/glm/glm.hpp"
-#include "externals/OpenGLLoader/gl_core_3_3.h"
 
 namespace eyegui
 {
@@ -22,7 +22,7 @@ namespace eyegui
 	public:
 
 		// Constructor
-		EmptyFont();
+		EmptyFont(RenderBackend* pBackend);
 
 		// Destructor
 		virtual ~EmptyFont();
@@ -30,19 +30,35 @@ namespace eyegui
 		// Resize font atlases
 		virtual void resizeFontAtlases(int windowHeight);
 
+		// Set whether glyphs are scaled from one distance field atlas instead of bitmaps per size
+		virtual void setDistanceField(bool distanceField, int windowHeight);
+
+		// Are glyphs distance fields
+		virtual bool isDistanceField() const;
+
 		// Get glyph (may return NULL if not found)
 		virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const;
 
+		// Upload glyphs rasterized on first use
+		virtual bool uploadGlyphs();
+
+		// Get generation of glyphs, which never changes
+		virtual uint getGlyphGeneration(FontSize fontSize) const;
+
 		// Get height of line
 		virtual float getLineHeight(FontSize fontSize) const;
 
+		// Get count of pixels in atlases of character set and count of them covered by glyphs
+		virtual void getAtlasPixelCounts(uint& rAtlasPixels, uint& rGlyphPixels) const;
+
 		// Get handle of texture atlas
 		virtual uint getAtlasTextureHandle(FontSize fontSize) const;
 
 	private:
 
 		// Members
-		GLuint mTexture;
+		RenderBackend* mpBackend;
+		uint mTexture;
 	};
 }
 
@@ -19,9 +19,10 @@ namespace eyegui
 	struct Glyph
 	{
 		glm::vec4	atlasPosition;	// Position in atlas (minU, minV, maxU, maxV)
-		glm::ivec2  size;			// Size in pixel
-		glm::ivec2	bearing;		// Offset from baseline to left / top of glyph in pixel
+		glm::vec2	size;			// Size in pixel (fractional when scaled from distance field)
+		glm::vec2	bearing;		// Offset from baseline to left / top of glyph in pixel
 		glm::vec2	advance;        // Offset to advance to next glyph in pixel
+		uint		texture;		// Handle of atlas texture containing glyph
 	};
 
 	class Font
@@ -37,13 +38,30 @@ namespace eyegui
 		// Resize font atlases
 		virtual void resizeFontAtlases(int windowHeight) = 0;
 
-		// Get glyph (may return NULL if not found)
+		// Set whether glyphs are scaled from one distance field atlas instead of bitmaps per size
+		virtual void setDistanceField(bool distanceField, int windowHeight) = 0;
+
+		// Are glyphs distance fields, which must be drawn with shader of distance field fonts
+		virtual bool isDistanceField() const = 0;
+
+		// Get glyph, rasterized on first use when outside of character set (may return NULL if not found)
 		virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const = 0;
 
+		// Upload glyphs rasterized on first use. Returns whether glyphs were replaced
+		// or moved, so meshes using them must be calculated again
+		virtual bool uploadGlyphs() = 0;
+
+		// Get generation of glyphs of font size, increased when uploaded glyphs replaced or moved
+		// others. Meshes calculated at an older generation must be calculated again
+		virtual uint getGlyphGeneration(FontSize fontSize) const = 0;
+
 		// Get height of line
 		virtual float getLineHeight(FontSize fontSize) const = 0;
 
-		// Get handle of texture atlas
+		// Get count of pixels in atlases of character set and count of them covered by glyphs
+		virtual void getAtlasPixelCounts(uint& rAtlasPixels, uint& rGlyphPixels) const = 0;
+
+		// Get handle of texture atlas of character set
 		virtual uint getAtlasTextureHandle(FontSize fontSize) const = 0;
 	};
 }
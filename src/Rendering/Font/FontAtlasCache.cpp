@@ -0,0 +1,250 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "FontAtlasCache.h"
+
+#include "MappedFile.h"
+
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <functional>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace eyegui
+{
+	// Beginning of each entry, followed by glyphs and pixels
+	struct FontAtlasCacheHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint64_t fontHash;
+		uint64_t characterSetHash;
+		uint32_t pixelHeight;
+		uint32_t padding;
+		uint32_t distanceFieldSpread;
+		uint32_t width;
+		uint32_t height;
+		uint32_t cellSize;
+		uint32_t glyphPixels;
+		uint32_t glyphCount;
+		float lineHeight;
+		uint32_t reserved;
+	};
+	static_assert(sizeof(FontAtlasCacheHeader) == 64, "FontAtlasCacheHeader must not contain padding");
+
+	// Metrics of one glyph
+	struct FontAtlasCacheGlyph
+	{
+		uint32_t character;
+		float atlasPosition[4];
+		float size[2];
+		float bearing[2];
+		float advance[2];
+	};
+	static_assert(sizeof(FontAtlasCacheGlyph) == 44, "FontAtlasCacheGlyph must not contain padding");
+
+	// Identification of entries
+	static const uint32_t FONT_ATLAS_CACHE_MAGIC = 0x41464745; // "EGFA"
+	static const uint32_t FONT_ATLAS_CACHE_VERSION = 1;
+
+	FontAtlasCache::FontAtlasCache(std::string directory)
+	{
+		// Initialize members
+		mDirectory = directory;
+
+		// Create directory, fails if already existing
+#ifdef _WIN32
+		_mkdir(mDirectory.c_str());
+#else
+		mkdir(mDirectory.c_str(), 0755);
+#endif
+
+		// Check for directory
+		struct stat status;
+		mUsable = stat(mDirectory.c_str(), &status) == 0 && (status.st_mode & S_IFDIR) != 0;
+	}
+
+	FontAtlasCache::~FontAtlasCache()
+	{
+		// Nothing to do
+	}
+
+	bool FontAtlasCache::load(const FontAtlasKey& rKey, FontAtlasEntry& rEntry) const
+	{
+		if (!mUsable)
+		{
+			return false;
+		}
+
+		// Map entry
+		std::string entryFilepath = buildEntryFilepath(rKey);
+		bool valid = false;
+		{
+			MappedFile entry(entryFilepath);
+			if (!entry.isMapped())
+			{
+				return false;
+			}
+
+			// Check header against key and size of entry
+			FontAtlasCacheHeader header;
+			if (entry.getSize() >= sizeof(FontAtlasCacheHeader))
+			{
+				std::memcpy(&header, entry.getData(), sizeof(FontAtlasCacheHeader));
+				size_t bytes = sizeof(FontAtlasCacheHeader)
+					+ (size_t)header.glyphCount * sizeof(FontAtlasCacheGlyph)
+					+ (size_t)header.width * header.height;
+				valid = header.magic == FONT_ATLAS_CACHE_MAGIC
+					&& header.version == FONT_ATLAS_CACHE_VERSION
+					&& header.fontHash == rKey.fontHash
+					&& header.characterSetHash == rKey.characterSetHash
+					&& header.pixelHeight == (uint32_t)rKey.pixelHeight
+					&& header.padding == (uint32_t)rKey.padding
+					&& header.distanceFieldSpread == (uint32_t)rKey.distanceFieldSpread
+					&& header.width > 0
+					&& header.height > 0
+					&& entry.getSize() == bytes;
+			}
+
+			// Copy glyphs and pixels out of mapping
+			if (valid)
+			{
+				uchar const * pData = entry.getData() + sizeof(FontAtlasCacheHeader);
+				rEntry.glyphs.clear();
+				for (uint32_t i = 0; i < header.glyphCount; i++)
+				{
+					FontAtlasCacheGlyph record;
+					std::memcpy(&record, pData, sizeof(FontAtlasCacheGlyph));
+					pData += sizeof(FontAtlasCacheGlyph);
+					Glyph& rGlyph = rEntry.glyphs[(char16_t)record.character];
+					rGlyph.atlasPosition = glm::vec4(record.atlasPosition[0], record.atlasPosition[1], record.atlasPosition[2], record.atlasPosition[3]);
+					rGlyph.size = glm::vec2(record.size[0], record.size[1]);
+					rGlyph.bearing = glm::vec2(record.bearing[0], record.bearing[1]);
+					rGlyph.advance = glm::vec2(record.advance[0], record.advance[1]);
+					rGlyph.texture = 0;
+				}
+				rEntry.pixels.assign(pData, pData + (size_t)header.width * header.height);
+				rEntry.width = (int)header.width;
+				rEntry.height = (int)header.height;
+				rEntry.lineHeight = header.lineHeight;
+				rEntry.cellSize = (int)header.cellSize;
+				rEntry.glyphPixels = header.glyphPixels;
+			}
+		}
+
+		// Invalid entry is deleted after mapping is gone
+		if (!valid)
+		{
+			std::remove(entryFilepath.c_str());
+		}
+		return valid;
+	}
+
+	void FontAtlasCache::store(const FontAtlasKey& rKey, const FontAtlasEntry& rEntry) const
+	{
+		if (!mUsable || rEntry.width <= 0 || rEntry.height <= 0)
+		{
+			return;
+		}
+		FontAtlasCacheHeader header;
+		header.magic = FONT_ATLAS_CACHE_MAGIC;
+		header.version = FONT_ATLAS_CACHE_VERSION;
+		header.fontHash = rKey.fontHash;
+		header.characterSetHash = rKey.characterSetHash;
+		header.pixelHeight = (uint32_t)rKey.pixelHeight;
+		header.padding = (uint32_t)rKey.padding;
+		header.distanceFieldSpread = (uint32_t)rKey.distanceFieldSpread;
+		header.width = (uint32_t)rEntry.width;
+		header.height = (uint32_t)rEntry.height;
+		header.cellSize = (uint32_t)rEntry.cellSize;
+		header.glyphPixels = rEntry.glyphPixels;
+		header.glyphCount = (uint32_t)rEntry.glyphs.size();
+		header.lineHeight = rEntry.lineHeight;
+		header.reserved = 0;
+
+		// Metrics of glyphs
+		std::vector<FontAtlasCacheGlyph> records;
+		records.reserve(rEntry.glyphs.size());
+		for (const auto& rPair : rEntry.glyphs)
+		{
+			const Glyph& rGlyph = rPair.second;
+			FontAtlasCacheGlyph record;
+			record.character = (uint32_t)rPair.first;
+			for (int i = 0; i < 4; i++) { record.atlasPosition[i] = rGlyph.atlasPosition[i]; }
+			for (int i = 0; i < 2; i++)
+			{
+				record.size[i] = rGlyph.size[i];
+				record.bearing[i] = rGlyph.bearing[i];
+				record.advance[i] = rGlyph.advance[i];
+			}
+			records.push_back(record);
+		}
+
+		// Write into temporary file first, so other readers never see incomplete entries
+		std::string entryFilepath = buildEntryFilepath(rKey);
+		std::ostringstream temporary;
+		temporary << entryFilepath << "." << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+		std::string temporaryFilepath = temporary.str();
+		{
+			std::ofstream out(temporaryFilepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			out.write(reinterpret_cast<const char*>(&header), sizeof(FontAtlasCacheHeader));
+			out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(FontAtlasCacheGlyph));
+			out.write(reinterpret_cast<const char*>(rEntry.pixels.data()), rEntry.pixels.size());
+			if (!out)
+			{
+				out.close();
+				std::remove(temporaryFilepath.c_str());
+				return;
+			}
+		}
+
+		// Replace entry. Renaming onto existing file fails on some systems
+		if (std::rename(temporaryFilepath.c_str(), entryFilepath.c_str()) != 0)
+		{
+			std::remove(entryFilepath.c_str());
+			if (std::rename(temporaryFilepath.c_str(), entryFilepath.c_str()) != 0)
+			{
+				std::remove(temporaryFilepath.c_str());
+			}
+		}
+	}
+
+	uint64_t FontAtlasCache::hash(void const * pData, size_t size)
+	{
+		uint64_t hash = 14695981039346656037ULL;
+		uchar const * pBytes = static_cast<uchar const *>(pData);
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= pBytes[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	std::string FontAtlasCache::buildEntryFilepath(const FontAtlasKey& rKey) const
+	{
+		std::ostringstream entry;
+		entry << mDirectory << "/" << std::hex << std::setfill('0')
+			<< std::setw(16) << rKey.fontHash << "_"
+			<< std::setw(16) << rKey.characterSetHash
+			<< std::dec << "_" << rKey.pixelHeight << "_" << rKey.padding;
+		if (rKey.distanceFieldSpread > 0)
+		{
+			entry << "_d" << rKey.distanceFieldSpread;
+		}
+		entry << ".egfa";
+		return entry.str();
+	}
+}
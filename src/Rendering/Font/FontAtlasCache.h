@@ -0,0 +1,81 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Directory on disk with finished atlases of fonts, so the character set is
+// not rasterized again at next start or when the window returns to a height
+// seen before. One entry per font data, character set, pixel height, padding
+// and spread of distance field, holding pixels of atlas and glyph metrics.
+// Font data is identified by hash of its content, so entries stay valid when
+// the file is moved and are ignored when it is changed.
+
+#ifndef FONT_ATLAS_CACHE_H_
+#define FONT_ATLAS_CACHE_H_
+
+#include "Font.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+namespace eyegui
+{
+	// Identification of atlas
+	struct FontAtlasKey
+	{
+		uint64_t fontHash;
+		uint64_t characterSetHash;
+		int pixelHeight;
+		int padding;
+		int distanceFieldSpread; // Zero for bitmaps
+	};
+
+	// Atlas of character set with rows from bottom to top
+	struct FontAtlasEntry
+	{
+		int width = 0; // Zero if glyphs do not fit into texture
+		int height = 0;
+		float lineHeight = 0;
+		int cellSize = 0; // Of glyph cache for characters outside of set
+		uint glyphPixels = 0;
+		std::map<char16_t, Glyph> glyphs; // Without texture handle
+		std::vector<uchar> pixels;
+	};
+
+	class FontAtlasCache
+	{
+	public:
+
+		// Constructor, directory is created if not existing
+		FontAtlasCache(std::string directory);
+
+		// Destructor
+		virtual ~FontAtlasCache();
+
+		// Does directory exist
+		bool isUsable() const { return mUsable; }
+
+		// Load atlas. Returns false if there is no valid entry
+		bool load(const FontAtlasKey& rKey, FontAtlasEntry& rEntry) const;
+
+		// Store atlas
+		void store(const FontAtlasKey& rKey, const FontAtlasEntry& rEntry) const;
+
+		// FNV-1a hash of bytes, e.g. of font data or character set
+		static uint64_t hash(void const * pData, size_t size);
+
+	private:
+
+		// Build filepath of entry
+		std::string buildEntryFilepath(const FontAtlasKey& rKey) const;
+
+		// Members
+		std::string mDirectory;
+		bool mUsable;
+	};
+}
+
+#endif // FONT_ATLAS_CACHE_H_
@@ -0,0 +1,281 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "GlyphCache.h"
+
+#include "Defines.h"
+#include <algorithm>
+#include <cstring>
+
+namespace eyegui
+{
+	GlyphCache::GlyphCache(RenderBackend* pBackend, int cellSize, int padding, RenderBackend::TextureFilter magFilter)
+	{
+		// Initialize members
+		mpBackend = pBackend;
+		mCellSize = std::max(cellSize, 1);
+		mPadding = padding;
+		mMagFilter = magFilter;
+		mMaxPageSize = std::min(std::max(mpBackend->getMaxTextureSize(), 1), GLYPH_CACHE_MAX_PAGE_SIZE);
+		mFrame = 0;
+		mOutdated = false;
+	}
+
+	GlyphCache::~GlyphCache()
+	{
+		for (const auto& rupPage : mPages)
+		{
+			mpBackend->deleteTexture(rupPage->texture);
+		}
+	}
+
+	bool GlyphCache::find(char16_t character, Glyph& rGlyph)
+	{
+		auto it = mEntries.find(character);
+		if (it == mEntries.end())
+		{
+			return false;
+		}
+		touch(character);
+		rGlyph = it->second.glyph;
+		return true;
+	}
+
+	void GlyphCache::touch(char16_t character)
+	{
+		auto it = mEntries.find(character);
+		if (it != mEntries.end())
+		{
+			it->second.frame = mFrame;
+			mUsage.splice(mUsage.end(), mUsage, it->second.usage);
+		}
+	}
+
+	bool GlyphCache::insert(
+		char16_t character,
+		Glyph& rGlyph,
+		int width,
+		int height,
+		std::vector<uchar> const & rPixels,
+		std::vector<char16_t>& rOutdated)
+	{
+		// Glyph must fit into cell
+		if (width + 2 * mPadding > mCellSize
+			|| height + 2 * mPadding > mCellSize
+			|| mCellSize > mMaxPageSize)
+		{
+			return false;
+		}
+
+		// Find cell
+		uint page = 0;
+		int cell = 0;
+		if (!allocate(page, cell, rOutdated))
+		{
+			return false;
+		}
+
+		// Clear cell and copy pixels of glyph into it
+		Page& rPage = *(mPages[page].get());
+		int cellsPerRow = rPage.size / mCellSize;
+		int cellX = (cell % cellsPerRow) * mCellSize;
+		int cellY = (cell / cellsPerRow) * mCellSize;
+		for (int y = 0; y < mCellSize; y++)
+		{
+			uchar* pRow = rPage.pixels.data() + (size_t)(cellY + y) * rPage.size + cellX;
+			std::fill(pRow, pRow + mCellSize, (uchar)0);
+			int glyphY = y - mPadding;
+			if (glyphY >= 0 && glyphY < height && width > 0)
+			{
+				std::memcpy(pRow + mPadding, rPixels.data() + (size_t)glyphY * width, width);
+			}
+		}
+		rPage.cells[cell] = character;
+		rPage.used[cell] = true;
+		rPage.dirtyMinY = std::min(rPage.dirtyMinY, cellY);
+		rPage.dirtyMaxY = std::max(rPage.dirtyMaxY, cellY + mCellSize);
+
+		// Remember glyph
+		Entry& rEntry = mEntries[character];
+		rEntry.glyph = rGlyph;
+		rEntry.glyph.size = glm::vec2(width, height);
+		rEntry.page = page;
+		rEntry.cell = cell;
+		rEntry.frame = mFrame;
+		rEntry.usage = mUsage.insert(mUsage.end(), character);
+		updatePlacement(rEntry);
+		rGlyph = rEntry.glyph;
+		return true;
+	}
+
+	bool GlyphCache::upload()
+	{
+		// Changed rows of each page at once
+		for (const auto& rupPage : mPages)
+		{
+			if (rupPage->dirtyMinY < rupPage->dirtyMaxY)
+			{
+				mpBackend->fillTextureRegion(
+					rupPage->texture,
+					0,
+					rupPage->dirtyMinY,
+					rupPage->size,
+					rupPage->dirtyMaxY - rupPage->dirtyMinY,
+					RenderBackend::PixelFormat::RED,
+					rupPage->pixels.data() + (size_t)rupPage->dirtyMinY * rupPage->size);
+				rupPage->dirtyMinY = rupPage->size;
+				rupPage->dirtyMaxY = 0;
+			}
+		}
+
+		// Glyphs used so far may be replaced in next frame
+		mFrame++;
+		bool outdated = mOutdated;
+		mOutdated = false;
+		return outdated;
+	}
+
+	bool GlyphCache::allocate(uint& rPage, int& rCell, std::vector<char16_t>& rOutdated)
+	{
+		// Free cell in existing page
+		for (uint i = 0; i < mPages.size(); i++)
+		{
+			auto it = std::find(mPages[i]->used.begin(), mPages[i]->used.end(), false);
+			if (it != mPages[i]->used.end())
+			{
+				rPage = i;
+				rCell = (int)(it - mPages[i]->used.begin());
+				return true;
+			}
+		}
+
+		// Grow page, which adds cells at the end
+		for (uint i = 0; i < mPages.size(); i++)
+		{
+			if (mPages[i]->size * 2 <= mMaxPageSize)
+			{
+				grow(i, rOutdated);
+				return allocate(rPage, rCell, rOutdated);
+			}
+		}
+
+		// Add page
+		if (mPages.size() < GLYPH_CACHE_MAX_PAGES)
+		{
+			std::unique_ptr<Page> upPage = std::unique_ptr<Page>(new Page);
+			upPage->texture = mpBackend->createTexture();
+			upPage->size = GLYPH_CACHE_MIN_PAGE_SIZE;
+			while (upPage->size < mCellSize)
+			{
+				upPage->size *= 2;
+			}
+			upPage->size = std::min(upPage->size, mMaxPageSize);
+			int cellsPerRow = upPage->size / mCellSize;
+			upPage->cells.resize(cellsPerRow * cellsPerRow, 0);
+			upPage->used.resize(cellsPerRow * cellsPerRow, false);
+			upPage->pixels.resize((size_t)upPage->size * upPage->size, 0);
+			createPageTexture(*(upPage.get()));
+			mPages.push_back(std::move(upPage));
+			rPage = (uint)mPages.size() - 1;
+			rCell = 0;
+			return true;
+		}
+
+		// Replace least recently used glyph, unless it is used in this frame
+		if (mUsage.empty() || mEntries[mUsage.front()].frame == mFrame)
+		{
+			return false;
+		}
+		char16_t character = mUsage.front();
+		mUsage.pop_front();
+		Entry& rEntry = mEntries[character];
+		rPage = rEntry.page;
+		rCell = rEntry.cell;
+		mPages[rPage]->used[rCell] = false;
+		mEntries.erase(character);
+		rOutdated.push_back(character);
+		mOutdated = true;
+		return true;
+	}
+
+	void GlyphCache::createPageTexture(Page& rPage) const
+	{
+		mpBackend->fillTexture(
+			rPage.texture,
+			rPage.size,
+			rPage.size,
+			RenderBackend::PixelFormat::RED,
+			rPage.pixels.data(),
+			RenderBackend::TextureFilter::LINEAR,
+			mMagFilter,
+			RenderBackend::TextureWrap::CLAMP);
+		rPage.dirtyMinY = rPage.size;
+		rPage.dirtyMaxY = 0;
+	}
+
+	void GlyphCache::grow(uint page, std::vector<char16_t>& rOutdated)
+	{
+		Page& rPage = *(mPages[page].get());
+		int oldSize = rPage.size;
+		int oldCellsPerRow = oldSize / mCellSize;
+		int size = oldSize * 2;
+		int cellsPerRow = size / mCellSize;
+
+		// Copy rows of pixels into larger page
+		std::vector<uchar> pixels((size_t)size * size, 0);
+		for (int y = 0; y < oldSize; y++)
+		{
+			std::memcpy(pixels.data() + (size_t)y * size, rPage.pixels.data() + (size_t)y * oldSize, oldSize);
+		}
+
+		// Cells keep their column and row
+		std::vector<char16_t> cells(cellsPerRow * cellsPerRow, 0);
+		std::vector<bool> used(cellsPerRow * cellsPerRow, false);
+		for (int cell = 0; cell < (int)rPage.used.size(); cell++)
+		{
+			if (rPage.used[cell])
+			{
+				int newCell = (cell / oldCellsPerRow) * cellsPerRow + (cell % oldCellsPerRow);
+				cells[newCell] = rPage.cells[cell];
+				used[newCell] = true;
+				Entry& rEntry = mEntries[rPage.cells[cell]];
+				rEntry.cell = newCell;
+				rOutdated.push_back(rPage.cells[cell]);
+			}
+		}
+		rPage.size = size;
+		rPage.cells = std::move(cells);
+		rPage.used = std::move(used);
+		rPage.pixels = std::move(pixels);
+		createPageTexture(rPage);
+
+		// Positions in atlas changed with size
+		for (int cell = 0; cell < (int)rPage.used.size(); cell++)
+		{
+			if (rPage.used[cell])
+			{
+				updatePlacement(mEntries[rPage.cells[cell]]);
+			}
+		}
+		mOutdated = true;
+	}
+
+	void GlyphCache::updatePlacement(Entry& rEntry) const
+	{
+		const Page& rPage = *(mPages[rEntry.page].get());
+		int cellsPerRow = rPage.size / mCellSize;
+		float x = (float)((rEntry.cell % cellsPerRow) * mCellSize + mPadding);
+		float y = (float)((rEntry.cell / cellsPerRow) * mCellSize + mPadding);
+		float size = (float)rPage.size;
+		rEntry.glyph.texture = rPage.texture;
+		rEntry.glyph.atlasPosition = glm::vec4(
+			x / size,
+			y / size,
+			(x + rEntry.glyph.size.x) / size,
+			(y + rEntry.glyph.size.y) / size);
+	}
+}
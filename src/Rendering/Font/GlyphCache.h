@@ -0,0 +1,112 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Glyphs rasterized on first use by a font, for characters outside of the
+// character set baked into its atlases. Pages of the cache are divided into
+// cells of equal size, large enough for every glyph of one pixel height.
+// Pages grow until maximal size, then further pages are added. When all are
+// full, the cell of the least recently used glyph is reused. Glyphs used in
+// the current frame are never replaced. Pixels are kept in memory and the
+// changed rows of each page are uploaded at once per frame.
+
+#ifndef GLYPH_CACHE_H_
+#define GLYPH_CACHE_H_
+
+#include "Font.h"
+#include "Rendering/Backend/RenderBackend.h"
+
+#include <memory>
+#include <vector>
+#include <map>
+#include <list>
+
+namespace eyegui
+{
+	class GlyphCache
+	{
+	public:
+
+		// Constructor. Cell size includes padding around glyph
+		GlyphCache(RenderBackend* pBackend, int cellSize, int padding, RenderBackend::TextureFilter magFilter);
+
+		// Destructor
+		virtual ~GlyphCache();
+
+		// Fill glyph with its current place in pages and mark it as used. Returns false if not cached
+		bool find(char16_t character, Glyph& rGlyph);
+
+		// Mark glyph as used, so it is not replaced in current frame
+		void touch(char16_t character);
+
+		// Place bitmap of glyph with rows from bottom to top and fill texture and position in atlas
+		// of glyph. Characters of glyphs which were replaced or moved are added to outdated ones.
+		// Returns false if glyph is larger than cell or no cell can be freed
+		bool insert(
+			char16_t character,
+			Glyph& rGlyph,
+			int width,
+			int height,
+			std::vector<uchar> const & rPixels,
+			std::vector<char16_t>& rOutdated);
+
+		// Upload changed rows of pages and begin next frame. Returns whether glyphs were replaced
+		// or moved since last call, so meshes using them must be calculated again
+		bool upload();
+
+		// Get count of pages
+		uint getPageCount() const { return (uint)mPages.size(); }
+
+	private:
+
+		// Texture divided into cells
+		struct Page
+		{
+			uint texture;
+			int size;
+			std::vector<char16_t> cells; // Character per cell, row by row
+			std::vector<bool> used;
+			std::vector<uchar> pixels; // Copy of texture
+			int dirtyMinY; // Rows changed since last upload
+			int dirtyMaxY;
+		};
+
+		// Glyph placed in cell of page
+		struct Entry
+		{
+			Glyph glyph;
+			uint page;
+			int cell;
+			uint frame; // Of last usage
+			std::list<char16_t>::iterator usage;
+		};
+
+		// Find free cell, growing pages, adding page or replacing least recently used glyph
+		bool allocate(uint& rPage, int& rCell, std::vector<char16_t>& rOutdated);
+
+		// Allocate texture of page at its size and upload its pixels
+		void createPageTexture(Page& rPage) const;
+
+		// Double size of page, keeping position of cells in pixels
+		void grow(uint page, std::vector<char16_t>& rOutdated);
+
+		// Write texture and position in atlas into glyph of entry
+		void updatePlacement(Entry& rEntry) const;
+
+		// Members
+		RenderBackend* mpBackend;
+		int mCellSize;
+		int mPadding;
+		RenderBackend::TextureFilter mMagFilter;
+		int mMaxPageSize;
+		std::vector<std::unique_ptr<Page> > mPages;
+		std::map<char16_t, Entry> mEntries;
+		std::list<char16_t> mUsage; // Least recently used first
+		uint mFrame;
+		bool mOutdated;
+	};
+}
+
+#endif // GLYPH_CACHE_H_
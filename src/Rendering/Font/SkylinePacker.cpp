@@ -0,0 +1,102 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "SkylinePacker.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+	SkylinePacker::SkylinePacker(int width)
+	{
+		mWidth = width;
+		mHeight = 0;
+		Segment segment;
+		segment.x = 0;
+		segment.y = 0;
+		segment.width = width;
+		mSkyline.push_back(segment);
+	}
+
+	bool SkylinePacker::insert(int width, int height, int& rX, int& rY)
+	{
+		if (width > mWidth)
+		{
+			return false;
+		}
+
+		// Find segment where rectangle rests lowest
+		int bestIndex = -1;
+		int bestY = 0;
+		for (int i = 0; i < (int)mSkyline.size(); i++)
+		{
+			int x = mSkyline[i].x;
+			if (x + width > mWidth)
+			{
+				break;
+			}
+
+			// Rectangle rests on highest segment below it
+			int y = 0;
+			int remaining = width;
+			for (int j = i; remaining > 0; j++)
+			{
+				y = std::max(y, mSkyline[j].y);
+				remaining -= mSkyline[j].width;
+			}
+			if (bestIndex < 0 || y < bestY)
+			{
+				bestIndex = i;
+				bestY = y;
+			}
+		}
+
+		// Add segment on top of rectangle
+		Segment segment;
+		segment.x = mSkyline[bestIndex].x;
+		segment.y = bestY + height;
+		segment.width = width;
+		mSkyline.insert(mSkyline.begin() + bestIndex, segment);
+
+		// Shorten or remove segments covered by it
+		int right = segment.x + segment.width;
+		int i = bestIndex + 1;
+		while (i < (int)mSkyline.size() && mSkyline[i].x < right)
+		{
+			int overlap = right - mSkyline[i].x;
+			if (overlap >= mSkyline[i].width)
+			{
+				mSkyline.erase(mSkyline.begin() + i);
+			}
+			else
+			{
+				mSkyline[i].x += overlap;
+				mSkyline[i].width -= overlap;
+				break;
+			}
+		}
+
+		// Merge neighbours at same height
+		for (int j = 0; j + 1 < (int)mSkyline.size();)
+		{
+			if (mSkyline[j].y == mSkyline[j + 1].y)
+			{
+				mSkyline[j].width += mSkyline[j + 1].width;
+				mSkyline.erase(mSkyline.begin() + j + 1);
+			}
+			else
+			{
+				j++;
+			}
+		}
+
+		rX = segment.x;
+		rY = bestY;
+		mHeight = std::max(mHeight, segment.y);
+		return true;
+	}
+}
@@ -0,0 +1,49 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Packs rectangles into an area of fixed width and growing height. Keeps the
+// upper outline of placed rectangles as segments of a skyline and puts every
+// rectangle at the lowest position where it fits, leftmost on ties. Works
+// best when rectangles are inserted from highest to lowest.
+
+#ifndef SKYLINE_PACKER_H_
+#define SKYLINE_PACKER_H_
+
+#include <vector>
+
+namespace eyegui
+{
+	class SkylinePacker
+	{
+	public:
+
+		// Constructor
+		SkylinePacker(int width);
+
+		// Find position for rectangle. Returns false if it is wider than area
+		bool insert(int width, int height, int& rX, int& rY);
+
+		// Get height of area covered by rectangles
+		int getHeight() const { return mHeight; }
+
+	private:
+
+		// Horizontal segment of skyline
+		struct Segment
+		{
+			int x;
+			int y;
+			int width;
+		};
+
+		// Members
+		int mWidth;
+		int mHeight;
+		std::vector<Segment> mSkyline; // Sorted by position, covering whole width
+	};
+}
+
+#endif // SKYLINE_PACKER_H_
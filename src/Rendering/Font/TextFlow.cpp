@@ -16,70 +16,53 @@ namespace eyegui
 {
 	TextFlow::TextFlow(
 		GUI const * pGUI,
+		RenderBackend* pBackend,
 		Font const * pFont,
 		FontSize fontSize,
 		TextFlowAlignment alignment,
 		TextFlowVerticalAlignment verticalAlignment,
 		Shader const * pShader,
+		Shader const * pDistanceFieldShader,
 		std::u16string content)
 	{
 		// Fill members
 		mpGUI = pGUI;
+		mpBackend = pBackend;
 		mpFont = pFont;
 		mFontSize = fontSize;
 		mAlignment = alignment;
 		mVerticalAlignment = verticalAlignment;
-		mpShader = pShader;
+		mpBitmapShader = pShader;
+		mpDistanceFieldShader = pDistanceFieldShader;
+		mpShader = NULL;
 		mContent = content;
 		mFlowHeight = 0;
+		mGlyphGeneration = mpFont->getGlyphGeneration(mFontSize);
 
 		// TransformAndSize has to be called before usage
 		mX = 0;
 		mY = 0;
 		mWidth = 0;
 		mHeight = 0;
-
-		// Save currently set buffer and vertex array object
-		GLint oldBuffer, oldVAO;
-		glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
-		glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
+		mVertexCount = 0;
 
 		// Initialize mesh buffers and vertex array object
-		glGenBuffers(1, &mVertexBuffer);
-		glGenBuffers(1, &mTextureCoordinateBuffer);
-		glGenVertexArrays(1, &mVertexArrayObject);
-
-		// Bind stuff to vertex array object
-		glBindVertexArray(mVertexArrayObject);
-
-		// Vertices
-		GLuint vertexAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "posAttribute");
-		glEnableVertexAttribArray(vertexAttrib);
-		glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-		glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-
-		// Texture coordinates
-		GLuint uvAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "uvAttribute");
-		glEnableVertexAttribArray(uvAttrib);
-		glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-		glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
-
-		// Restore old settings
-		glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
-		glBindVertexArray(oldVAO);
+		mVertexBuffer = mpBackend->createBuffer();
+		mTextureCoordinateBuffer = mpBackend->createBuffer();
+		mVertexArrayObject = mpBackend->createVertexArray();
 
-		// Get handle of atlas texture
-		mAtlasTextureHandle = mpFont->getAtlasTextureHandle(mFontSize);
+		// Connect vertex array object to shader
+		updateShader();
 	}
 
 	TextFlow::~TextFlow()
 	{
 		// Delete vertex array object
-		glDeleteVertexArrays(1, &mVertexArrayObject);
+		mpBackend->deleteVertexArray(mVertexArrayObject);
 
 		// Delete buffers
-		glDeleteBuffers(1, &mVertexBuffer);
-		glDeleteBuffers(1, &mTextureCoordinateBuffer);
+		mpBackend->deleteBuffer(mVertexBuffer);
+		mpBackend->deleteBuffer(mTextureCoordinateBuffer);
 	}
 
 	// Set content
@@ -103,10 +86,32 @@ namespace eyegui
 		calculateMesh();
 	}
 
+	bool TextFlow::update()
+	{
+		uint glyphGeneration = mpFont->getGlyphGeneration(mFontSize);
+		if (mGlyphGeneration == glyphGeneration)
+		{
+			return false;
+		}
+		mGlyphGeneration = glyphGeneration;
+
+		// Only glyphs outside of character set are in caches, where they may be replaced or moved
+		uint atlasTexture = mpFont->getAtlasTextureHandle(mFontSize);
+		for (const TextureRange& rRange : mTextureRanges)
+		{
+			if (rRange.texture != atlasTexture)
+			{
+				calculateMesh();
+				return true;
+			}
+		}
+		return false;
+	}
+
 	void TextFlow::draw(float scale, glm::vec4 color) const
 	{
 		mpShader->bind();
-		glBindVertexArray(mVertexArrayObject);
+		mpBackend->bindVertexArray(mVertexArrayObject);
 
 		// Calculate y offset because of vertical alignment
 		int yOffset;
@@ -131,22 +136,25 @@ namespace eyegui
 		matrix = glm::translate(matrix, glm::vec3(-mWidth / 2, -mHeight / 2, 0)); // Move into center of scaling
 		matrix = glm::ortho(0.0f, (float)(mpGUI->getWindowWidth() - 1), 0.0f, (float)(mpGUI->getWindowHeight() - 1)) * matrix; // Pixel to world space
 
-		// Bind atlas texture
-		glBindTexture(GL_TEXTURE_2D, mAtlasTextureHandle);
-
 		// Fill uniforms
-		mpShader->fillValue("matrix", matrix);
-		mpShader->fillValue("color", color);
+		mpShader->fillValue(shaders::Uniform::MATRIX, matrix);
+		mpShader->fillValue(shaders::Uniform::COLOR, color);
 
-		// Draw flow
-		glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
+		// Draw flow with one call per atlas texture
+		for (const TextureRange& rRange : mTextureRanges)
+		{
+			mpBackend->bindTexture(rRange.texture);
+			mpBackend->drawArrays(RenderBackend::Primitive::TRIANGLES, rRange.vertexCount, rRange.firstVertex);
+		}
 	}
 
 	void TextFlow::calculateMesh()
 	{
-		// Save currently set buffer
-		GLint oldBuffer;
-		glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
+		mpGUI->getFrameStatisticsRecorder()->countTextMeshCalculation();
+		mGlyphGeneration = mpFont->getGlyphGeneration(mFontSize);
+
+		// Font may have switched between bitmaps and distance field
+		updateShader();
 
 		// Get size of space
 		float pixelOfSpace = 0;
@@ -183,6 +191,7 @@ namespace eyegui
 		// Build flow together from words in paragraphs
 		std::vector<glm::vec3> vertices;
 		std::vector<glm::vec2> textureCoordinates;
+		std::vector<uint> textures;
 
 		// Go over paragraphs (pens are in local pixel coordinate system with origin in lower left corner)
 		float yPixelPen = -mpFont->getLineHeight(mFontSize); // First line should be also inside flow
@@ -267,6 +276,7 @@ namespace eyegui
 							vertices.push_back(glm::vec3(rVertex.x + xPixelPen, rVertex.y + yPixelPen, rVertex.z));
 							const glm::vec2& rTextureCoordinate = line[i]->spTextureCoordinates->at(j);
 							textureCoordinates.push_back(glm::vec2(rTextureCoordinate.s, rTextureCoordinate.t));
+							textures.push_back(line[i]->spTextures->at(j));
 						}
 
 						// Advance xPen
@@ -282,18 +292,42 @@ namespace eyegui
 		// Get height of all lines (yPixelPen is one line to low now)
 		mFlowHeight = (int)std::max(std::ceil(abs(yPixelPen) - mpFont->getLineHeight(mFontSize)), 0.0f);
 
+		// Order vertices by atlas texture, so each texture is bound once. Usually all
+		// glyphs are in the atlas of the character set and there is only one range
+		mTextureRanges.clear();
+		std::vector<glm::vec3> orderedVertices;
+		std::vector<glm::vec2> orderedTextureCoordinates;
+		std::vector<bool> ordered(textures.size(), false);
+		for (int i = 0; i < textures.size(); i++)
+		{
+			if (ordered[i])
+			{
+				continue;
+			}
+			TextureRange range;
+			range.texture = textures[i];
+			range.firstVertex = (uint)orderedVertices.size();
+			for (int j = i; j < textures.size(); j++)
+			{
+				if (!ordered[j] && textures[j] == range.texture)
+				{
+					orderedVertices.push_back(vertices[j]);
+					orderedTextureCoordinates.push_back(textureCoordinates[j]);
+					ordered[j] = true;
+				}
+			}
+			range.vertexCount = (uint)orderedVertices.size() - range.firstVertex;
+			mTextureRanges.push_back(range);
+		}
+		vertices = std::move(orderedVertices);
+		textureCoordinates = std::move(orderedTextureCoordinates);
+
 		// Vertex count
-		mVertexCount = (GLuint)vertices.size();
+		mVertexCount = (uint)vertices.size();
 
 		// Fill into buffer
-		glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-		glBufferData(GL_ARRAY_BUFFER, mVertexCount * 3 * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-
-		glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-		glBufferData(GL_ARRAY_BUFFER, mVertexCount * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
-
-		// Restore old setting
-		glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+		mpBackend->fillBuffer(mVertexBuffer, vertices.data(), mVertexCount * 3 * sizeof(float), true);
+		mpBackend->fillBuffer(mTextureCoordinateBuffer, textureCoordinates.data(), mVertexCount * 2 * sizeof(float), true);
 	}
 
 	TextFlow::Word TextFlow::calculateWord(std::u16string content)
@@ -302,6 +336,7 @@ namespace eyegui
 		Word word;
 		word.spVertices = std::shared_ptr<std::vector<glm::vec3> >(new std::vector<glm::vec3>);
 		word.spTextureCoordinates = std::shared_ptr<std::vector<glm::vec2> >(new std::vector<glm::vec2>);
+		word.spTextures = std::shared_ptr<std::vector<uint> >(new std::vector<uint>);
 
 		// Fill word with data
 		float xPixelPen = 0;
@@ -312,7 +347,7 @@ namespace eyegui
 			{
 				throwWarning(
 					OperationNotifier::Operation::RUNTIME,
-					"TextFlow has character in content not covered by character set");
+					"TextFlow has character in content not covered by font");
 				continue;
 			}
 
@@ -346,6 +381,8 @@ namespace eyegui
 			word.spTextureCoordinates->push_back(textureCoordinateC);
 			word.spTextureCoordinates->push_back(textureCoordinateD);
 			word.spTextureCoordinates->push_back(textureCoordinateA);
+
+			word.spTextures->insert(word.spTextures->end(), 6, pGlyph->texture);
 		}
 
 		// Set width of whole word
@@ -353,4 +390,28 @@ namespace eyegui
 
 		return word;
 	}
+
+	void TextFlow::updateShader()
+	{
+		Shader const * pShader = mpFont->isDistanceField() ? mpDistanceFieldShader : mpBitmapShader;
+		if (pShader == mpShader)
+		{
+			return;
+		}
+		mpShader = pShader;
+
+		// Vertices
+		mpBackend->setVertexAttribute(
+			mVertexArrayObject,
+			mpShader->getAttributeLocation("posAttribute"),
+			mVertexBuffer,
+			3);
+
+		// Texture coordinates
+		mpBackend->setVertexAttribute(
+			mVertexArrayObject,
+			mpShader->getAttributeLocation("uvAttribute"),
+			mTextureCoordinateBuffer,
+			2);
+	}
 }
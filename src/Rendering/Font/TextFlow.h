@@ -14,7 +14,7 @@
 
 #include "Font.h"
 #include "Rendering/Shader.h"
-#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "Rendering/Backend/RenderBackend.h"
 
 #include <vector>
 
@@ -30,11 +30,13 @@ namespace eyegui
 		// Constructor
 		TextFlow(
 			GUI const * pGUI,
+			RenderBackend* pBackend,
 			Font const * pFont,
 			FontSize fontSize,
 			TextFlowAlignment alignment,
 			TextFlowVerticalAlignment verticalAlignment,
 			Shader const * pShader,
+			Shader const * pDistanceFieldShader,
 			std::u16string content);
 
 		// Destructor
@@ -50,6 +52,10 @@ namespace eyegui
 			int width,
 			int height);
 
+		// Calculate mesh again if glyphs of font caches used by it may have been replaced or moved.
+		// Returns whether it was calculated
+		bool update();
+
 		// Draw (uses orthoprojection to scale to screen)
 		void draw(float scale, glm::vec4 color) const;
 
@@ -60,17 +66,30 @@ namespace eyegui
 		{
 			std::shared_ptr<std::vector<glm::vec3> > spVertices;
 			std::shared_ptr<std::vector<glm::vec2> > spTextureCoordinates;
+			std::shared_ptr<std::vector<uint> > spTextures; // Atlas texture per vertex
 			float pixelWidth;
 		};
 
+		// Vertices using the same atlas texture
+		struct TextureRange
+		{
+			uint texture;
+			uint firstVertex;
+			uint vertexCount;
+		};
+
 		// Calculate mesh (in pixel coordinates)
 		void calculateMesh();
 
+		// Use shader fitting to font and connect vertex array object to it
+		void updateShader();
+
 		// Calculate word
 		Word calculateWord(std::u16string content);
 
 		// Members
 		GUI const * mpGUI;
+		RenderBackend* mpBackend;
 		Font const * mpFont;
 		FontSize mFontSize;
 		TextFlowAlignment mAlignment;
@@ -82,13 +101,16 @@ namespace eyegui
 		glm::vec4 mColor;
 		std::u16string mContent;
 		int mFlowHeight;
-
-		Shader const * mpShader;
-		GLuint mVertexCount;
-		GLuint mVertexBuffer;
-		GLuint mTextureCoordinateBuffer;
-		GLuint mVertexArrayObject;
-		GLuint mAtlasTextureHandle;
+		uint mGlyphGeneration; // Of font when mesh was calculated
+
+		Shader const * mpBitmapShader;
+		Shader const * mpDistanceFieldShader;
+		Shader const * mpShader; // One of above, used by font
+		uint mVertexCount;
+		uint mVertexBuffer;
+		uint mTextureCoordinateBuffer;
+		uint mVertexArrayObject;
+		std::vector<TextureRange> mTextureRanges; // Glyphs may be spread over multiple atlas textures
 	};
 }
 
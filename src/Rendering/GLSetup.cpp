@@ -14,26 +14,47 @@ namespace eyegui
 		ogl_LoadFunctions();
 	}
 
+	void GLSetup::setRestoration(StateRestoration restoration)
+	{
+		mRestoration = restoration;
+	}
+
 	void GLSetup::setup(int viewportX, int viewportY, int viewportWidth, int viewportHeight)
 	{
 		// Storing
-		glGetIntegerv(GL_VIEWPORT, mViewport);
-		glGetBooleanv(GL_BLEND, &mBlend);
-		glGetBooleanv(GL_DEPTH_WRITEMASK, &mDepthMask);
-		glGetIntegerv(GL_BLEND_SRC_ALPHA, &mBlendSrc);
-		glGetIntegerv(GL_BLEND_DST_ALPHA, &mBlendDst);
-		glGetIntegerv(GL_CURRENT_PROGRAM, &mShaderProgram);
-		glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &mVertexArrayObject);
-		glGetBooleanv(GL_TEXTURE_2D, &mTexture2D);
-		glGetIntegerv(GL_TEXTURE_BINDING_2D, &mActiveTexture);
-		glGetBooleanv(GL_CULL_FACE, &mCulling);
+		mQueryCount = 0;
+		mAvoidedQueryCount = 0;
+		if (mRestoration.viewport) { glGetIntegerv(GL_VIEWPORT, mViewport); }
+		countQueries(mRestoration.viewport, 1);
+		if (mRestoration.blending)
+		{
+			glGetBooleanv(GL_BLEND, &mBlend);
+			glGetIntegerv(GL_BLEND_SRC_ALPHA, &mBlendSrc);
+			glGetIntegerv(GL_BLEND_DST_ALPHA, &mBlendDst);
+		}
+		countQueries(mRestoration.blending, 3);
+		if (mRestoration.depthMask) { glGetBooleanv(GL_DEPTH_WRITEMASK, &mDepthMask); }
+		countQueries(mRestoration.depthMask, 1);
+		if (mRestoration.culling) { glGetBooleanv(GL_CULL_FACE, &mCulling); }
+		countQueries(mRestoration.culling, 1);
+		if (mRestoration.shaderProgram) { glGetIntegerv(GL_CURRENT_PROGRAM, &mShaderProgram); }
+		countQueries(mRestoration.shaderProgram, 1);
+		if (mRestoration.vertexArray) { glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &mVertexArrayObject); }
+		countQueries(mRestoration.vertexArray, 1);
+		if (mRestoration.activeTexture) { glGetIntegerv(GL_ACTIVE_TEXTURE, &mActiveTexture); }
+		countQueries(mRestoration.activeTexture, 1);
+		if (mRestoration.uniformBuffer) { glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, 0, &mUniformBuffer); }
+		countQueries(mRestoration.uniformBuffer, 1);
+		if (mRestoration.arrayBuffer) { glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &mArrayBuffer); }
+		countQueries(mRestoration.arrayBuffer, 1);
+		if (mRestoration.unpackAlignment) { glGetIntegerv(GL_UNPACK_ALIGNMENT, &mUnpackAlignment); }
+		countQueries(mRestoration.unpackAlignment, 1);
 
-		// Setting
+		// Setting (texturing needs no enabling in core profile)
 		glViewport(viewportX, viewportY, viewportWidth, viewportHeight);
 		glEnable(GL_BLEND);
 		glDepthMask(GL_FALSE);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glEnable(GL_TEXTURE_2D);
 		glActiveTexture(GL_TEXTURE0);
 		glEnable(GL_CULL_FACE);
 	}
@@ -41,15 +62,20 @@ namespace eyegui
 	void GLSetup::restore()
 	{
 		// Restoring
-		glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
-		setCapability(GL_BLEND, mBlend);
-		glDepthMask(mDepthMask);
-		glBlendFunc(mBlendSrc, mBlendDst);
-		glUseProgram(mShaderProgram);
-		glBindVertexArray(mVertexArrayObject);
-		setCapability(GL_TEXTURE_2D, mTexture2D);
-		glActiveTexture(mActiveTexture);
-		setCapability(GL_CULL_FACE, mCulling);
+		if (mRestoration.viewport) { glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]); }
+		if (mRestoration.blending)
+		{
+			setCapability(GL_BLEND, mBlend);
+			glBlendFunc(mBlendSrc, mBlendDst);
+		}
+		if (mRestoration.depthMask) { glDepthMask(mDepthMask); }
+		if (mRestoration.culling) { setCapability(GL_CULL_FACE, mCulling); }
+		if (mRestoration.shaderProgram) { glUseProgram(mShaderProgram); }
+		if (mRestoration.vertexArray) { glBindVertexArray(mVertexArrayObject); }
+		if (mRestoration.activeTexture) { glActiveTexture(mActiveTexture); }
+		if (mRestoration.uniformBuffer) { glBindBufferBase(GL_UNIFORM_BUFFER, 0, mUniformBuffer); }
+		if (mRestoration.arrayBuffer) { glBindBuffer(GL_ARRAY_BUFFER, mArrayBuffer); }
+		if (mRestoration.unpackAlignment) { glPixelStorei(GL_UNPACK_ALIGNMENT, mUnpackAlignment); }
 	}
 
 	void GLSetup::setCapability(GLenum cap, GLboolean enable) const
@@ -63,4 +89,16 @@ namespace eyegui
 			glDisable(cap);
 		}
 	}
+
+	void GLSetup::countQueries(bool issued, unsigned int count)
+	{
+		if (issued)
+		{
+			mQueryCount += count;
+		}
+		else
+		{
+			mAvoidedQueryCount += count;
+		}
+	}
 }
@@ -7,11 +7,13 @@
 // Stores the current state of used OpenGL functions, sets the necesarry ones
 // for rendering and restores to previous state after rendering. Texture slots
 // are NOT restored because this would be expensive and probably meaningless
-// when the user of this library is sane.
+// when the user of this library is sane. Application may declare which state
+// it relies on, only that state is queried and restored.
 
 #ifndef GL_SETUP_H_
 #define GL_SETUP_H_
 
+#include "eyeGUI.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 namespace eyegui
@@ -23,18 +25,34 @@ namespace eyegui
 		// Initialization
 		void init();
 
+		// Set which state is stored and restored
+		void setRestoration(StateRestoration restoration);
+
 		// Store current state and set own
 		void setup(int viewportX, int viewportY, int viewportWidth, int viewportHeight);
 
 		// Reset stored state
 		void restore();
 
+		// Getter for state which is stored and restored
+		const StateRestoration& getRestoration() const { return mRestoration; }
+
+		// Getter for queries of state by last setup, issued and avoided
+		unsigned int getQueryCount() const { return mQueryCount; }
+		unsigned int getAvoidedQueryCount() const { return mAvoidedQueryCount; }
+
 	private:
 
 		// Set boolean capability
 		void setCapability(GLenum cap, GLboolean enable) const;
 
+		// Count queries of state, issued or avoided
+		void countQueries(bool issued, unsigned int count);
+
 		// Member
+		StateRestoration mRestoration;
+		unsigned int mQueryCount = 0;
+		unsigned int mAvoidedQueryCount = 0;
 		GLint mViewport[4];
 		GLboolean mBlend;
 		GLboolean mDepthMask;
@@ -42,9 +60,11 @@ namespace eyegui
 		GLint mBlendDst;
 		GLint mShaderProgram;
 		GLint mVertexArrayObject;
-		GLboolean mTexture2D;
 		GLint mActiveTexture;
 		GLboolean mCulling;
+		GLint mUniformBuffer;
+		GLint mArrayBuffer;
+		GLint mUnpackAlignment;
 	};
 }
 
@@ -143,10 +143,10 @@ namespace eyegui
             // Projection
             matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
 
-            mpLine->getShader()->fillValue("matrix", matrix);
-            mpLine->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpLine->getShader()->fillValue("alpha", mPoints[i].alpha.getValue());
-            mpLine->draw(GL_LINES);
+            mpLine->getShader()->fillValue(shaders::Uniform::MATRIX, matrix);
+            mpLine->getShader()->fillValue(shaders::Uniform::COLOR, mpGUI->getConfig()->gazeVisualizationColor);
+            mpLine->getShader()->fillValue(shaders::Uniform::ALPHA, mPoints[i].alpha.getValue());
+            mpLine->draw(RenderBackend::Primitive::LINES);
         }
 
         // Draw focus cycles
@@ -177,9 +177,9 @@ namespace eyegui
             matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
 
             // Set values
-            mpCircle->getShader()->fillValue("matrix", matrix);
-            mpCircle->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpCircle->getShader()->fillValue("alpha", rGazePoint.alpha.getValue());
+            mpCircle->getShader()->fillValue(shaders::Uniform::MATRIX, matrix);
+            mpCircle->getShader()->fillValue(shaders::Uniform::COLOR, mpGUI->getConfig()->gazeVisualizationColor);
+            mpCircle->getShader()->fillValue(shaders::Uniform::ALPHA, rGazePoint.alpha.getValue());
 
             // Draw
             mpCircle->draw();
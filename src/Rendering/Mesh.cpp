@@ -9,49 +9,41 @@
 
 namespace eyegui
 {
-	Mesh::Mesh(std::vector<float> const * const pVertices, std::vector<float> const * const pTextureCoordinates)
+	Mesh::Mesh(RenderBackend* pBackend, std::vector<float> const * const pVertices, std::vector<float> const * const pTextureCoordinates)
 	{
-		// Save currently set buffer
-		GLint oldBuffer;
-		glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
+		// Save members
+		mpBackend = pBackend;
 
 		// Vertex buffer
-		mVertexBuffer = 0;
-		glGenBuffers(1, &mVertexBuffer);
-		glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-		glBufferData(GL_ARRAY_BUFFER, pVertices->size() * sizeof(float), pVertices->data(), GL_STATIC_DRAW);
+		mVertexBuffer = mpBackend->createBuffer();
+		mpBackend->fillBuffer(mVertexBuffer, pVertices->data(), (uint)(pVertices->size() * sizeof(float)), false);
 
 		// Texture coordinate buffer
-		mTextureCoordinateBuffer = 0;
-		glGenBuffers(1, &mTextureCoordinateBuffer);
-		glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-		glBufferData(GL_ARRAY_BUFFER, pTextureCoordinates->size() * sizeof(float), pTextureCoordinates->data(), GL_STATIC_DRAW);
+		mTextureCoordinateBuffer = mpBackend->createBuffer();
+		mpBackend->fillBuffer(mTextureCoordinateBuffer, pTextureCoordinates->data(), (uint)(pTextureCoordinates->size() * sizeof(float)), false);
 
 		// Save vertex count
-		mVertexCount = static_cast<GLuint>(pVertices->size()) / 3;
-
-		// Restore old setting
-		glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+		mVertexCount = static_cast<uint>(pVertices->size()) / 3;
 	}
 
 	Mesh::~Mesh()
 	{
 		// Delete buffers
-		glDeleteBuffers(1, &mVertexBuffer);
-		glDeleteBuffers(1, &mTextureCoordinateBuffer);
+		mpBackend->deleteBuffer(mVertexBuffer);
+		mpBackend->deleteBuffer(mTextureCoordinateBuffer);
 	}
 
-	GLuint Mesh::getVertexCount() const
+	uint Mesh::getVertexCount() const
 	{
 		return mVertexCount;
 	}
 
-	GLuint Mesh::getVertexBuffer() const
+	uint Mesh::getVertexBuffer() const
 	{
 		return mVertexBuffer;
 	}
 
-	GLuint Mesh::getTextureCoordinateBuffer() const
+	uint Mesh::getTextureCoordinateBuffer() const
 	{
 		return mTextureCoordinateBuffer;
 	}
@@ -9,7 +9,7 @@
 #ifndef MESH_H_
 #define MESH_H_
 
-#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "Rendering/Backend/RenderBackend.h"
 
 #include <vector>
 
@@ -20,22 +20,23 @@ namespace eyegui
 	public:
 
 		// Constructor
-		Mesh(std::vector<float> const * const pVertices, std::vector<float> const * const pTextureCoordinates);
+		Mesh(RenderBackend* pBackend, std::vector<float> const * const pVertices, std::vector<float> const * const pTextureCoordinates);
 
 		// Deconstructor
 		virtual ~Mesh();
 
 		// Getter
-		GLuint getVertexCount() const;
-		GLuint getVertexBuffer() const;
-		GLuint getTextureCoordinateBuffer() const;
+		uint getVertexCount() const;
+		uint getVertexBuffer() const;
+		uint getTextureCoordinateBuffer() const;
 
 	private:
 
 		// Members
-		GLuint mVertexCount;
-		GLuint mVertexBuffer;
-		GLuint mTextureCoordinateBuffer;
+		RenderBackend* mpBackend;
+		uint mVertexCount;
+		uint mVertexBuffer;
+		uint mTextureCoordinateBuffer;
 	};
 }
 
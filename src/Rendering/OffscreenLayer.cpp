@@ -0,0 +1,101 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "OffscreenLayer.h"
+
+#include "GUI.h"
+#include "externals/GLM/glm/gtc/matrix_transform.hpp"
+
+namespace eyegui
+{
+    OffscreenLayer::OffscreenLayer(GUI const * pGUI, AssetManager* pAssetManager, RenderBackend* pBackend)
+    {
+        // Initialize members
+        mpGUI = pGUI;
+        mpBackend = pBackend;
+        mpRenderItem = pAssetManager->fetchRenderItem(shaders::Type::LAYER, meshes::Type::QUAD);
+        mTexture = 0;
+        mFramebuffer = 0;
+        mWidth = 0;
+        mHeight = 0;
+        mFilled = false;
+    }
+
+    OffscreenLayer::~OffscreenLayer()
+    {
+        if (mFramebuffer != 0)
+        {
+            mpBackend->deleteFramebuffer(mFramebuffer);
+            mpBackend->deleteTexture(mTexture);
+        }
+    }
+
+    bool OffscreenLayer::isOutdated() const
+    {
+        return !mFilled
+            || mWidth != mpGUI->getWindowWidth()
+            || mHeight != mpGUI->getWindowHeight();
+    }
+
+    void OffscreenLayer::invalidate()
+    {
+        mFilled = false;
+    }
+
+    void OffscreenLayer::beginRendering()
+    {
+        // Allocate texture in size of window, framebuffer keeps it attached
+        int width = mpGUI->getWindowWidth();
+        int height = mpGUI->getWindowHeight();
+        if (mFramebuffer == 0 || mWidth != width || mHeight != height)
+        {
+            if (mFramebuffer == 0)
+            {
+                mTexture = mpBackend->createTexture();
+            }
+            mpBackend->fillTexture(
+                mTexture,
+                width,
+                height,
+                RenderBackend::PixelFormat::RGBA,
+                NULL,
+                RenderBackend::TextureFilter::NEAREST,
+                RenderBackend::TextureFilter::NEAREST,
+                RenderBackend::TextureWrap::CLAMP);
+            if (mFramebuffer == 0)
+            {
+                mFramebuffer = mpBackend->createFramebuffer(mTexture);
+            }
+            mWidth = width;
+            mHeight = height;
+        }
+
+        mpBackend->beginFramebuffer(mFramebuffer, mWidth, mHeight);
+        mpGUI->getFrameStatisticsRecorder()->countLayerRendering();
+    }
+
+    void OffscreenLayer::endRendering()
+    {
+        mpBackend->endFramebuffer();
+        mFilled = true;
+    }
+
+    void OffscreenLayer::composite(float alpha) const
+    {
+        // Quad covers whole window
+        mpRenderItem->bind();
+        mpRenderItem->getShader()->fillValue(shaders::Uniform::MATRIX, glm::ortho(0.0f, 1.0f, 0.0f, 1.0f));
+        mpRenderItem->getShader()->fillValue(shaders::Uniform::ALPHA, alpha);
+        mpBackend->bindTexture(mTexture, 0);
+
+        // Colors of texture are already multiplied with alpha
+        mpBackend->setBlending(RenderBackend::Blending::PREMULTIPLIED);
+        mpRenderItem->draw();
+        mpBackend->setBlending(RenderBackend::Blending::ALPHA);
+        mpGUI->getFrameStatisticsRecorder()->countLayerComposition();
+    }
+}
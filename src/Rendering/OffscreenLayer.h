@@ -0,0 +1,62 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Offscreen copy of a layout or floating frame. Content is rendered into a
+// texture of window size only when it has changed, otherwise drawing is one
+// textured quad. Colors in texture are premultiplied with alpha, so alpha of
+// layout or frame is applied to the composited layer as a whole.
+
+#ifndef OFFSCREEN_LAYER_H_
+#define OFFSCREEN_LAYER_H_
+
+#include "AssetManager.h"
+#include "Rendering/Backend/RenderBackend.h"
+
+namespace eyegui
+{
+    // Forward declaration
+    class GUI;
+
+    class OffscreenLayer
+    {
+    public:
+
+        // Constructor
+        OffscreenLayer(GUI const * pGUI, AssetManager* pAssetManager, RenderBackend* pBackend);
+
+        // Destructor
+        virtual ~OffscreenLayer();
+
+        // Content must be rendered again, e.g. because nothing was rendered yet or window size changed
+        bool isOutdated() const;
+
+        // Forget rendered content
+        void invalidate();
+
+        // Following drawing goes into layer
+        void beginRendering();
+
+        // Following drawing goes into framebuffer of application again
+        void endRendering();
+
+        // Draw layer with alpha
+        void composite(float alpha) const;
+
+    private:
+
+        // Members
+        GUI const * mpGUI;
+        RenderBackend* mpBackend;
+        RenderItem const * mpRenderItem;
+        uint mTexture; // Created at first rendering
+        uint mFramebuffer;
+        int mWidth;
+        int mHeight;
+        bool mFilled;
+    };
+}
+
+#endif // OFFSCREEN_LAYER_H_
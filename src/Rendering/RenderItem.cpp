@@ -9,53 +9,45 @@
 
 namespace eyegui
 {
-    RenderItem::RenderItem(Shader const * pShader, Mesh const * pMesh)
+    RenderItem::RenderItem(RenderBackend* pBackend, Shader const * pShader, Mesh const * pMesh)
     {
         // Fill members
+        mpBackend = pBackend;
         mpShader = pShader;
         mpMesh = pMesh;
 
-        // Save currently set buffer and vertex array object
-        GLint oldBuffer, oldVAO;
-        glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
-        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
-
         // Vertex array object
-        mVertexArrayObject = 0;
-        glGenVertexArrays(1, &mVertexArrayObject);
-        glBindVertexArray(mVertexArrayObject);
+        mVertexArrayObject = mpBackend->createVertexArray();
 
         // Vertices
-        GLuint vertexAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "posAttribute");
-        glEnableVertexAttribArray(vertexAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mpMesh->getVertexBuffer());
-        glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        mpBackend->setVertexAttribute(
+            mVertexArrayObject,
+            mpShader->getAttributeLocation("posAttribute"),
+            mpMesh->getVertexBuffer(),
+            3);
 
         // Texture coordinates
-        GLuint uvAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "uvAttribute");
-        glEnableVertexAttribArray(uvAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mpMesh->getTextureCoordinateBuffer());
-        glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Restore old settings
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
-        glBindVertexArray(oldVAO);
+        mpBackend->setVertexAttribute(
+            mVertexArrayObject,
+            mpShader->getAttributeLocation("uvAttribute"),
+            mpMesh->getTextureCoordinateBuffer(),
+            2);
     }
 
     RenderItem::~RenderItem()
     {
-        glDeleteVertexArrays(1, &mVertexArrayObject);
+        mpBackend->deleteVertexArray(mVertexArrayObject);
     }
 
     void RenderItem::bind() const
     {
         mpShader->bind();
-        glBindVertexArray(mVertexArrayObject);
+        mpBackend->bindVertexArray(mVertexArrayObject);
     }
 
-    void RenderItem::draw(GLenum mode) const
+    void RenderItem::draw(RenderBackend::Primitive primitive) const
     {
-        glDrawArrays(mode, 0, mpMesh->getVertexCount());
+        mpBackend->drawArrays(primitive, mpMesh->getVertexCount());
     }
 
     Shader const * RenderItem::getShader() const
@@ -12,7 +12,7 @@
 
 #include "Shader.h"
 #include "Mesh.h"
-#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "Rendering/Backend/RenderBackend.h"
 
 namespace eyegui
 {
@@ -21,7 +21,7 @@ namespace eyegui
     public:
 
         // Constructor
-        RenderItem(Shader const * pShader, Mesh const * pMesh);
+        RenderItem(RenderBackend* pBackend, Shader const * pShader, Mesh const * pMesh);
 
         // Destructor
         virtual ~RenderItem();
@@ -30,7 +30,7 @@ namespace eyegui
         void bind() const;
 
         // Draw
-        void draw(GLenum mode = GL_TRIANGLES) const;
+        void draw(RenderBackend::Primitive primitive = RenderBackend::Primitive::TRIANGLES) const;
 
         // Get pointer to shader
         Shader const * getShader() const;
@@ -41,9 +41,10 @@ namespace eyegui
     private:
 
         // Member
+        RenderBackend* mpBackend;
         Shader const * mpShader;
         Mesh const * mpMesh;
-        GLuint mVertexArrayObject;
+        uint mVertexArrayObject;
     };
 }
 
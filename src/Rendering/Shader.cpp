@@ -7,120 +7,95 @@
 
 #include "Shader.h"
 
-#include "externals/GLM/glm/gtc/type_ptr.hpp"
-#include "OperationNotifier.h"
-
-#include <fstream>
-
 namespace eyegui
 {
-    Shader::Shader(char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
+    // Names of uniforms in shader sources, in order of enumeration
+    static const char* UNIFORM_NAMES[(int)shaders::Uniform::UNIFORM_COUNT] =
     {
-        // Vertex shader
-        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertexShader, 1, &pVertexShaderSource, NULL);
-        glCompileShader(vertexShader);
-        evaluateShaderLog(vertexShader);
-
-        // Fragment shader
-        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragmentShader, 1, &pFragmentShaderSource, NULL);
-        glCompileShader(fragmentShader);
-        evaluateShaderLog(fragmentShader);
-
-        // Create program
-        mShaderProgram = glCreateProgram();
-        glAttachShader(mShaderProgram, vertexShader);
-        glAttachShader(mShaderProgram, fragmentShader);
-        glLinkProgram(mShaderProgram);
-
-        // Delete shader
-        glDetachShader(mShaderProgram, fragmentShader);
-        glDetachShader(mShaderProgram, vertexShader);
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
-
-        // Extract all uniforms of shader
-        int total = -1;
-        glGetProgramiv(mShaderProgram, GL_ACTIVE_UNIFORMS, &total);
-        for (int i = 0; i < total; i++)
-        {
-            // Prepare some values
-            int nameLength = -1;
-            int number = -1;
-            GLenum type = GL_ZERO;
-            char name[100];
+        "matrix", "color", "alpha", "time",
+        "icon0", "icon1", "icon2", "icon3", "icon4", "icon5", "icon6", "icon7"
+    };
 
-            // Get information about uniform
-            glGetActiveUniform(mShaderProgram, GLuint(i), sizeof(name) - 1, &nameLength, &number, &type, name);
+    Shader::Shader(RenderBackend* pBackend, char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
+    {
+        // Save members
+        mpBackend = pBackend;
 
-            // Add end of string
-            name[nameLength] = 0;
+        // Create program
+        mShaderProgram = mpBackend->createShaderProgram(pVertexShaderSource, pFragmentShaderSource);
 
-            // Save mapping from name to location in map
-            mUniformLocationCache[name] = glGetUniformLocation(mShaderProgram, name);
+        // Resolve locations of known uniforms once
+        std::map<std::string, int> locations = mpBackend->getUniformLocations(mShaderProgram);
+        for (int i = 0; i < (int)shaders::Uniform::UNIFORM_COUNT; i++)
+        {
+            auto it = locations.find(UNIFORM_NAMES[i]);
+            mUniformLocations[i] = (it != locations.end()) ? it->second : -1;
         }
     }
 
     Shader::~Shader()
     {
-        glDeleteProgram(mShaderProgram);
+        mpBackend->deleteShaderProgram(mShaderProgram);
     }
 
     void Shader::bind() const
     {
-        glUseProgram(mShaderProgram);
+        mpBackend->useProgram(mShaderProgram);
     }
 
-    void Shader::fillValue(std::string location, const float rValue) const
+    void Shader::fillValue(shaders::Uniform uniform, const int rValue) const
     {
-        glUniform1fv(mUniformLocationCache.at(location), 1, &rValue);
+        int location = mUniformLocations[(int)uniform];
+        if (location >= 0) { mpBackend->setUniform(location, rValue); }
     }
 
-    void Shader::fillValue(std::string location, const glm::vec2& rValue) const
+    void Shader::fillValue(shaders::Uniform uniform, const float rValue) const
     {
-        glUniform2fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        int location = mUniformLocations[(int)uniform];
+        if (location >= 0) { mpBackend->setUniform(location, rValue); }
     }
 
-    void Shader::fillValue(std::string location, const glm::vec3& rValue) const
+    void Shader::fillValue(shaders::Uniform uniform, const glm::vec2& rValue) const
     {
-        glUniform3fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        int location = mUniformLocations[(int)uniform];
+        if (location >= 0) { mpBackend->setUniform(location, rValue); }
     }
 
-    void Shader::fillValue(std::string location, const glm::vec4& rValue) const
+    void Shader::fillValue(shaders::Uniform uniform, const glm::vec3& rValue) const
     {
-        glUniform4fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        int location = mUniformLocations[(int)uniform];
+        if (location >= 0) { mpBackend->setUniform(location, rValue); }
     }
 
-    void Shader::fillValue(std::string location, const glm::mat4x4& rValue) const
+    void Shader::fillValue(shaders::Uniform uniform, const glm::vec4& rValue) const
     {
-        glUniformMatrix4fv(mUniformLocationCache.at(location), 1, GL_FALSE, glm::value_ptr(rValue));
+        int location = mUniformLocations[(int)uniform];
+        if (location >= 0) { mpBackend->setUniform(location, rValue); }
     }
 
-    GLuint Shader::getShaderProgram() const
+    void Shader::fillValue(shaders::Uniform uniform, const glm::mat4x4& rValue) const
     {
-        return mShaderProgram;
+        int location = mUniformLocations[(int)uniform];
+        if (location >= 0) { mpBackend->setUniform(location, rValue); }
     }
 
-    void Shader::evaluateShaderLog(GLuint handle) const
+    bool Shader::hasUniform(shaders::Uniform uniform) const
     {
-        // Get length of compiling log
-        GLint log_length = 0;
-        glGetShaderiv(handle, GL_INFO_LOG_LENGTH, &log_length);
+        return mUniformLocations[(int)uniform] >= 0;
+    }
 
-        if (log_length > 1)
-        {
-            // Copy log to chars
-            GLchar *log = new GLchar[log_length];
-            glGetShaderInfoLog(handle, log_length, NULL, log);
+    void Shader::setUniformBlockBinding(std::string blockName, uint bindingPoint) const
+    {
+        mpBackend->setUniformBlockBinding(mShaderProgram, blockName, bindingPoint);
+    }
 
-            // Print it
-            throwError(
-                OperationNotifier::Operation::BUG,
-               "A shader throws errors at compilation:\n" + std::string(log));
+    uint Shader::getShaderProgram() const
+    {
+        return mShaderProgram;
+    }
 
-            // Delete chars
-            delete[] log;
-        }
+    int Shader::getAttributeLocation(std::string name) const
+    {
+        return mpBackend->getAttributeLocation(mShaderProgram, name);
     }
 }
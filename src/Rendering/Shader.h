@@ -9,20 +9,31 @@
 #ifndef SHADER_H_
 #define SHADER_H_
 
-#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "Rendering/Backend/RenderBackend.h"
 #include "externals/GLM/glm/glm.hpp"
 
 #include <string>
-#include <map>
+#include <array>
 
 namespace eyegui
 {
+	namespace shaders
+	{
+		// Uniforms which can be filled, resolved once per shader
+		enum class Uniform
+		{
+			MATRIX, COLOR, ALPHA, TIME,
+			ICON_0, ICON_1, ICON_2, ICON_3, ICON_4, ICON_5, ICON_6, ICON_7,
+			UNIFORM_COUNT
+		};
+	}
+
 	class Shader
 	{
 	public:
 
 		// Constructor
-		Shader(char const * const pVertexShader, char const * const pFragmentShader);
+		Shader(RenderBackend* pBackend, char const * const pVertexShader, char const * const pFragmentShader);
 
 		// Destructor
 		virtual ~Shader();
@@ -30,24 +41,32 @@ namespace eyegui
 		// Bind shader for filling uniforms and rendering
 		void bind() const;
 
-		// Fill value for rendering
-		void fillValue(std::string location, const float rValue) const;
-		void fillValue(std::string location, const glm::vec2& rValue) const;
-		void fillValue(std::string location, const glm::vec3& rValue) const;
-		void fillValue(std::string location, const glm::vec4& rValue) const;
-		void fillValue(std::string location, const glm::mat4x4& rValue) const;
+		// Fill value for rendering (ignored if uniform is not active in shader)
+		void fillValue(shaders::Uniform uniform, const int rValue) const;
+		void fillValue(shaders::Uniform uniform, const float rValue) const;
+		void fillValue(shaders::Uniform uniform, const glm::vec2& rValue) const;
+		void fillValue(shaders::Uniform uniform, const glm::vec3& rValue) const;
+		void fillValue(shaders::Uniform uniform, const glm::vec4& rValue) const;
+		void fillValue(shaders::Uniform uniform, const glm::mat4x4& rValue) const;
+
+		// Check whether uniform is active in shader
+		bool hasUniform(shaders::Uniform uniform) const;
+
+		// Connect uniform block with binding point of uniform buffers
+		void setUniformBlockBinding(std::string blockName, uint bindingPoint) const;
 
 		// Getter for handle
-		GLuint getShaderProgram() const;
+		uint getShaderProgram() const;
 
-	private:
+		// Getter for location of vertex attribute
+		int getAttributeLocation(std::string name) const;
 
-		// Evaluate shader compiling log
-		void evaluateShaderLog(GLuint handle) const;
+	private:
 
 		// Member
-		GLuint mShaderProgram;
-		std::map<std::string, int> mUniformLocationCache;
+		RenderBackend* mpBackend;
+		uint mShaderProgram;
+		std::array<int, (int)shaders::Uniform::UNIFORM_COUNT> mUniformLocations; // -1 if not active
 	};
 }
 
@@ -54,52 +54,227 @@ namespace eyegui
             "}\n";
 
         // Uniforms:
-        // vec4 separatorColor
-        // vec4 dimColor
+        // sampler2D atlas
         // float alpha
-        // float dimming
-        static const char* pSeparatorFragmentShader =
+        // vec4 color
+        static const char* pFontFragmentShader =
             "#version 330 core\n"
             "out vec4 fragColor;\n"
-            "uniform vec4 separatorColor;\n"
-            "uniform vec4 dimColor;\n"
-            "uniform float alpha;\n"
-            "uniform float dimming;\n"
+            "in vec2 uv;\n"
+            "uniform sampler2D atlas;\n"
+            "uniform vec4 color;\n"
             "void main() {\n"
-            "   vec4 col = separatorColor;\n"
-            "	col.rgba *= (1.0 - dimming) + (dimming * dimColor);\n" // Dimming
-            "   fragColor = vec4(col.rgb, col.a * alpha);\n"
+            "   float text = texture(atlas, uv).r;\n"
+            "   fragColor = vec4(color.rgb, color.a * text);\n"
             "}\n";
 
         // Uniforms:
         // sampler2D atlas
-        // float alpha
         // vec4 color
-        static const char* pFontFragmentShader =
+        static const char* pDistanceFieldFontFragmentShader =
             "#version 330 core\n"
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
             "uniform sampler2D atlas;\n"
             "uniform vec4 color;\n"
             "void main() {\n"
-            "   float text = texture(atlas, uv).r;\n"
+            "   float distance = texture(atlas, uv).r;\n"
+            "   float smoothing = 0.7 * fwidth(distance);\n"
+            "   float text = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);\n"
             "   fragColor = vec4(color.rgb, color.a * text);\n"
             "}\n";
 
         // Uniforms:
-        // vec4 backgroundColor
-        // vec4 dimColor
+        // sampler2D layer
         // float alpha
-        // float activity
-        // float dimming
-        static const char* pBlockFragmentShader =
+        static const char* pLayerFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "uniform sampler2D layer;\n"
+            "uniform float alpha = 1;\n"
+            "void main() {\n"
+            "   fragColor = alpha * texture(layer, uv);\n" // Colors of layer are premultiplied
+            "}\n";
+
+        // *** Shaders of elements ***
+        // Shaders of elements are composed of the version, declarations and a
+        // body. Values of an element are read either from a uniform block, which
+        // is filled with one upload per element, or from flat inputs of the
+        // instanced vertex shader, for drawing many elements at once. Both
+        // mirror the QuadInstance struct of the batch renderer. Aliases map the
+        // names used by the bodies onto these values, so bodies are shared by
+        // both variants. Icons are fetched via function, because instanced
+        // variant chooses between multiple texture slots and icons placed in
+        // pages of the icon atlas are read from their rectangle.
+
+        static const char* pShaderVersion =
+            "#version 330 core\n";
+
+        // Count of icon texture slots in instanced variant
+        static const int INSTANCED_ICON_SLOTS = 8;
+
+        // Binding point of uniform block with values of element
+        static const unsigned int QUAD_BLOCK_BINDING = 0;
+
+        // Name of uniform block with values of element
+        static const char* pQuadBlockName = "QuadBlock";
+
+        // Uniform block with same layout as QuadInstance (std140)
+        static const char* pQuadBlockDeclarations =
+            "layout(std140) uniform QuadBlock\n"
+            "{\n"
+            "   mat4 matrix;\n"
+            "   vec4 vColor;\n"
+            "   vec4 vHighlightColor;\n"
+            "   vec4 vSelectionColor;\n"
+            "   vec4 vIconColor;\n"
+            "   vec4 vDimColor;\n"
+            "   vec4 vState;\n" // Alpha, activity, dimming and highlight
+            "   vec4 vInteraction;\n" // Selection, threshold, pressing and penetration
+            "   vec4 vIcon;\n" // Scale of icon uv, orientation and slot
+            "   vec4 vIconRect;\n" // Offset and scale of icon uv in bound texture
+            "};\n";
+
+        // Vertex shader reading matrix from uniform block
+        static const char* pQuadBlockVertexShaderBody =
+            "in vec3 posAttribute;\n"
+            "in vec2 uvAttribute;\n"
+            "out vec2 uv;\n"
+            "void main() {\n"
+            "   uv = uvAttribute;\n"
+            "   gl_Position = matrix * vec4(posAttribute, 1);\n"
+            "}\n";
+
+        // Instance attributes are:
+        // mat4 instanceMatrix
+        // vec4 instanceColor
+        // vec4 instanceHighlightColor
+        // vec4 instanceSelectionColor
+        // vec4 instanceIconColor
+        // vec4 instanceDimColor
+        // vec4 instanceState (alpha, activity, dimming, highlight)
+        // vec4 instanceInteraction (selection, threshold, pressing, penetration)
+        // vec4 instanceIcon (iconUVScale, orientation, slot)
+        // vec4 instanceIconRect (offset and scale of icon uv in bound texture)
+        static const char* pInstancedVertexShader =
             "#version 330 core\n"
+            "in vec3 posAttribute;\n"
+            "in vec2 uvAttribute;\n"
+            "in mat4 instanceMatrix;\n"
+            "in vec4 instanceColor;\n"
+            "in vec4 instanceHighlightColor;\n"
+            "in vec4 instanceSelectionColor;\n"
+            "in vec4 instanceIconColor;\n"
+            "in vec4 instanceDimColor;\n"
+            "in vec4 instanceState;\n"
+            "in vec4 instanceInteraction;\n"
+            "in vec4 instanceIcon;\n"
+            "in vec4 instanceIconRect;\n"
+            "out vec2 uv;\n"
+            "flat out vec4 vColor;\n"
+            "flat out vec4 vHighlightColor;\n"
+            "flat out vec4 vSelectionColor;\n"
+            "flat out vec4 vIconColor;\n"
+            "flat out vec4 vDimColor;\n"
+            "flat out vec4 vState;\n"
+            "flat out vec4 vInteraction;\n"
+            "flat out vec4 vIcon;\n"
+            "flat out vec4 vIconRect;\n"
+            "void main() {\n"
+            "   uv = uvAttribute;\n"
+            "   vColor = instanceColor;\n"
+            "   vHighlightColor = instanceHighlightColor;\n"
+            "   vSelectionColor = instanceSelectionColor;\n"
+            "   vIconColor = instanceIconColor;\n"
+            "   vDimColor = instanceDimColor;\n"
+            "   vState = instanceState;\n"
+            "   vInteraction = instanceInteraction;\n"
+            "   vIcon = instanceIcon;\n"
+            "   vIconRect = instanceIconRect;\n"
+            "   gl_Position = instanceMatrix * vec4(posAttribute, 1);\n"
+            "}\n";
+
+        // Uniforms:
+        // sampler2D icon0 .. icon7
+        static const char* pInstancedFragmentShaderDeclarations =
+            "flat in vec4 vColor;\n"
+            "flat in vec4 vHighlightColor;\n"
+            "flat in vec4 vSelectionColor;\n"
+            "flat in vec4 vIconColor;\n"
+            "flat in vec4 vDimColor;\n"
+            "flat in vec4 vState;\n"
+            "flat in vec4 vInteraction;\n"
+            "flat in vec4 vIcon;\n"
+            "flat in vec4 vIconRect;\n"
+            "uniform sampler2D icon0;\n"
+            "uniform sampler2D icon1;\n"
+            "uniform sampler2D icon2;\n"
+            "uniform sampler2D icon3;\n"
+            "uniform sampler2D icon4;\n"
+            "uniform sampler2D icon5;\n"
+            "uniform sampler2D icon6;\n"
+            "uniform sampler2D icon7;\n"
+            "vec4 fetchIconTexture(vec2 coord) {\n" // Samplers may only be indexed by constants in GLSL 3.30
+            "   int slot = int(vIcon.w + 0.5);\n"
+            "   if (slot == 0) { return texture(icon0, coord); }\n"
+            "   else if (slot == 1) { return texture(icon1, coord); }\n"
+            "   else if (slot == 2) { return texture(icon2, coord); }\n"
+            "   else if (slot == 3) { return texture(icon3, coord); }\n"
+            "   else if (slot == 4) { return texture(icon4, coord); }\n"
+            "   else if (slot == 5) { return texture(icon5, coord); }\n"
+            "   else if (slot == 6) { return texture(icon6, coord); }\n"
+            "   return texture(icon7, coord);\n"
+            "}\n";
+
+        // Uniforms:
+        // sampler2D icon
+        static const char* pIconFragmentShaderDeclarations =
+            "uniform sampler2D icon;\n"
+            "vec4 fetchIconTexture(vec2 coord) {\n"
+            "   return texture(icon, coord);\n"
+            "}\n";
+
+        // Icons in pages of atlas are clamped to their rectangle. Textures of
+        // their own cover the whole rectangle and wrap as they are set
+        static const char* pIconFetchDeclarations =
+            "vec4 fetchIcon(vec2 coord) {\n"
+            "   if (vIconRect.z < 1.0 || vIconRect.w < 1.0) { coord = clamp(coord, 0.0, 1.0); }\n"
+            "   return fetchIconTexture(vIconRect.xy + coord * vIconRect.zw);\n"
+            "}\n";
+
+        // Uniforms:
+        // float time
+        static const char* pQuadFragmentShaderAliases =
+            "uniform float time;\n"
+            "#define color vColor\n"
+            "#define backgroundColor vColor\n"
+            "#define separatorColor vColor\n"
+            "#define highlightColor vHighlightColor\n"
+            "#define selectionColor vSelectionColor\n"
+            "#define iconColor vIconColor\n"
+            "#define dimColor vDimColor\n"
+            "#define alpha vState.x\n"
+            "#define activity vState.y\n"
+            "#define dimming vState.z\n"
+            "#define highlight vState.w\n"
+            "#define selection vInteraction.x\n"
+            "#define threshold vInteraction.y\n"
+            "#define pressing vInteraction.z\n"
+            "#define penetration vInteraction.w\n"
+            "#define iconUVScale vIcon.xy\n"
+            "#define orientation vIcon.z\n";
+
+        static const char* pSeparatorFragmentShaderBody =
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "   vec4 col = separatorColor;\n"
+            "	col.rgba *= (1.0 - dimming) + (dimming * dimColor);\n" // Dimming
+            "   fragColor = vec4(col.rgb, col.a * alpha);\n"
+            "}\n";
+
+        static const char* pBlockFragmentShaderBody =
             "out vec4 fragColor;\n"
-            "uniform vec4 backgroundColor;\n"
-            "uniform vec4 dimColor;\n"
-            "uniform float alpha;\n"
-            "uniform float activity;\n"
-            "uniform float dimming;\n"
             "void main() {\n"
             "   vec4 col = backgroundColor;\n"
             "   col.rgb = mix(vec3(0.3,0.3,0.3), col.rgb, max(0.2, activity));\n" // Activity
@@ -107,66 +282,24 @@ namespace eyegui
             "   fragColor = vec4(col.rgb, col.a * alpha);\n"
             "}\n";
 
-        // Uniforms:
-        // sampler2D icon
-        // vec4 dimColor
-        // float alpha
-        // float activity
-        // float dimming
-        static const char* pPictureFragmentShader =
-            "#version 330 core\n"
+        static const char* pPictureFragmentShaderBody =
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
-            "uniform sampler2D icon;\n"
-            "uniform vec4 dimColor;\n"
-            "uniform float alpha;\n"
-            "uniform float activity;\n"
-            "uniform float dimming;\n"
             "void main() {\n"
-            "   vec4 col = texture(icon, uv);\n"
+            "   vec4 col = fetchIcon(uv);\n"
             "   col.rgb = mix(vec3(0.3,0.3,0.3), col.rgb, max(0.2, activity));\n" // Activity
             "	col.rgba *= (1.0 - dimming) + (dimming * dimColor);\n" // Dimming
             "   fragColor = vec4(col.rgb, col.a * alpha);\n"
             "}\n";
 
-        // Uniforms:
-        // sampler2D icon
-        // float time
-        // vec4 color
-        // vec4 highlightColor
-        // vec4 selectionColor
-        // vec4 iconColor
-        // vec4 dimColor
-        // float threshold
-        // float pressing
-        // float highlight
-        // float alpha
-        // float activity
-        // float dimming
-        // float selection
-        static const char* pCircleButtonFragmentShader =
-            "#version 330 core\n"
+        static const char* pCircleButtonFragmentShaderBody =
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
-            "uniform sampler2D icon;\n"
-            "uniform float time;\n"
-            "uniform vec4 color = vec4(1,1,0,1);\n"
-            "uniform vec4 highlightColor = vec4(0,1,0,1);\n"
-            "uniform vec4 selectionColor = vec4(0,1,1,0.5);\n"
-            "uniform vec4 iconColor = vec4(1,1,1,1);\n"
-            "uniform vec4 dimColor;\n"
-            "uniform float threshold = 0;\n" // How much pressing threshold [0..1]
-            "uniform float pressing = 0;\n" // How much pressed [0..1]
-            "uniform float highlight = 0;\n" // How much highlighted [0..1]
-            "uniform float alpha;\n"
-            "uniform float activity;\n"
-            "uniform float dimming;\n"
-            "uniform float selection = 1;\n"
             "const int bodyPressBorder = 20;\n"
             "void main() {\n"
             "   float sinPressing = sin(0.5 * 3.14 * pressing);\n" // Pressing value
             "   float iconScale = mix(1, 1.5, sinPressing);\n" // Icon scale by pressing value
-            "   vec4 iconValue = iconColor * texture(icon, ((uv - 0.5) * iconScale) + 0.5).rgba;\n" // Fetch icon
+            "   vec4 iconValue = iconColor * fetchIcon(((uv - 0.5) * iconScale) + 0.5).rgba;\n" // Fetch icon
             "   float gradient = length(2*uv-1);\n" // Simple gradient as base
             "   float circle = (1-gradient) * 75;\n" // Extend gradient to unclamped circle
             "   float bodyMask = clamp(circle - bodyPressBorder * sinPressing + 0.5, 0, 1);\n" // Body mask (Adding 0.5 to hide background border when not pressing)
@@ -182,50 +315,16 @@ namespace eyegui
             "   fragColor = vec4(button.rgb, button.a * buttonMask * alpha);\n" // Composing pixel
             "}\n";
 
-        // Uniforms:
-        // sampler2D icon
-        // float time
-        // vec4 color
-        // vec4 highlightColor
-        // vec4 selectionColor
-        // vec4 iconColor
-        // vec4 dimColor
-        // float threshold
-        // float pressing
-        // float highlight
-        // float alpha
-        // float activity
-        // float dimming
-        // float selection
-        // vec2 iconUVScale
-        // float orientation
-        static const char* pBoxButtonFragmentShader =
-            "#version 330 core\n"
+        static const char* pBoxButtonFragmentShaderBody =
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
-            "uniform sampler2D icon;\n"
-            "uniform float time;\n"
-            "uniform vec4 color = vec4(1,0,0,1);\n"
-            "uniform vec4 highlightColor = vec4(0,1,0,1);\n"
-            "uniform vec4 selectionColor = vec4(0,1,1,0.5);\n"
-            "uniform vec4 iconColor = vec4(1,1,1,1);\n"
-            "uniform vec4 dimColor;\n"
-            "uniform float threshold = 0;\n" // How much pressing threshold [0..1]
-            "uniform float pressing = 0;\n" // How much pressed [0..1]
-            "uniform float highlight= 0;\n" // How much highlighted [0..1]
-            "uniform float alpha;\n"
-            "uniform float activity;\n"
-            "uniform float dimming;\n"
-            "uniform float selection = 1;\n"
-            "uniform vec2 iconUVScale;\n"
-            "uniform float orientation;\n"
             "const int bodyPressBorder = 40;\n"
             "void main() {\n"
             "   float sinPressing = sin(0.5 * 3.14 * pressing);\n" // Pressing value
             "   float iconScale = mix(1, 1.5, sinPressing);\n" // Icon scale by pressing value
             "   vec2 iconUV = ((uv - 0.5) * iconScale);\n" // Fetch icon
             "   iconUV = vec2(iconUV.r * iconUVScale.x, iconUV.g * iconUVScale.y) + 0.5;\n" // Icon scale by aspect ratio
-            "   vec4 iconValue = iconColor *  texture(icon, iconUV).rgba;\n" // Fetch value of pixel
+            "   vec4 iconValue = iconColor * fetchIcon(iconUV).rgba;\n" // Fetch value of pixel
             "   float iconAlphaMask = clamp(iconUV.r * 1000, 0 , 1) - clamp((iconUV.r - 1) * 1000, 0, 1);" // Create horizontal mask
             "   iconAlphaMask *= clamp(iconUV.g * 1000, 0 , 1) - clamp((iconUV.g - 1) * 1000, 0, 1);" // Add vertical mask
             "   iconValue.a *= iconAlphaMask;\n" // Mask to hide clamping area
@@ -245,46 +344,16 @@ namespace eyegui
             "   fragColor = vec4(button.rgb, button.a * alpha);\n" // Composing pixel
             "}\n";
 
-        // Uniforms:
-        // sampler2D icon
-        // float time
-        // vec4 color
-        // vec4 highlightColor
-        // vec4 selectionColor
-        // vec4 iconColor
-        // vec4 dimColor
-        // float penetration
-        // float highlight
-        // float alpha
-        // float activity
-        // float dimming
-        // float selection
-        // vec2 iconUVScale
-        static const char* pSensorFragmentShader =
-            "#version 330 core\n"
+        static const char* pSensorFragmentShaderBody =
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
-            "uniform sampler2D icon;\n"
-            "uniform float time;\n"
-            "uniform vec4 color = vec4(1,0,0,1);\n"
-            "uniform vec4 highlightColor = vec4(0,1,0,1);\n"
-            "uniform vec4 selectionColor = vec4(0,1,1,0.5);\n"
-            "uniform vec4 iconColor = vec4(1,1,1,1);\n"
-            "uniform vec4 dimColor;\n"
-            "uniform float penetration = 0;\n" // How much penentration [0..1]
-            "uniform float highlight= 1.0;\n" // How much highlighted [0..1]
-            "uniform float alpha;\n"
-            "uniform float activity;\n"
-            "uniform float dimming;\n"
-            "uniform float selection = 1;\n"
-            "uniform vec2 iconUVScale;\n"
             "const int bodyPressBorder = 40;\n"
             "void main() {\n"
             "   float sinPressing = sin(0.5 * 3.14 * penetration);\n" // Pressing value
             "   float iconScale = mix(1, 1.5, sinPressing);\n" // Icon scale by pressing value
             "   vec2 iconUV = ((uv - 0.5) * iconScale);\n" // Fetch icon
             "   iconUV = vec2(iconUV.r * iconUVScale.x, iconUV.g * iconUVScale.y) + 0.5;\n" // Icon scale by aspect ratio
-            "   vec4 iconValue = iconColor *  texture(icon, iconUV).rgba;\n" // Fetch value of pixel
+            "   vec4 iconValue = iconColor * fetchIcon(iconUV).rgba;\n" // Fetch value of pixel
             "   float iconAlphaMask = clamp(iconUV.r * 1000, 0 , 1) - clamp((iconUV.r - 1) * 1000, 0, 1);" // Create horizontal mask
             "   iconAlphaMask *= clamp(iconUV.g * 1000, 0 , 1) - clamp((iconUV.g - 1) * 1000, 0, 1);" // Add vertical mask
             "   iconValue.a *= iconAlphaMask;\n" // Mask to hide clamping area
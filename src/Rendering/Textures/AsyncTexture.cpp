@@ -0,0 +1,39 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "AsyncTexture.h"
+
+namespace eyegui
+{
+    AsyncTexture::AsyncTexture(RenderBackend* pBackend, Filtering filtering, Wrap wrap, IconAtlas* pAtlas) : Texture(pBackend, pAtlas)
+    {
+        // Initialize members
+        mFiltering = filtering;
+        mWrap = wrap;
+        mReplaced = false;
+
+        // Transparent pixel as placeholder
+        std::vector<uchar> placeholder(4, 0);
+        createTexture(placeholder.data(), Filtering::NEAREST, mWrap, 1, 1, 4);
+    }
+
+    AsyncTexture::~AsyncTexture()
+    {
+        // Nothing to do
+    }
+
+    void AsyncTexture::replace(const Image& rImage)
+    {
+        createTexture(rImage.getPixels(), mFiltering, mWrap, rImage.width, rImage.height, rImage.channelCount, rImage.flipped);
+        mReplaced = true;
+    }
+
+    bool AsyncTexture::isLoaded() const
+    {
+        return mReplaced;
+    }
+}
@@ -0,0 +1,44 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Specialization of texture for images decoded in background. Shows a
+// transparent placeholder until the asset manager replaces its content with
+// the decoded image. Elements keep their pointer to the texture.
+
+#ifndef ASYNC_TEXTURE_H_
+#define ASYNC_TEXTURE_H_
+
+#include "Texture.h"
+#include "Image.h"
+
+namespace eyegui
+{
+	class AsyncTexture : public Texture
+	{
+	public:
+
+		// Constructor
+		AsyncTexture(RenderBackend* pBackend, Filtering filtering, Wrap wrap, IconAtlas* pAtlas = NULL);
+
+		// Destructor
+		virtual ~AsyncTexture();
+
+		// Replace placeholder by decoded image
+		void replace(const Image& rImage);
+
+		// Is placeholder replaced
+		virtual bool isLoaded() const;
+
+	private:
+
+		// Members
+		Filtering mFiltering;
+		Wrap mWrap;
+		bool mReplaced;
+	};
+}
+
+#endif // ASYNC_TEXTURE_H_
@@ -0,0 +1,411 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "IconAtlas.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    IconAtlas::IconAtlas(RenderBackend* pBackend)
+    {
+        // Initialize members
+        mpBackend = pBackend;
+        mMaxPageSize = std::min((uint)std::max(mpBackend->getMaxTextureSize(), 1), ICON_ATLAS_MAX_PAGE_SIZE);
+    }
+
+    IconAtlas::~IconAtlas()
+    {
+        for (const auto& rupPage : mPages)
+        {
+            mpBackend->deleteTexture(rupPage->texture);
+        }
+    }
+
+    bool IconAtlas::insert(Texture* pTexture, uchar const * pData, uint width, uint height, uint channelCount, Texture::Filtering filtering)
+    {
+        // Large textures would fill pages on their own. With mipmaps, size is rounded up to
+        // texels of deepest level, so each of its texels belongs to a single icon
+        uint paddedWidth = width + 2 * ICON_ATLAS_PADDING;
+        uint paddedHeight = height + 2 * ICON_ATLAS_PADDING;
+        if (filtering == Texture::Filtering::LINEAR)
+        {
+            paddedWidth = (paddedWidth + ICON_ATLAS_PADDING - 1) / ICON_ATLAS_PADDING * ICON_ATLAS_PADDING;
+            paddedHeight = (paddedHeight + ICON_ATLAS_PADDING - 1) / ICON_ATLAS_PADDING * ICON_ATLAS_PADDING;
+        }
+        if (width == 0
+            || height == 0
+            || std::max(width, height) > ICON_ATLAS_MAX_ICON_SIZE
+            || std::max(paddedWidth, paddedHeight) > mMaxPageSize)
+        {
+            return false;
+        }
+
+        // Copy pixels into RGBA with border pixels repeated into padding. Missing
+        // channels are filled like sampling of textures with less channels does
+        std::unique_ptr<Icon> upIcon = std::unique_ptr<Icon>(new Icon);
+        upIcon->pTexture = pTexture;
+        upIcon->x = 0;
+        upIcon->y = 0;
+        upIcon->width = paddedWidth;
+        upIcon->height = paddedHeight;
+        upIcon->pixelWidth = width;
+        upIcon->pixelHeight = height;
+        upIcon->shelf = 0;
+        std::vector<uchar> pixels((size_t)paddedWidth * paddedHeight * 4);
+        uchar* pPixel = pixels.data();
+        for (uint y = 0; y < paddedHeight; y++)
+        {
+            uint sourceY = (uint)std::min(std::max((int)y - (int)ICON_ATLAS_PADDING, 0), (int)height - 1);
+            for (uint x = 0; x < paddedWidth; x++)
+            {
+                uint sourceX = (uint)std::min(std::max((int)x - (int)ICON_ATLAS_PADDING, 0), (int)width - 1);
+                uchar const * pSource = pData + ((size_t)sourceY * width + sourceX) * channelCount;
+                switch (channelCount)
+                {
+                case 1:
+                    pPixel[0] = pSource[0];
+                    pPixel[1] = 0;
+                    pPixel[2] = 0;
+                    pPixel[3] = 255;
+                    break;
+                case 3:
+                    pPixel[0] = pSource[0];
+                    pPixel[1] = pSource[1];
+                    pPixel[2] = pSource[2];
+                    pPixel[3] = 255;
+                    break;
+                default:
+                    pPixel[0] = pSource[0];
+                    pPixel[1] = pSource[1];
+                    pPixel[2] = pSource[2];
+                    pPixel[3] = pSource[3];
+                    break;
+                }
+                pPixel += 4;
+            }
+        }
+
+        // Use free space of existing pages
+        for (const auto& rupPage : mPages)
+        {
+            Page& rPage = *(rupPage.get());
+            if (rPage.filtering == filtering
+                && allocate(rPage, upIcon->width, upIcon->height, upIcon->x, upIcon->y, upIcon->shelf))
+            {
+                rPage.usedArea += upIcon->width * upIcon->height;
+                upload(rPage, *(upIcon.get()), pixels.data());
+                mPagesOfTextures[pTexture] = &rPage;
+                rPage.icons.push_back(std::move(upIcon));
+                return true;
+            }
+        }
+
+        // Pack pages again, which removes fragmentation, first at their size and then larger
+        uint area = upIcon->width * upIcon->height;
+        for (int grow = 0; grow < 2; grow++)
+        {
+            for (const auto& rupPage : mPages)
+            {
+                Page& rPage = *(rupPage.get());
+                uint size = grow > 0 ? rPage.size * 2 : rPage.size;
+                if (rPage.filtering == filtering
+                    && size <= mMaxPageSize
+                    && rPage.usedArea + area <= size * size
+                    && repack(rPage, size, upIcon, pixels.data()))
+                {
+                    return true;
+                }
+            }
+        }
+
+        // Create new page, large enough for icon. Texture is created by packing
+        std::unique_ptr<Page> upPage = std::unique_ptr<Page>(new Page);
+        upPage->texture = 0;
+        upPage->size = std::min(ICON_ATLAS_MIN_PAGE_SIZE, mMaxPageSize);
+        while (upPage->size < std::max(paddedWidth, paddedHeight))
+        {
+            upPage->size *= 2;
+        }
+        upPage->size = std::min(upPage->size, mMaxPageSize);
+        upPage->filtering = filtering;
+        upPage->usedArea = 0;
+        upPage->mipmapsOutdated = false;
+        if (!repack(*(upPage.get()), upPage->size, upIcon, pixels.data()))
+        {
+            return false;
+        }
+        mPages.push_back(std::move(upPage));
+        return true;
+    }
+
+    void IconAtlas::remove(Texture const * pTexture)
+    {
+        auto it = mPagesOfTextures.find(pTexture);
+        if (it == mPagesOfTextures.end())
+        {
+            return;
+        }
+        Page& rPage = *(it->second);
+        mPagesOfTextures.erase(it);
+
+        // Free space of icon
+        for (uint i = 0; i < rPage.icons.size(); i++)
+        {
+            if (rPage.icons[i]->pTexture == pTexture)
+            {
+                deallocate(rPage, *(rPage.icons[i].get()));
+                rPage.usedArea -= rPage.icons[i]->width * rPage.icons[i]->height;
+                rPage.icons.erase(rPage.icons.begin() + i);
+                break;
+            }
+        }
+
+        // Delete empty page
+        if (rPage.icons.empty())
+        {
+            mpBackend->deleteTexture(rPage.texture);
+            for (uint i = 0; i < mPages.size(); i++)
+            {
+                if (mPages[i].get() == &rPage)
+                {
+                    mPages.erase(mPages.begin() + i);
+                    break;
+                }
+            }
+        }
+    }
+
+    void IconAtlas::generateMipmaps()
+    {
+        for (const auto& rupPage : mPages)
+        {
+            if (rupPage->mipmapsOutdated)
+            {
+                mpBackend->generateMipmaps(rupPage->texture, ICON_ATLAS_MAX_MIPMAP_LEVEL);
+                rupPage->mipmapsOutdated = false;
+            }
+        }
+    }
+
+    bool IconAtlas::allocate(Page& rPage, uint width, uint height, uint& rX, uint& rY, uint& rShelfIndex) const
+    {
+        // Choose flattest shelf with free span, which does not waste more than a quarter of its height
+        int bestShelf = -1;
+        uint bestSpan = 0;
+        for (uint i = 0; i < rPage.shelves.size(); i++)
+        {
+            const Shelf& rShelf = rPage.shelves[i];
+            if (rShelf.height < height
+                || 3 * rShelf.height > 4 * height
+                || (bestShelf >= 0 && rShelf.height >= rPage.shelves[bestShelf].height))
+            {
+                continue;
+            }
+            for (uint j = 0; j < rShelf.freeSpans.size(); j++)
+            {
+                if (rShelf.freeSpans[j].width >= width)
+                {
+                    bestShelf = (int)i;
+                    bestSpan = j;
+                    break;
+                }
+            }
+        }
+
+        // Open new shelf above others
+        if (bestShelf < 0)
+        {
+            uint y = rPage.shelves.empty() ? 0 : rPage.shelves.back().y + rPage.shelves.back().height;
+            if (width > rPage.size || y + height > rPage.size)
+            {
+                return false;
+            }
+            Shelf shelf;
+            shelf.y = y;
+            shelf.height = height;
+            Span span;
+            span.x = 0;
+            span.width = rPage.size;
+            shelf.freeSpans.push_back(span);
+            rPage.shelves.push_back(shelf);
+            bestShelf = (int)rPage.shelves.size() - 1;
+            bestSpan = 0;
+        }
+
+        // Take beginning of span
+        Shelf& rShelf = rPage.shelves[bestShelf];
+        Span& rSpan = rShelf.freeSpans[bestSpan];
+        rX = rSpan.x;
+        rY = rShelf.y;
+        rShelfIndex = (uint)bestShelf;
+        rSpan.x += width;
+        rSpan.width -= width;
+        if (rSpan.width == 0)
+        {
+            rShelf.freeSpans.erase(rShelf.freeSpans.begin() + bestSpan);
+        }
+        return true;
+    }
+
+    void IconAtlas::deallocate(Page& rPage, const Icon& rIcon) const
+    {
+        // Insert span sorted by position
+        Shelf& rShelf = rPage.shelves[rIcon.shelf];
+        Span span;
+        span.x = rIcon.x;
+        span.width = rIcon.width;
+        auto it = std::lower_bound(rShelf.freeSpans.begin(), rShelf.freeSpans.end(), span,
+            [](const Span& rA, const Span& rB) { return rA.x < rB.x; });
+        it = rShelf.freeSpans.insert(it, span);
+
+        // Merge with following and preceding span
+        auto next = it + 1;
+        if (next != rShelf.freeSpans.end() && it->x + it->width == next->x)
+        {
+            it->width += next->width;
+            rShelf.freeSpans.erase(next);
+        }
+        if (it != rShelf.freeSpans.begin())
+        {
+            auto previous = it - 1;
+            if (previous->x + previous->width == it->x)
+            {
+                previous->width += it->width;
+                rShelf.freeSpans.erase(it);
+            }
+        }
+
+        // Remove empty shelves at top, so their height can be used by others
+        while (!rPage.shelves.empty()
+            && rPage.shelves.back().freeSpans.size() == 1
+            && rPage.shelves.back().freeSpans.front().width == rPage.size)
+        {
+            rPage.shelves.pop_back();
+        }
+    }
+
+    bool IconAtlas::repack(Page& rPage, uint size, std::unique_ptr<Icon>& rupIcon, uchar const * pPixels)
+    {
+        // Place tall icons first, so shelves waste little height
+        std::vector<Icon*> icons;
+        for (const auto& rupPageIcon : rPage.icons)
+        {
+            icons.push_back(rupPageIcon.get());
+        }
+        icons.push_back(rupIcon.get());
+        std::stable_sort(icons.begin(), icons.end(),
+            [](Icon const * pA, Icon const * pB)
+        {
+            if (pA->height != pB->height) { return pA->height > pB->height; }
+            return pA->width > pB->width;
+        });
+
+        // Find positions on empty page without touching the icons
+        Page packed;
+        packed.size = size;
+        std::vector<uint> positions(icons.size() * 3);
+        for (uint i = 0; i < icons.size(); i++)
+        {
+            if (!allocate(packed, icons[i]->width, icons[i]->height, positions[3 * i], positions[3 * i + 1], positions[3 * i + 2]))
+            {
+                return false;
+            }
+        }
+
+        // Icons may overlap their old positions, so they are copied into new texture
+        uint oldTexture = rPage.texture;
+        rPage.texture = mpBackend->createTexture();
+        rPage.size = size;
+        createPageTexture(rPage);
+
+        // Take over positions
+        rPage.shelves = std::move(packed.shelves);
+        std::vector<RenderBackend::TextureRegionCopy> copies;
+        for (uint i = 0; i < icons.size(); i++)
+        {
+            if (icons[i] != rupIcon.get())
+            {
+                RenderBackend::TextureRegionCopy copy;
+                copy.sourceX = (int)icons[i]->x;
+                copy.sourceY = (int)icons[i]->y;
+                copy.targetX = (int)positions[3 * i];
+                copy.targetY = (int)positions[3 * i + 1];
+                copy.width = (int)icons[i]->width;
+                copy.height = (int)icons[i]->height;
+                copies.push_back(copy);
+            }
+            icons[i]->x = positions[3 * i];
+            icons[i]->y = positions[3 * i + 1];
+            icons[i]->shelf = positions[3 * i + 2];
+        }
+
+        // Copy icons of page at their new position and delete old texture
+        if (oldTexture != 0)
+        {
+            if (!copies.empty())
+            {
+                mpBackend->copyTextureRegions(oldTexture, rPage.texture, copies);
+            }
+            mpBackend->deleteTexture(oldTexture);
+        }
+        for (const auto& rupPageIcon : rPage.icons)
+        {
+            place(rPage, *(rupPageIcon.get()));
+        }
+
+        // Upload additional icon
+        rPage.usedArea += rupIcon->width * rupIcon->height;
+        mPagesOfTextures[rupIcon->pTexture] = &rPage;
+        upload(rPage, *(rupIcon.get()), pPixels);
+        rPage.icons.push_back(std::move(rupIcon));
+        return true;
+    }
+
+    void IconAtlas::createPageTexture(Page& rPage) const
+    {
+        // Allocate memory only, icons are uploaded afterwards
+        bool linear = rPage.filtering == Texture::Filtering::LINEAR;
+        mpBackend->fillTexture(
+            rPage.texture,
+            rPage.size,
+            rPage.size,
+            RenderBackend::PixelFormat::RGBA,
+            NULL,
+            linear ? RenderBackend::TextureFilter::LINEAR_MIPMAP : RenderBackend::TextureFilter::NEAREST,
+            linear ? RenderBackend::TextureFilter::LINEAR : RenderBackend::TextureFilter::NEAREST,
+            RenderBackend::TextureWrap::CLAMP);
+    }
+
+    void IconAtlas::upload(Page& rPage, const Icon& rIcon, uchar const * pPixels) const
+    {
+        mpBackend->fillTextureRegion(
+            rPage.texture,
+            rIcon.x,
+            rIcon.y,
+            rIcon.width,
+            rIcon.height,
+            RenderBackend::PixelFormat::RGBA,
+            pPixels);
+        place(rPage, rIcon);
+    }
+
+    void IconAtlas::place(Page& rPage, const Icon& rIcon) const
+    {
+        rPage.mipmapsOutdated = rPage.filtering == Texture::Filtering::LINEAR;
+
+        // Texture binds page and samples inside padding
+        float size = (float)rPage.size;
+        rIcon.pTexture->placeInAtlas(
+            rPage.texture,
+            glm::vec4(
+                (float)(rIcon.x + ICON_ATLAS_PADDING) / size,
+                (float)(rIcon.y + ICON_ATLAS_PADDING) / size,
+                (float)rIcon.pixelWidth / size,
+                (float)rIcon.pixelHeight / size));
+    }
+}
@@ -0,0 +1,124 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Pages shared by textures of icons, so buttons with different icons are
+// drawn without switching textures. Textures decide at creation whether they
+// are placed in a page; then they bind the page and tell the rectangle of
+// their pixels in it. Pages hold RGBA pixels and are separated by filtering.
+// Every icon is surrounded by copies of its border pixels, so filtering and
+// mipmaps behave like clamping at the border of a texture of its own. Mipmaps
+// of pages stop at the level where padding shrinks to one texel, and icons
+// are aligned to texels of that level, so no level mixes in the pixels of
+// neighbouring icons. Pages are packed into shelves. Freed space is reused by
+// icons of similar height. When an icon does not fit, a page is packed again
+// from scratch, at twice its size if necessary, and only then a new page is
+// created. Packing copies icons from the old texture of the page into a new
+// one on the GPU, so no pixels of icons are kept in memory.
+
+#ifndef ICON_ATLAS_H_
+#define ICON_ATLAS_H_
+
+#include "Texture.h"
+
+#include <memory>
+#include <vector>
+#include <map>
+
+namespace eyegui
+{
+    class IconAtlas
+    {
+    public:
+
+        // Constructor
+        IconAtlas(RenderBackend* pBackend);
+
+        // Destructor
+        virtual ~IconAtlas();
+
+        // Place pixels of texture in a page, rows from bottom to top. Returns false
+        // when texture is too large or must wrap, so it should create its own
+        bool insert(Texture* pTexture, uchar const * pData, uint width, uint height, uint channelCount, Texture::Filtering filtering);
+
+        // Free space of texture
+        void remove(Texture const * pTexture);
+
+        // Generate mipmaps of pages changed since last call. Called before drawing
+        void generateMipmaps();
+
+        // Get count of pages
+        uint getPageCount() const { return (uint)mPages.size(); }
+
+    private:
+
+        // Free horizontal span in shelf
+        struct Span
+        {
+            uint x;
+            uint width;
+        };
+
+        // Row of icons with similar height
+        struct Shelf
+        {
+            uint y;
+            uint height;
+            std::vector<Span> freeSpans; // Sorted by position
+        };
+
+        // Icon placed in page, including padding
+        struct Icon
+        {
+            Texture* pTexture;
+            uint x;
+            uint y;
+            uint width;
+            uint height;
+            uint pixelWidth; // Without padding
+            uint pixelHeight;
+            uint shelf;
+        };
+
+        // Texture with shelves and icons
+        struct Page
+        {
+            uint texture;
+            uint size;
+            Texture::Filtering filtering;
+            std::vector<Shelf> shelves;
+            std::vector<std::unique_ptr<Icon> > icons;
+            uint usedArea;
+            bool mipmapsOutdated;
+        };
+
+        // Find space in shelves of page, opening new shelf if necessary. Returns false if there is none
+        bool allocate(Page& rPage, uint width, uint height, uint& rX, uint& rY, uint& rShelfIndex) const;
+
+        // Give space of icon back to its shelf
+        void deallocate(Page& rPage, const Icon& rIcon) const;
+
+        // Pack all icons of page and additional one with its RGBA pixels again at given size into new
+        // texture. Nothing changes if they do not fit
+        bool repack(Page& rPage, uint size, std::unique_ptr<Icon>& rupIcon, uchar const * pPixels);
+
+        // Allocate texture of page at its size
+        void createPageTexture(Page& rPage) const;
+
+        // Upload RGBA pixels of icon and place it
+        void upload(Page& rPage, const Icon& rIcon, uchar const * pPixels) const;
+
+        // Tell texture of icon where its pixels are
+        void place(Page& rPage, const Icon& rIcon) const;
+
+        // Members
+        RenderBackend* mpBackend;
+        uint mMaxPageSize;
+        std::vector<std::unique_ptr<Page> > mPages;
+        std::map<Texture const *, Page*> mPagesOfTextures;
+    };
+}
+
+#endif // ICON_ATLAS_H_
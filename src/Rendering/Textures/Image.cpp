@@ -0,0 +1,152 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "Image.h"
+
+#include "Helper.h"
+#include "PathBuilder.h"
+#include "externals/picoPNG/picopng.h"
+#include "externals/NanoSVG/nanosvgrast.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    namespace image_decoding
+    {
+        bool decodePixelImage(std::string filepath, Image& rImage)
+        {
+            // View file, decoded without copying it
+            FileView view = viewFile(filepath);
+
+            // Check whether file was found
+            if (!view.isValid())
+            {
+                return false;
+            }
+
+            // Decode image
+            ulong longWidth, longHeight;
+            if (decodePNG(rImage.data, longWidth, longHeight, view.getData(), view.getSize(), false) != 0
+                || longWidth == 0 || longHeight == 0)
+            {
+                return false;
+            }
+            rImage.width = (uint)(longWidth);
+            rImage.height = (uint)(longHeight);
+            rImage.flipped = false;
+
+            // Calculate number of channels
+            rImage.channelCount = (uint)(rImage.data.size() / (rImage.width * rImage.height * sizeof(uchar)));
+            return true;
+        }
+
+        bool decodeVectorImage(std::string filepath, Image& rImage, uint size)
+        {
+            // Parse file
+            NSVGimage* svg = parseVectorImage(filepath);
+
+            // Check whether file found and parsed
+            if (svg == NULL)
+            {
+                return false;
+            }
+
+            // Scale longer side to requested size
+            float scale = 1;
+            float longerSide = std::max(svg->width, svg->height);
+            if (size > 0 && longerSide > 0)
+            {
+                scale = (float)size / longerSide;
+            }
+
+            // Rasterize it
+            rasterizeVectorImage(svg, rImage, scale);
+
+            // Delete graphics
+            nsvgDelete(svg);
+            return true;
+        }
+
+        NSVGimage* parseVectorImage(std::string filepath)
+        {
+            // View file
+            FileView view = viewFile(filepath);
+            if (!view.isValid())
+            {
+                return NULL;
+            }
+
+            // Parser works in place and expects terminated string
+            std::vector<char> buffer(view.getChars(), view.getChars() + view.getSize());
+            buffer.push_back('\0');
+            return nsvgParse(buffer.data(), "px", SVG_DPI);
+        }
+
+        void decodeVectorGraphics(const std::string& rGraphics, Image& rImage)
+        {
+            // Parser works on modifiable copy
+            std::vector<char> copy(rGraphics.begin(), rGraphics.end());
+            copy.push_back('\0');
+            NSVGimage* svg = nsvgParse(copy.data(), "px", SVG_DPI);
+
+            // Rasterize it
+            rasterizeVectorImage(svg, rImage);
+
+            // Delete graphics
+            nsvgDelete(svg);
+        }
+
+        void rasterizeVectorImage(NSVGimage* svg, Image& rImage, float scale)
+        {
+            rImage.width = std::max((uint)(svg->width * scale), (uint)1);
+            rImage.height = std::max((uint)(svg->height * scale), (uint)1);
+            rImage.channelCount = 4;
+            rImage.flipped = true;
+
+            // Create rasterizer
+            NSVGrasterizer* rast = nsvgCreateRasterizer();
+
+            // Prepare memory for image
+            rImage.data.resize(rImage.width * rImage.height * rImage.channelCount);
+
+            // Rasterize, starting at last row with negative stride so rows are already flipped
+            int rowBytes = (int)(rImage.width * rImage.channelCount);
+            nsvgRasterize(rast, svg, 0, 0, scale, rImage.data.data() + (rImage.height - 1) * rowBytes, rImage.width, rImage.height, -rowBytes);
+
+            // Delete NanoSVG stuff
+            nsvgDeleteRasterizer(rast);
+        }
+
+        bool decode(std::string filepath, Image& rImage, uint size)
+        {
+            if (checkFileNameExtension(filepath, "png"))
+            {
+                return decodePixelImage(filepath, rImage);
+            }
+            else if (checkFileNameExtension(filepath, "svg"))
+            {
+                return decodeVectorImage(filepath, rImage, size);
+            }
+            return false;
+        }
+
+        void flipImage(Image& rImage)
+        {
+            // Swap rows from outside to inside
+            uint rowBytes = rImage.width * rImage.channelCount;
+            for (uint i = 0; i < rImage.height / 2; i++)
+            {
+                std::swap_ranges(
+                    rImage.data.begin() + i * rowBytes,
+                    rImage.data.begin() + (i + 1) * rowBytes,
+                    rImage.data.begin() + (rImage.height - 1 - i) * rowBytes);
+            }
+            rImage.flipped = !rImage.flipped;
+        }
+    }
+}
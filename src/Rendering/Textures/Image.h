@@ -0,0 +1,68 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Decoded image in memory, ready to be uploaded into a texture. Decoding does
+// neither touch the render backend nor notify about errors, so it may happen
+// on any thread. Caller decides how to report failure. Images loaded from the
+// image cache keep its entry mapped and are uploaded from the mapping.
+
+#ifndef IMAGE_H_
+#define IMAGE_H_
+
+#include "Defines.h"
+#include "FileView.h"
+
+#include "externals/NanoSVG/nanosvg.h"
+
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    struct Image
+    {
+        std::vector<uchar> data;
+        uint width = 0;
+        uint height = 0;
+        uint channelCount = 0;
+        bool flipped = false; // Rows from bottom to top as expected by textures, otherwise from top to bottom
+        FileView mapping; // Pixels inside mapped file, used instead of data when valid
+
+        // Getter for pixels
+        uchar const * getPixels() const { return mapping.isValid() ? mapping.getData() : data.data(); }
+
+        // Getter for bytes of pixels
+        size_t getByteCount() const { return mapping.isValid() ? mapping.getSize() : data.size(); }
+    };
+
+    namespace image_decoding
+    {
+        // Decode png file, returns false if file not found or not decodable
+        bool decodePixelImage(std::string filepath, Image& rImage);
+
+        // Parse svg file and rasterize it, returns false if file not found or not parsable.
+        // Longer side is rasterized with given size in pixels or, if zero, at size of svg
+        bool decodeVectorImage(std::string filepath, Image& rImage, uint size = 0);
+
+        // Parse svg file, returns NULL if file not found or not parsable. Caller deletes it
+        NSVGimage* parseVectorImage(std::string filepath);
+
+        // Parse internal vector graphics and rasterize it
+        void decodeVectorGraphics(const std::string& rGraphics, Image& rImage);
+
+        // Rasterize parsed vector graphics at its own size multiplied by scale. Rows are flipped
+        void rasterizeVectorImage(NSVGimage* svg, Image& rImage, float scale = 1);
+
+        // Decode image by extension of filepath, returns false for unknown formats.
+        // Size is used for vector graphics only
+        bool decode(std::string filepath, Image& rImage, uint size = 0);
+
+        // Reverse order of rows
+        void flipImage(Image& rImage);
+    }
+}
+
+#endif // IMAGE_H_
@@ -0,0 +1,192 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "ImageCache.h"
+
+#include "MappedFile.h"
+#include "PathBuilder.h"
+
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <functional>
+#include <memory>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace eyegui
+{
+    // Beginning of each entry, followed by pixels
+    struct ImageCacheHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceSize;
+        int64_t sourceTime;
+        uint32_t width;
+        uint32_t height;
+        uint32_t channelCount;
+        uint32_t flipped;
+    };
+    static_assert(sizeof(ImageCacheHeader) == 40, "ImageCacheHeader must not contain padding");
+
+    // Identification of entries
+    static const uint32_t IMAGE_CACHE_MAGIC = 0x43494745; // "EGIC"
+    static const uint32_t IMAGE_CACHE_VERSION = 1;
+
+    ImageCache::ImageCache(std::string directory)
+    {
+        // Initialize members
+        mDirectory = directory;
+
+        // Create directory, fails if already existing
+#ifdef _WIN32
+        _mkdir(mDirectory.c_str());
+#else
+        mkdir(mDirectory.c_str(), 0755);
+#endif
+
+        // Check for directory
+        struct stat status;
+        mUsable = stat(mDirectory.c_str(), &status) == 0 && (status.st_mode & S_IFDIR) != 0;
+    }
+
+    ImageCache::~ImageCache()
+    {
+        // Nothing to do
+    }
+
+    bool ImageCache::load(std::string filepath, uint size, bool flipped, Image& rImage) const
+    {
+        // Status of source file
+        std::string fullFilepath = buildPath(filepath);
+        unsigned long long sourceSize;
+        long long sourceTime;
+        if (!mUsable || !PathBuilder::getFileStatus(filepath, sourceSize, sourceTime))
+        {
+            return false;
+        }
+
+        // Map entry
+        std::string entryFilepath = buildEntryFilepath(fullFilepath, size, flipped);
+        bool valid = false;
+        {
+            std::shared_ptr<MappedFile const> spEntry = std::make_shared<MappedFile>(entryFilepath);
+            if (!spEntry->isMapped())
+            {
+                return false;
+            }
+
+            // Check header against source file and size of entry
+            ImageCacheHeader header;
+            if (spEntry->getSize() >= sizeof(ImageCacheHeader))
+            {
+                std::memcpy(&header, spEntry->getData(), sizeof(ImageCacheHeader));
+                size_t pixelBytes = (size_t)header.width * header.height * header.channelCount;
+                valid = header.magic == IMAGE_CACHE_MAGIC
+                    && header.version == IMAGE_CACHE_VERSION
+                    && header.sourceSize == sourceSize
+                    && header.sourceTime == sourceTime
+                    && header.flipped == (flipped ? 1u : 0u)
+                    && pixelBytes > 0
+                    && spEntry->getSize() == sizeof(ImageCacheHeader) + pixelBytes;
+            }
+
+            // Pixels stay in mapping, which is kept alive by image until uploaded
+            if (valid)
+            {
+                rImage.data.clear();
+                rImage.mapping = FileView(
+                    spEntry,
+                    spEntry->getData() + sizeof(ImageCacheHeader),
+                    spEntry->getSize() - sizeof(ImageCacheHeader));
+                rImage.width = header.width;
+                rImage.height = header.height;
+                rImage.channelCount = header.channelCount;
+                rImage.flipped = flipped;
+            }
+        }
+
+        // Outdated entry is deleted after mapping is gone
+        if (!valid)
+        {
+            std::remove(entryFilepath.c_str());
+        }
+        return valid;
+    }
+
+    void ImageCache::store(std::string filepath, uint size, const Image& rImage) const
+    {
+        // Status of source file
+        std::string fullFilepath = buildPath(filepath);
+        ImageCacheHeader header;
+        unsigned long long sourceSize;
+        long long sourceTime;
+        if (!mUsable || rImage.getByteCount() == 0 || !PathBuilder::getFileStatus(filepath, sourceSize, sourceTime))
+        {
+            return;
+        }
+        header.magic = IMAGE_CACHE_MAGIC;
+        header.version = IMAGE_CACHE_VERSION;
+        header.sourceSize = sourceSize;
+        header.sourceTime = sourceTime;
+        header.width = rImage.width;
+        header.height = rImage.height;
+        header.channelCount = rImage.channelCount;
+        header.flipped = rImage.flipped ? 1 : 0;
+
+        // Write into temporary file first, so other readers never see incomplete entries
+        std::string entryFilepath = buildEntryFilepath(fullFilepath, size, rImage.flipped);
+        std::ostringstream temporary;
+        temporary << entryFilepath << "." << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+        std::string temporaryFilepath = temporary.str();
+        {
+            std::ofstream out(temporaryFilepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(ImageCacheHeader));
+            out.write(reinterpret_cast<const char*>(rImage.getPixels()), rImage.getByteCount());
+            if (!out)
+            {
+                out.close();
+                std::remove(temporaryFilepath.c_str());
+                return;
+            }
+        }
+
+        // Replace entry. Renaming onto existing file fails on some systems
+        if (std::rename(temporaryFilepath.c_str(), entryFilepath.c_str()) != 0)
+        {
+            std::remove(entryFilepath.c_str());
+            if (std::rename(temporaryFilepath.c_str(), entryFilepath.c_str()) != 0)
+            {
+                std::remove(temporaryFilepath.c_str());
+            }
+        }
+    }
+
+    std::string ImageCache::buildEntryFilepath(std::string fullFilepath, uint size, bool flipped) const
+    {
+        // FNV-1a hash of filepath
+        uint64_t hash = 14695981039346656037ULL;
+        for (char c : fullFilepath)
+        {
+            hash ^= (uchar)c;
+            hash *= 1099511628211ULL;
+        }
+
+        std::ostringstream entry;
+        entry << mDirectory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash
+            << std::dec << "_" << size << (flipped ? "_f" : "") << ".egic";
+        return entry.str();
+    }
+}
@@ -0,0 +1,55 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Directory on disk with decoded images, so png files are not decoded and svg
+// files are not rasterized again at next start. One entry per source file,
+// rasterization size and row order, holding the pixels as they are uploaded
+// into the texture. Entries remember size and modification time of their
+// source file and are deleted when these do not match anymore. Loading and
+// storing may happen on any thread.
+
+#ifndef IMAGE_CACHE_H_
+#define IMAGE_CACHE_H_
+
+#include "Image.h"
+
+#include <string>
+
+namespace eyegui
+{
+    class ImageCache
+    {
+    public:
+
+        // Constructor, directory is created if not existing
+        ImageCache(std::string directory);
+
+        // Destructor
+        virtual ~ImageCache();
+
+        // Does directory exist
+        bool isUsable() const { return mUsable; }
+
+        // Load image of file, rasterized at size (zero for size of file) and in given row order.
+        // Pixels are not copied, image keeps entry mapped. Returns false if there is no entry
+        // or it is outdated
+        bool load(std::string filepath, uint size, bool flipped, Image& rImage) const;
+
+        // Store image of file, rasterized at size (zero for size of file)
+        void store(std::string filepath, uint size, const Image& rImage) const;
+
+    private:
+
+        // Build filepath of entry
+        std::string buildEntryFilepath(std::string fullFilepath, uint size, bool flipped) const;
+
+        // Members
+        std::string mDirectory;
+        bool mUsable;
+    };
+}
+
+#endif // IMAGE_CACHE_H_
@@ -9,22 +9,24 @@
 
 #include "Helper.h"
 #include "OperationNotifier.h"
-#include "externals/picoPNG/picopng.h"
-#include "PathBuilder.h"
-
-#include <fstream>
 
 namespace eyegui
 {
-    PixelTexture::PixelTexture(std::string filepath, Filtering filtering, Wrap wrap) : Texture()
+    PixelTexture::PixelTexture(RenderBackend* pBackend, std::string filepath, Filtering filtering, Wrap wrap, IconAtlas* pAtlas) : Texture(pBackend, pAtlas)
     {
         // Read image from disk
         std::vector<uchar> image;
         uint width, height, channelCount;
         loadPixelImage(filepath, image, width, height, channelCount);
 
-        // Create OpenGL texture
-        createOpenGLTexture(image, filtering, wrap, width, height, channelCount);
+        // Create texture
+        createTexture(image.data(), filtering, wrap, width, height, channelCount);
+    }
+
+    PixelTexture::PixelTexture(RenderBackend* pBackend, const Image& rImage, Filtering filtering, Wrap wrap, IconAtlas* pAtlas) : Texture(pBackend, pAtlas)
+    {
+        // Image has been decoded before
+        createTexture(rImage.getPixels(), filtering, wrap, rImage.width, rImage.height, rImage.channelCount, rImage.flipped);
     }
 
     PixelTexture::~PixelTexture()
@@ -46,34 +48,15 @@ namespace eyegui
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or wrong format", filepath);
         }
 
-        // Read file
-        std::ifstream in(buildPath(filepath).c_str(), std::ios::in | std::ios::binary);
-
-        // Check whether file was found
-        if (!in)
+        // Read and decode file
+        Image image;
+        if (!image_decoding::decodePixelImage(filepath, image))
         {
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found", filepath);
         }
-
-        // Get size
-        in.seekg(0, std::ios::end);
-        std::streamsize size = in.tellg();
-
-        // Read it
-        in.seekg(0, std::ios::beg);
-        std::vector<char> buffer((uint)(size));
-        in.read(&(buffer[0]), (uint)(size));
-
-        // Close file
-        in.close();
-
-        // Decode image
-        ulong longWidth, longHeight;
-        decodePNG(rImage, longWidth, longHeight, reinterpret_cast<uchar*>(&(buffer[0])), (uint)(size), false);
-        rWidth = (uint)(longWidth);
-        rHeight = (uint)(longHeight);
-
-        // Calculate number of channels
-        rChannelCount = (uint)(rImage.size() / (rWidth * rHeight * sizeof(uchar)));
+        rImage = std::move(image.data);
+        rWidth = image.width;
+        rHeight = image.height;
+        rChannelCount = image.channelCount;
     }
 }
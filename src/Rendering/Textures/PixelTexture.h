@@ -10,6 +10,7 @@
 #define PIXEL_TEXTURE_H_
 
 #include "Texture.h"
+#include "Image.h"
 
 namespace eyegui
 {
@@ -18,7 +19,10 @@ namespace eyegui
 	public:
 
 		// Constructor
-		PixelTexture(std::string filepath, Filtering filtering, Wrap wrap);
+		PixelTexture(RenderBackend* pBackend, std::string filepath, Filtering filtering, Wrap wrap, IconAtlas* pAtlas = NULL);
+
+		// Constructor for image decoded before, maybe on another thread
+		PixelTexture(RenderBackend* pBackend, const Image& rImage, Filtering filtering, Wrap wrap, IconAtlas* pAtlas = NULL);
 
 		// Destructor
 		virtual ~PixelTexture();
@@ -7,13 +7,19 @@
 
 #include "Texture.h"
 
-#include <fstream>
+#include "IconAtlas.h"
+
+#include <cstring>
 
 namespace eyegui
 {
-	Texture::Texture()
+	Texture::Texture(RenderBackend* pBackend, IconAtlas* pAtlas)
 	{
 		// Initialize members
+		mpBackend = pBackend;
+		mpAtlas = pAtlas;
+		mInAtlas = false;
+		mAtlasRect = glm::vec4(0, 0, 1, 1);
 		mTexture = 0;
 		mWidth = 0;
 		mHeight = 0;
@@ -22,18 +28,21 @@ namespace eyegui
 
 	Texture::~Texture()
 	{
-		// Delete texture
-		glDeleteTextures(1, &mTexture);
-
+		// Delete texture or free space in atlas
+		if (mInAtlas)
+		{
+			mpAtlas->remove(this);
+		}
+		else
+		{
+			mpBackend->deleteTexture(mTexture);
+		}
 	}
 
 	void Texture::bind(uint slot) const
 	{
-		// Choose slot
-		glActiveTexture(GL_TEXTURE0 + slot);
-
-		// Bind texture
-		glBindTexture(GL_TEXTURE_2D, mTexture);
+		// Bind texture to slot
+		mpBackend->bindTexture(mTexture, slot);
 	}
 
 	uint Texture::getWidth() const
@@ -56,88 +65,146 @@ namespace eyegui
 		return mChannelCount;
 	}
 
-	void Texture::createOpenGLTexture(const std::vector<uchar>& rData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount)
+	uint Texture::getTextureHandle() const
+	{
+		return mTexture;
+	}
+
+	glm::vec4 Texture::getAtlasRect() const
+	{
+		return mAtlasRect;
+	}
+
+	bool Texture::isInAtlas() const
+	{
+		return mInAtlas;
+	}
+
+	uint Texture::getByteCount() const
+	{
+		return mWidth * mHeight * mChannelCount;
+	}
+
+	void Texture::createTexture(uchar const * pData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount, bool flipped)
 	{
 		// Save members
 		mWidth = width;
 		mHeight = height;
 		mChannelCount = channelCount;
 
-		// Flip data
-		std::vector<uchar> flippedData = flipImage(rData);
+		// Flip data if necessary
+		if (!flipped)
+		{
+			pData = flipRows(pData);
+		}
 
-		// Create OpenGL texture
-		glActiveTexture(GL_TEXTURE0);
-		glGenTextures(1, &mTexture);
-		glBindTexture(GL_TEXTURE_2D, mTexture);
+		// Content of texture is replaced, so give space in atlas back
+		if (mInAtlas)
+		{
+			mpAtlas->remove(this);
+			mInAtlas = false;
+			mAtlasRect = glm::vec4(0, 0, 1, 1);
+			mTexture = 0;
+		}
 
-		// Wrapping
-		switch (wrap)
+		// Place clamped textures in atlas, which sets handle and rectangle
+		if (mpAtlas != NULL
+			&& wrap == Wrap::CLAMP
+			&& mpAtlas->insert(this, pData, mWidth, mHeight, mChannelCount, filtering))
 		{
-		case Wrap::CLAMP:
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-			break;
-		case Wrap::MIRROR:
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
-			break;
-		case Wrap::REPEAT:
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-			break;
+			return;
 		}
 
-		// Load it to GPU
+		// Pixel format
+		RenderBackend::PixelFormat format;
 		switch (mChannelCount)
 		{
 		case 1:
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, mWidth, mHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, &flippedData[0]);
+			format = RenderBackend::PixelFormat::RED;
 			break;
 		case 3:
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, mWidth, mHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, &flippedData[0]);
+			format = RenderBackend::PixelFormat::RGB;
 			break;
 		default:
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, mWidth, mHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, &flippedData[0]);
+			format = RenderBackend::PixelFormat::RGBA;
 			break;
 		}
 
 		// Filtering
+		RenderBackend::TextureFilter minFilter = RenderBackend::TextureFilter::NEAREST;
+		RenderBackend::TextureFilter magFilter = RenderBackend::TextureFilter::NEAREST;
 		switch (filtering)
 		{
 		case Filtering::LINEAR:
-			glGenerateMipmap(GL_TEXTURE_2D);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			minFilter = RenderBackend::TextureFilter::LINEAR_MIPMAP;
+			magFilter = RenderBackend::TextureFilter::LINEAR;
 			break;
 		case Filtering::NEAREST:
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			minFilter = RenderBackend::TextureFilter::NEAREST;
+			magFilter = RenderBackend::TextureFilter::NEAREST;
 			break;
 		}
 
-		// Unbind texture
-		glBindTexture(GL_TEXTURE_2D, 0);
+		// Wrapping
+		RenderBackend::TextureWrap textureWrap = RenderBackend::TextureWrap::CLAMP;
+		switch (wrap)
+		{
+		case Wrap::CLAMP:
+			textureWrap = RenderBackend::TextureWrap::CLAMP;
+			break;
+		case Wrap::MIRROR:
+			textureWrap = RenderBackend::TextureWrap::MIRROR;
+			break;
+		case Wrap::REPEAT:
+			textureWrap = RenderBackend::TextureWrap::REPEAT;
+			break;
+		}
+
+		// Create texture at first call, later calls replace its content
+		if (mTexture == 0)
+		{
+			mTexture = mpBackend->createTexture();
+		}
+
+		// Load it to GPU
+		mpBackend->fillTexture(
+			mTexture,
+			mWidth,
+			mHeight,
+			format,
+			pData,
+			minFilter,
+			magFilter,
+			textureWrap);
 	}
 
-	std::vector<uchar> Texture::flipImage(const std::vector<uchar>& rImage) const
+	void Texture::placeInAtlas(uint page, glm::vec4 rect)
 	{
-		std::vector<uchar> copyImage(rImage);
+		// Own texture is no longer needed
+		if (!mInAtlas && mTexture != 0)
+		{
+			mpBackend->deleteTexture(mTexture);
+		}
+		mInAtlas = true;
+		mAtlasRect = rect;
+		mTexture = page;
+	}
 
-		// Go over lines
-		for (uint i = 0; i < mHeight; i++)
+	uchar const * Texture::flipRows(uchar const * pData) const
+	{
+		// Staging buffer only grows, so repeated uploads do not allocate
+		static thread_local std::vector<uchar> stagingBuffer;
+		size_t rowBytes = (size_t)mWidth * mChannelCount;
+		if (stagingBuffer.size() < rowBytes * mHeight)
 		{
-			// Go over columns
-			for (uint j = 0; j < mWidth; j++)
-			{
-				// Go over channels
-				for (uint k = 0; k < mChannelCount; k++)
-				{
-					copyImage[i * mWidth * mChannelCount + j * mChannelCount + k] = rImage[(mHeight - 1 - i) * mWidth * mChannelCount + j * mChannelCount + k];
-				}
-			}
+			stagingBuffer.resize(rowBytes * mHeight);
 		}
 
-		return copyImage;
+		// Copy whole rows
+		for (uint i = 0; i < mHeight; i++)
+		{
+			std::memcpy(stagingBuffer.data() + i * rowBytes, pData + (mHeight - 1 - i) * rowBytes, rowBytes);
+		}
+		return stagingBuffer.data();
 	}
 }
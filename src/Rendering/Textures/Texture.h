@@ -4,7 +4,7 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Abstract encapsulation of the OpenGL texture creation and usage.
+// Abstract encapsulation of the texture creation and usage.
 
 #ifndef TEXTURE_H_
 #define TEXTURE_H_
@@ -12,13 +12,16 @@
 #include "eyeGUI.h"
 
 #include "Defines.h"
-#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "Rendering/Backend/RenderBackend.h"
 
 #include <string>
 #include <vector>
 
 namespace eyegui
 {
+	// Forward declaration
+	class IconAtlas;
+
 	class Texture
 	{
 	public:
@@ -33,8 +36,8 @@ namespace eyegui
 			CLAMP, MIRROR, REPEAT
 		};
 
-		// Constructor for pixel based image
-		Texture();
+		// Constructor for pixel based image. Texture is placed in pages of atlas if given and possible
+		Texture(RenderBackend* pBackend, IconAtlas* pAtlas = NULL);
 
 		// Destructor
 		virtual ~Texture() = 0;
@@ -52,18 +55,44 @@ namespace eyegui
 		// Getter for channel count of texture
 		uint getChannelCount() const;
 
+		// Getter for handle, which is the page of the atlas if texture is placed there
+		uint getTextureHandle() const;
+
+		// Getter for rectangle of pixels in bound texture as offset and scale of coordinates
+		glm::vec4 getAtlasRect() const;
+
+		// Is texture placed in atlas, so its coordinates must be clamped to rectangle
+		bool isInAtlas() const;
+
+		// Is actual image loaded, otherwise placeholder is shown
+		virtual bool isLoaded() const { return true; }
+
+		// Getter for bytes of pixel data (without mipmaps)
+		uint getByteCount() const;
+
 	protected:
 
-		// Create OpenGL texture (something like initialization)
-		void createOpenGLTexture(const std::vector<uchar>& rData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount);
+		// Create texture of backend (something like initialization). Called again, content is replaced.
+		// Data with rows from top to bottom is flipped, unless already flipped
+		void createTexture(uchar const * pData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount, bool flipped = false);
 
 	private:
 
-		// Flip image
-		std::vector<uchar> flipImage(const std::vector<uchar>& rImage) const;
+		// Icon atlas tells where pixels of texture are
+		friend class IconAtlas;
+
+		// Bind page of atlas, pixels are inside of rectangle
+		void placeInAtlas(uint page, glm::vec4 rect);
+
+		// Copy rows in reversed order into staging buffer, which is reused by following calls on same thread
+		uchar const * flipRows(uchar const * pData) const;
 
 		// Members
-		GLuint mTexture;
+		RenderBackend* mpBackend;
+		IconAtlas* mpAtlas;
+		bool mInAtlas;
+		glm::vec4 mAtlasRect;
+		uint mTexture; // Own texture or page of atlas
 		uint mWidth;
 		uint mHeight;
 		uint mChannelCount;
@@ -7,6 +7,8 @@
 
 #include "VectorTexture.h"
 
+#include "Image.h"
+
 #include "Helper.h"
 #include "OperationNotifier.h"
 #include "PathBuilder.h"
@@ -20,7 +22,7 @@
 
 namespace eyegui
 {
-    VectorTexture::VectorTexture(std::string filepath, Filtering filtering, Wrap wrap) : Texture()
+    VectorTexture::VectorTexture(RenderBackend* pBackend, std::string filepath, Filtering filtering, Wrap wrap, IconAtlas* pAtlas) : Texture(pBackend, pAtlas)
     {
         // Check file format
         if (!checkFileNameExtension(filepath, "svg"))
@@ -29,7 +31,7 @@ namespace eyegui
         }
 
         // Parse file
-        NSVGimage* svg = nsvgParseFromFile(buildPath(filepath).c_str(), "px", SVG_DPI);
+        NSVGimage* svg = image_decoding::parseVectorImage(filepath);
 
         // Check whether file found and parsed
         if (svg == NULL)
@@ -37,14 +39,14 @@ namespace eyegui
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Graphics file not found or error while parsing", filepath);
         }
 
-        // Rasterize it and create OpenGL texture
+        // Rasterize it and create texture
         rasterizeGraphics(svg, filtering, wrap);
 
         // Delete graphics
         nsvgDelete(svg);
     }
 
-    VectorTexture::VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap)
+    VectorTexture::VectorTexture(RenderBackend* pBackend, std::string const * pGraphic, Filtering filtering, Wrap wrap, IconAtlas* pAtlas) : Texture(pBackend, pAtlas)
     {
         // Parse graphics
         char* str = static_cast<char*>(malloc(sizeof(char) * pGraphic->size() + 1));
@@ -52,7 +54,7 @@ namespace eyegui
         NSVGimage* svg = nsvgParse(str, "px", SVG_DPI);
         free(str);
 
-        // Rasterize it and create OpenGL texture
+        // Rasterize it and create texture
         rasterizeGraphics(svg, filtering, wrap);
 
         // Delete graphics
@@ -66,26 +68,11 @@ namespace eyegui
 
     void VectorTexture::rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap)
     {
-        // TODO: Size depending on image scale. Better depend on rendering resolution
-
-        uint width = (uint)(svg->width);
-        uint height = (uint)(svg->height);
-        const uint channelCount = 4;
-
-        // Create rasterizer
-        NSVGrasterizer* rast = nsvgCreateRasterizer();
-
-        // Prepare memory for image
-        std::vector<uchar> image;
-        image.resize(width * height * channelCount);
-
         // Rasterize
-        nsvgRasterize(rast, svg, 0, 0, 1, image.data(), width, height, width * channelCount);
-
-        // Create OpenGL from image
-        createOpenGLTexture(image, filtering, wrap, width, height, channelCount);
+        Image image;
+        image_decoding::rasterizeVectorImage(svg, image);
 
-        // Delete NanoSVG stuff
-        nsvgDeleteRasterizer(rast);
+        // Create texture from image
+        createTexture(image.data.data(), filtering, wrap, image.width, image.height, image.channelCount, image.flipped);
     }
 }
@@ -20,10 +20,10 @@ namespace eyegui
 	public:
 
 		// Constructor for graphics on disk
-		VectorTexture(std::string filepath, Filtering filtering, Wrap wrap);
+		VectorTexture(RenderBackend* pBackend, std::string filepath, Filtering filtering, Wrap wrap, IconAtlas* pAtlas = NULL);
 
 		// Constructor for internal graphics
-		VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap);
+		VectorTexture(RenderBackend* pBackend, std::string const * pGraphic, Filtering filtering, Wrap wrap, IconAtlas* pAtlas = NULL);
 
 		// Destructor
 		virtual ~VectorTexture();
@@ -0,0 +1,80 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    ThreadPool::ThreadPool(uint threadCount)
+    {
+        // Leave one core to thread of GUI
+        if (threadCount == 0)
+        {
+            threadCount = std::max((uint)std::thread::hardware_concurrency(), (uint)2) - 1;
+        }
+
+        // Initialize members
+        mThreadCount = threadCount;
+        mStop = false;
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+            mTasks.clear();
+        }
+        mCondition.notify_all();
+        for (std::thread& rThread : mThreads)
+        {
+            rThread.join();
+        }
+    }
+
+    void ThreadPool::enqueue(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(std::move(task));
+        }
+        mCondition.notify_one();
+
+        // Start threads with first task
+        if (mThreads.empty())
+        {
+            for (uint i = 0; i < mThreadCount; i++)
+            {
+                mThreads.push_back(std::thread(&ThreadPool::run, this));
+            }
+        }
+    }
+
+    void ThreadPool::run()
+    {
+        while (true)
+        {
+            // Wait for task
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [&] { return mStop || !mTasks.empty(); });
+                if (mStop)
+                {
+                    return;
+                }
+                task = std::move(mTasks.front());
+                mTasks.pop_front();
+            }
+
+            // Execute it
+            task();
+        }
+    }
+}
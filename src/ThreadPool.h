@@ -0,0 +1,57 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Pool of worker threads executing tasks in order of enqueueing. Threads are
+// started with the first task. Tasks must not touch the render backend and
+// must not notify about errors, as callbacks expect the thread of the GUI.
+// At destruction, tasks not yet started are dropped.
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include "Defines.h"
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+
+namespace eyegui
+{
+    class ThreadPool
+    {
+    public:
+
+        // Constructor, zero threads means count of cores minus one
+        ThreadPool(uint threadCount = 0);
+
+        // Destructor, waits for running tasks
+        virtual ~ThreadPool();
+
+        // Enqueue task, executed by next free thread
+        void enqueue(std::function<void()> task);
+
+        // Getter for count of threads
+        uint getThreadCount() const { return mThreadCount; }
+
+    private:
+
+        // Execution of each thread
+        void run();
+
+        // Members
+        uint mThreadCount;
+        std::vector<std::thread> mThreads;
+        std::mutex mMutex; // Guards tasks and stopping
+        std::condition_variable mCondition;
+        std::deque<std::function<void()> > mTasks;
+        bool mStop;
+    };
+}
+
+#endif // THREAD_POOL_H_
@@ -11,20 +11,26 @@
 #include "Layout.h"
 #include "OperationNotifier.h"
 #include "PathBuilder.h"
+#include "AssetArchive.h"
 
 // Version
 static const std::string VERSION_STRING = "0.5";
 
 namespace eyegui
 {
+    // Mutating calls are executed immediately on thread updating the GUI, otherwise queued
+    typedef CommandQueue::Command Command;
+
     GUI* createGUI(
         int width,
         int height,
         std::string fontFilepath,
         CharacterSet characterSet,
-        std::string localizationFilepath)
+        std::string localizationFilepath,
+        RenderBackendType renderBackend,
+        std::string fontAtlasCacheDirectory)
     {
-        return (new GUI(width, height, fontFilepath, characterSet, localizationFilepath));
+        return (new GUI(width, height, fontFilepath, characterSet, localizationFilepath, renderBackend, fontAtlasCacheDirectory));
     }
 
     Layout* addLayout(GUI* pGUI, std::string filepath, bool visible)
@@ -32,9 +38,23 @@ namespace eyegui
         return pGUI->addLayout(filepath, visible);
     }
 
+    std::shared_future<Layout*> addLayoutAsync(GUI* pGUI, std::string filepath, bool visible)
+    {
+        return pGUI->addLayoutAsync(filepath, visible);
+    }
+
     void removeLayout(GUI* pGUI, Layout const * pLayout)
     {
-        pGUI->removeLayout(pLayout);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.pConstLayout = pLayout;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->removeLayout(rCommand.pConstLayout);
+            });
     }
 
     Input updateGUI(GUI* pGUI, float tpf, Input input)
@@ -47,6 +67,154 @@ namespace eyegui
         pGUI->draw();
     }
 
+    bool isRedrawNeeded(GUI const * pGUI)
+    {
+        return pGUI->isRedrawNeeded();
+    }
+
+    std::vector<DrawCommand> getRecordedDrawCommands(GUI const * pGUI)
+    {
+        return pGUI->getRecordedDrawCommands();
+    }
+
+    void setFrameStatisticsCollection(GUI* pGUI, bool collect)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.flags[0] = collect;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setFrameStatisticsCollection(rCommand.flags[0]);
+            });
+    }
+
+    FrameStatistics getFrameStatistics(GUI const * pGUI)
+    {
+        return pGUI->getFrameStatistics();
+    }
+
+    std::vector<FrameStatistics> getFrameStatisticsHistory(GUI const * pGUI)
+    {
+        return pGUI->getFrameStatisticsHistory();
+    }
+
+    FrameStatistics getFrameStatisticsPercentile(GUI const * pGUI, float percentile)
+    {
+        return pGUI->getFrameStatisticsPercentile(percentile);
+    }
+
+    void setBatchRendering(GUI* pGUI, bool batch)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.flags[0] = batch;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setBatchRendering(rCommand.flags[0]);
+            });
+    }
+
+    void setRenderStateCaching(GUI* pGUI, bool cache)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.flags[0] = cache;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setRenderStateCaching(rCommand.flags[0]);
+            });
+    }
+
+    void setStateRestoration(GUI* pGUI, StateRestoration restoration)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.restoration = restoration;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setStateRestoration(rCommand.restoration);
+            });
+    }
+
+    void setOffscreenCaching(GUI* pGUI, bool layouts, bool floatingFrames)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.flags[0] = layouts;
+                rCommand.flags[1] = floatingFrames;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setOffscreenCaching(rCommand.flags[0], rCommand.flags[1]);
+            });
+    }
+
+    void setTextureMemoryBudget(GUI* pGUI, unsigned int budget)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.integers[0] = (int)budget;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setTextureMemoryBudget((uint)rCommand.integers[0]);
+            });
+    }
+
+    unsigned int getResidentTextureBytes(GUI const * pGUI)
+    {
+        return pGUI->getResidentTextureBytes();
+    }
+
+    void setImageCacheDirectory(GUI* pGUI, std::string directory)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.texts[0] = directory;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setImageCacheDirectory(rCommand.texts[0]);
+            });
+    }
+
+    FontAtlasStatistics getFontAtlasStatistics(GUI const * pGUI)
+    {
+        return pGUI->getFontAtlasStatistics();
+    }
+
+    void setDistanceFieldFonts(GUI* pGUI, bool distanceField)
+    {
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.flags[0] = distanceField;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setDistanceFieldFonts(rCommand.flags[0]);
+            });
+    }
+
     void terminateGUI(GUI* pGUI)
     {
         if (pGUI != NULL)
@@ -62,27 +230,72 @@ namespace eyegui
 
     void resizeGUI(GUI* pGUI, int width, int height)
     {
-        pGUI->resize(width, height);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.integers[0] = width;
+                rCommand.integers[1] = height;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->resize(rCommand.integers[0], rCommand.integers[1]);
+            });
     }
 
     void loadConfig(GUI* pGUI, std::string filepath)
     {
-        pGUI->loadConfig(filepath);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.texts[0] = filepath;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->loadConfig(rCommand.texts[0]);
+            });
     }
 
     void setGazeVisualizationDrawing(GUI* pGUI, bool draw)
     {
-        pGUI->setGazeVisualizationDrawing(draw);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.flags[0] = draw;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setGazeVisualizationDrawing(rCommand.flags[0]);
+            });
     }
 
     void toggleGazeVisualizationDrawing(GUI* pGUI)
     {
-        pGUI->toggleGazeVisualizationDrawing();
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->toggleGazeVisualizationDrawing();
+            });
     }
 
     void prefetchImage(GUI* pGUI, std::string filepath)
     {
-        pGUI->prefetchImage(filepath);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.texts[0] = filepath;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->prefetchImage(rCommand.texts[0]);
+            });
     }
 
     void setValueOfConfigAttribute(
@@ -90,32 +303,80 @@ namespace eyegui
         std::string attribute,
         std::string value)
     {
-        pGUI->setValueOfConfigAttribute(attribute, value);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.texts[0] = attribute;
+                rCommand.texts[1] = value;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->setValueOfConfigAttribute(rCommand.texts[0], rCommand.texts[1]);
+            });
     }
 
     void setInputUsageOfLayout(Layout* pLayout, bool useInput)
     {
-        pLayout->useInput(useInput);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.flags[0] = useInput;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->useInput(rCommand.flags[0]);
+            });
     }
 
     void setVisibilityOfLayout(Layout* pLayout, bool visible, bool reset, bool fade)
     {
-        pLayout->setVisibility(visible, fade);
-
-        if (reset)
-        {
-            pLayout->resetElements();
-        }
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.flags[0] = visible;
+                rCommand.flags[1] = reset;
+                rCommand.flags[2] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setVisibility(rCommand.flags[0], rCommand.flags[2]);
+
+                if (rCommand.flags[1])
+                {
+                    rCommand.pLayout->resetElements();
+                }
+            });
     }
 
     void moveLayoutToFront(GUI* pGUI, Layout* pLayout)
     {
-        pGUI->moveLayoutToFront(pLayout);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.pLayout = pLayout;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->moveLayoutToFront(rCommand.pLayout);
+            });
     }
 
     void moveLayoutToBack(GUI* pGUI, Layout* pLayout)
     {
-        pGUI->moveLayoutToBack(pLayout);
+        pGUI->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pGUI = pGUI;
+                rCommand.pLayout = pLayout;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pGUI->moveLayoutToBack(rCommand.pLayout);
+            });
     }
 
     RelativePositionAndSize getRelativePositionAndSizeOfElement(
@@ -134,12 +395,33 @@ namespace eyegui
 
     void setElementActivity(Layout* pLayout, std::string id, bool active, bool fade)
     {
-        pLayout->setElementActivity(id, active, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = active;
+                rCommand.flags[1] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setElementActivity(rCommand.texts[0], rCommand.flags[0], rCommand.flags[1]);
+            });
     }
 
     void toggleElementActivity(Layout* pLayout, std::string id, bool fade)
     {
-        pLayout->setElementActivity(id, !pLayout->isElementActive(id), fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setElementActivity(rCommand.texts[0], !rCommand.pLayout->isElementActive(rCommand.texts[0]), rCommand.flags[0]);
+            });
     }
 
     bool isElementActive(Layout const * pLayout, std::string id)
@@ -152,7 +434,17 @@ namespace eyegui
         std::string id,
         bool dimmable)
     {
-        pLayout->setElementDimmable(id, dimmable);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = dimmable;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setElementDimmable(rCommand.texts[0], rCommand.flags[0]);
+            });
     }
 
     void setStyleOfElement(
@@ -160,7 +452,17 @@ namespace eyegui
         std::string id,
         std::string style)
     {
-        pLayout->setStyleOfElement(id, style);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = style;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setStyleOfElement(rCommand.texts[0], rCommand.texts[1]);
+            });
     }
 
     bool isElementDimmable(Layout const * pLayout, std::string id)
@@ -170,7 +472,17 @@ namespace eyegui
 
     void setElementHiding(Layout* pLayout, std::string id, bool hidden)
     {
-        pLayout->setElementHiding(id, hidden);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = hidden;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setElementHiding(rCommand.texts[0], rCommand.flags[0]);
+            });
     }
 
     bool checkForId(Layout const * pLayout, std::string id)
@@ -180,12 +492,31 @@ namespace eyegui
 
     void highlightInteractiveElement(Layout* pLayout, std::string id, bool doHighlight)
     {
-        pLayout->highlightInteractiveElement(id, doHighlight);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = doHighlight;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->highlightInteractiveElement(rCommand.texts[0], rCommand.flags[0]);
+            });
     }
 
     void toggleHighlightInteractiveElement(Layout* pLayout, std::string id)
     {
-        pLayout->highlightInteractiveElement(id, pLayout->isInteractiveElementHighlighted(id));
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->highlightInteractiveElement(rCommand.texts[0], rCommand.pLayout->isInteractiveElementHighlighted(rCommand.texts[0]));
+            });
     }
 
     bool isInteractiveElementHighlighted(Layout const * pLayout, std::string id)
@@ -202,47 +533,140 @@ namespace eyegui
         float b,
         float a)
     {
-        pLayout->setValueOfStyleAttribute(styleName, attribute, glm::vec4(r, g, b, a));
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = styleName;
+                rCommand.texts[1] = attribute;
+                rCommand.values[0] = r;
+                rCommand.values[1] = g;
+                rCommand.values[2] = b;
+                rCommand.values[3] = a;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setValueOfStyleAttribute(
+                    rCommand.texts[0],
+                    rCommand.texts[1],
+                    glm::vec4(rCommand.values[0], rCommand.values[1], rCommand.values[2], rCommand.values[3]));
+            });
     }
 
     void setIconOfInteractiveElement(Layout* pLayout, std::string id, std::string iconFilepath)
     {
-        pLayout->setIconOfInteractiveElement(id, iconFilepath);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = iconFilepath;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setIconOfInteractiveElement(rCommand.texts[0], rCommand.texts[1]);
+            });
     }
 
     void selectInteractiveElement(Layout* pLayout, std::string id)
     {
-        pLayout->selectInteractiveElement(id);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->selectInteractiveElement(rCommand.texts[0]);
+            });
     }
 
     void deselectInteractiveElement(Layout* pLayout)
     {
-        pLayout->deselectInteractiveElement();
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->deselectInteractiveElement();
+            });
     }
 
     void interactWithSelectedInteractiveElement(Layout* pLayout)
     {
-        pLayout->interactWithSelectedInteractiveElement();
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->interactWithSelectedInteractiveElement();
+            });
     }
 
     bool selectNextInteractiveElement(Layout* pLayout)
     {
+        // Result depends on state of layout, so it cannot be queued
+        CommandQueue* pCommandQueue = pLayout->getCommandQueue();
+        if (!pCommandQueue->isConsumerThread())
+        {
+            throwWarning(
+                OperationNotifier::Operation::RUNTIME,
+                "Next interactive element can only be selected by thread updating the GUI");
+            return false;
+        }
+
+        // Calls queued before by other threads go first
+        pCommandQueue->execute();
         return pLayout->selectNextInteractiveElement();
     }
 
     void hitButton(Layout* pLayout, std::string id)
     {
-        pLayout->hitButton(id);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->hitButton(rCommand.texts[0]);
+            });
     }
 
     void buttonDown(Layout* pLayout, std::string id, bool immediately)
     {
-        pLayout->buttonDown(id, immediately);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = immediately;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->buttonDown(rCommand.texts[0], rCommand.flags[0]);
+            });
     }
 
     void buttonUp(Layout* pLayout, std::string id, bool immediately)
     {
-        pLayout->buttonUp(id, immediately);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = immediately;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->buttonUp(rCommand.texts[0], rCommand.flags[0]);
+            });
     }
 
     bool isButtonSwitch(Layout const * pLayout, std::string id)
@@ -252,62 +676,190 @@ namespace eyegui
 
     void penetrateSensor(Layout* pLayout, std::string id, float amount)
     {
-        pLayout->penetrateSensor(id, amount);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.values[0] = amount;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->penetrateSensor(rCommand.texts[0], rCommand.values[0]);
+            });
     }
 
     void setContentOfTextBlock(Layout* pLayout, std::string id, std::u16string content)
     {
-        pLayout->setContentOfTextBlock(id, content);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.content = content;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setContentOfTextBlock(rCommand.texts[0], rCommand.content);
+            });
     }
 
     void setContentOfTextBlock(Layout* pLayout, std::string id, std::string content)
     {
-        pLayout->setContentOfTextBlock(id, content);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = content;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setContentOfTextBlock(rCommand.texts[0], rCommand.texts[1]);
+            });
     }
 
     void setKeyOfTextBlock(Layout* pLayout, std::string id, std::string key)
     {
-        pLayout->setKeyOfTextBlock(id, key);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = key;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setKeyOfTextBlock(rCommand.texts[0], rCommand.texts[1]);
+            });
     }
 
     void registerButtonListener(Layout* pLayout, std::string id, std::weak_ptr<ButtonListener> wpListener)
     {
-        pLayout->registerButtonListener(id, wpListener);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.wpButtonListener = wpListener;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->registerButtonListener(rCommand.texts[0], rCommand.wpButtonListener);
+            });
     }
 
     void registerSensorListener(Layout* pLayout, std::string id, std::weak_ptr<SensorListener> wpListener)
     {
-        pLayout->registerSensorListener(id, wpListener);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.wpSensorListener = wpListener;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->registerSensorListener(rCommand.texts[0], rCommand.wpSensorListener);
+            });
     }
 
     void replaceElementWithBlock(Layout* pLayout, std::string id, bool consumeInput, bool fade)
     {
-        pLayout->replaceElementWithBlock(id, consumeInput, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = consumeInput;
+                rCommand.flags[1] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithBlock(rCommand.texts[0], rCommand.flags[0], rCommand.flags[1]);
+            });
     }
 
     void replaceElementWithPicture(Layout* pLayout, std::string id, std::string filepath, PictureAlignment alignment, bool fade)
     {
-        pLayout->replaceElementWithPicture(id, filepath, alignment, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = filepath;
+                rCommand.integers[0] = (int)alignment;
+                rCommand.flags[0] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithPicture(rCommand.texts[0], rCommand.texts[1], (PictureAlignment)rCommand.integers[0], rCommand.flags[0]);
+            });
     }
 
     void replaceElementWithBlank(Layout* pLayout, std::string id, bool fade)
     {
-        pLayout->replaceElementWithBlank(id, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithBlank(rCommand.texts[0], rCommand.flags[0]);
+            });
     }
 
     void replaceElementWithCircleButton(Layout* pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade)
     {
-        pLayout->replaceElementWithCircleButton(id, iconFilepath, isSwitch, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = iconFilepath;
+                rCommand.flags[0] = isSwitch;
+                rCommand.flags[1] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithCircleButton(rCommand.texts[0], rCommand.texts[1], rCommand.flags[0], rCommand.flags[1]);
+            });
     }
 
     void replaceElementWithBoxButton(Layout* pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade)
     {
-        pLayout->replaceElementWithBoxButton(id, iconFilepath, isSwitch, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = iconFilepath;
+                rCommand.flags[0] = isSwitch;
+                rCommand.flags[1] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithBoxButton(rCommand.texts[0], rCommand.texts[1], rCommand.flags[0], rCommand.flags[1]);
+            });
     }
 
     void replaceElementWithSensor(Layout* pLayout, std::string id, std::string iconFilepath, bool fade)
     {
-        pLayout->replaceElementWithSensor(id, iconFilepath, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = iconFilepath;
+                rCommand.flags[0] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithSensor(rCommand.texts[0], rCommand.texts[1], rCommand.flags[0]);
+            });
     }
 
     void replaceElementWithTextBlock(
@@ -322,7 +874,33 @@ namespace eyegui
         std::string key,
         bool fade)
     {
-        pLayout->replaceElementWithTextBlock(id, consumeInput, fontSize, alignment, verticalAlignment, content, innerBorder, key, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.flags[0] = consumeInput;
+                rCommand.integers[0] = (int)fontSize;
+                rCommand.integers[1] = (int)alignment;
+                rCommand.integers[2] = (int)verticalAlignment;
+                rCommand.content = content;
+                rCommand.values[0] = innerBorder;
+                rCommand.texts[1] = key;
+                rCommand.flags[1] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithTextBlock(
+                    rCommand.texts[0],
+                    rCommand.flags[0],
+                    (FontSize)rCommand.integers[0],
+                    (TextFlowAlignment)rCommand.integers[1],
+                    (TextFlowVerticalAlignment)rCommand.integers[2],
+                    rCommand.content,
+                    rCommand.values[0],
+                    rCommand.texts[1],
+                    rCommand.flags[1]);
+            });
     }
 
     void replaceElementWithBrick(Layout* pLayout, std::string id, std::string filepath, bool fade)
@@ -333,7 +911,19 @@ namespace eyegui
 
     void replaceElementWithBrick(Layout* pLayout, std::string id, std::string filepath, std::map<std::string, std::string> idMapper, bool fade)
     {
-        pLayout->replaceElementWithBrick(id, filepath, idMapper, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.texts[0] = id;
+                rCommand.texts[1] = filepath;
+                rCommand.idMapper = idMapper;
+                rCommand.flags[0] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->replaceElementWithBrick(rCommand.texts[0], rCommand.texts[1], rCommand.idMapper, rCommand.flags[0]);
+            });
     }
 
     unsigned int addFloatingFrameWithBrick(
@@ -375,47 +965,131 @@ namespace eyegui
 
     void setVisibilityOFloatingfFrame(Layout* pLayout, unsigned int frameIndex, bool visible, bool reset, bool fade)
     {
-        pLayout->setVisibiltyOfFloatingFrame(frameIndex, visible, fade);
-
-        if (reset)
-        {
-            pLayout->resetFloatingFramesElements(frameIndex);
-        }
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+                rCommand.flags[0] = visible;
+                rCommand.flags[1] = reset;
+                rCommand.flags[2] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setVisibiltyOfFloatingFrame((uint)rCommand.integers[0], rCommand.flags[0], rCommand.flags[2]);
+
+                if (rCommand.flags[1])
+                {
+                    rCommand.pLayout->resetFloatingFramesElements((uint)rCommand.integers[0]);
+                }
+            });
     }
 
     void removeFloatingFrame(Layout* pLayout, unsigned int frameIndex, bool fade)
     {
-        pLayout->removeFloatingFrame(frameIndex, fade);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+                rCommand.flags[0] = fade;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->removeFloatingFrame((uint)rCommand.integers[0], rCommand.flags[0]);
+            });
     }
 
     void translateFloatingFrame(Layout* pLayout, unsigned int frameIndex, float translateX, float translateY)
     {
-        pLayout->translateFloatingFrame(frameIndex, translateX, translateY);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+                rCommand.values[0] = translateX;
+                rCommand.values[1] = translateY;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->translateFloatingFrame((uint)rCommand.integers[0], rCommand.values[0], rCommand.values[1]);
+            });
     }
 
     void scaleFloatingFrame(Layout* pLayout, unsigned int frameIndex, float scaleX, float scaleY)
     {
-        pLayout->scaleFloatingFrame(frameIndex, scaleX, scaleY);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+                rCommand.values[0] = scaleX;
+                rCommand.values[1] = scaleY;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->scaleFloatingFrame((uint)rCommand.integers[0], rCommand.values[0], rCommand.values[1]);
+            });
     }
 
     void setPositionOfFloatingFrame(Layout* pLayout, unsigned int frameIndex, float relativePositionX, float relativePositionY)
     {
-        pLayout->setPositionOfFloatingFrame(frameIndex, relativePositionX, relativePositionY);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+                rCommand.values[0] = relativePositionX;
+                rCommand.values[1] = relativePositionY;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setPositionOfFloatingFrame((uint)rCommand.integers[0], rCommand.values[0], rCommand.values[1]);
+            });
     }
 
     void setSizeOfFloatingFrame(Layout* pLayout, unsigned int frameIndex, float relativeSizeX, float relativeSizeY)
     {
-        pLayout->setSizeOfFloatingFrame(frameIndex, relativeSizeX, relativeSizeY);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+                rCommand.values[0] = relativeSizeX;
+                rCommand.values[1] = relativeSizeY;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->setSizeOfFloatingFrame((uint)rCommand.integers[0], rCommand.values[0], rCommand.values[1]);
+            });
     }
 
     void moveFloatingFrameToFront(Layout* pLayout, unsigned int frameIndex)
     {
-        pLayout->moveFloatingFrameToFront(frameIndex);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->moveFloatingFrameToFront((uint)rCommand.integers[0]);
+            });
     }
 
     void moveFloatingFrameToBack(Layout* pLayout, unsigned int frameIndex)
     {
-        pLayout->moveFloatingFrameToBack(frameIndex);
+        pLayout->getCommandQueue()->submit(
+            [&](Command& rCommand)
+            {
+                rCommand.pLayout = pLayout;
+                rCommand.integers[0] = (int)frameIndex;
+            },
+            [](Command& rCommand)
+            {
+                rCommand.pLayout->moveFloatingFrameToBack((uint)rCommand.integers[0]);
+            });
     }
 
     RelativePositionAndSize getRelativePositionAndSizeOfFloatingFrame(
@@ -452,4 +1126,23 @@ namespace eyegui
         // Set root filepath as friend of path builder
         PathBuilder::rootFilepath = rootFilepath;
     }
+
+    void setArchiveFilepath(std::string archiveFilepath)
+    {
+        // Map archive, it is only replaced when usable
+        std::shared_ptr<AssetArchive const> spArchive;
+        if (!archiveFilepath.empty())
+        {
+            spArchive = std::make_shared<AssetArchive>(archiveFilepath);
+            if (!spArchive->isUsable())
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Asset archive not found or damaged: " + archiveFilepath);
+                return;
+            }
+        }
+
+        // Set archive as friend of path builder. Views created before keep old archive mapped
+        std::lock_guard<std::mutex> lock(PathBuilder::archiveMutex);
+        PathBuilder::spArchive = spArchive;
+    }
 }
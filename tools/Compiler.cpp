@@ -0,0 +1,67 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Compiler executable. Converts a layout or brick from xml into the compiled
+// format, which is read without xml parsing. Output keeps the file extension,
+// so layouts refer to compiled bricks as before. Elements and attributes are
+// stored as numbers with values converted to their type, and kinds of
+// elements as well as ranges of values are checked, so errors are found
+// before shipping. Compiled output is read again and compared to the xml, so
+// both create the same elements.
+
+#include "Parser/TemplateParser.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Print usage
+    if (argc != 3)
+    {
+        std::cout
+            << "Usage: eyeGUICompiler <input filepath> <output filepath>\n"
+            << "Compiles layout or brick from xml. Keep the extension for the output.\n";
+        return argc == 1 ? 0 : 1;
+    }
+    std::string inputFilepath = argv[1];
+    std::string outputFilepath = argv[2];
+
+    // Read xml, compiled input is accepted as well
+    std::string errorMessage;
+    std::unique_ptr<eyegui::ElementTemplate> upTemplate = eyegui::template_parser::parse(inputFilepath, errorMessage);
+    if (upTemplate == NULL)
+    {
+        std::cerr << inputFilepath << ": " << errorMessage << std::endl;
+        return 1;
+    }
+
+    // Compile and check that it is read back identically
+    std::vector<eyegui::uchar> data;
+    if (!eyegui::template_parser::compile(upTemplate.get(), data, errorMessage))
+    {
+        std::cerr << inputFilepath << ": " << errorMessage << std::endl;
+        return 1;
+    }
+    std::unique_ptr<eyegui::ElementTemplate> upCompiled = eyegui::template_parser::parseCompiled(data.data(), data.size(), errorMessage);
+    if (upCompiled == NULL || !upCompiled->isEqual(*upTemplate))
+    {
+        std::cerr << "Compiled template differs from " << inputFilepath << std::endl;
+        return 1;
+    }
+
+    // Write output
+    std::ofstream out(outputFilepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    if (!out)
+    {
+        std::cerr << "Failed to write " << outputFilepath << std::endl;
+        return 1;
+    }
+    return 0;
+}
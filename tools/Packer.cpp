@@ -0,0 +1,133 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Packer executable. Bundles all files below a root directory, e.g. layouts,
+// bricks, stylesheets, configs, localizations, images and fonts, into a
+// single asset archive, which is set with "setArchiveFilepath". Filepaths in
+// archive are relative to root directory, like filepaths in layouts are
+// relative to root filepath.
+
+#include "AssetArchive.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+namespace
+{
+    // Collect filepaths of all files below directory, relative to root directory
+    void collectFiles(std::string rootDirectory, std::string relativeDirectory, std::vector<std::string>& rFilepaths)
+    {
+        std::string directory = relativeDirectory.empty() ? rootDirectory : rootDirectory + "/" + relativeDirectory;
+        std::string prefix = relativeDirectory.empty() ? "" : relativeDirectory + "/";
+
+#ifdef _WIN32
+        WIN32_FIND_DATAA data;
+        HANDLE find = FindFirstFileA((directory + "/*").c_str(), &data);
+        if (find == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+        do
+        {
+            std::string name = data.cFileName;
+            if (name == "." || name == "..")
+            {
+                continue;
+            }
+            if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            {
+                collectFiles(rootDirectory, prefix + name, rFilepaths);
+            }
+            else
+            {
+                rFilepaths.push_back(prefix + name);
+            }
+        } while (FindNextFileA(find, &data));
+        FindClose(find);
+#else
+        DIR* pDirectory = opendir(directory.c_str());
+        if (pDirectory == NULL)
+        {
+            return;
+        }
+        while (dirent* pEntry = readdir(pDirectory))
+        {
+            std::string name = pEntry->d_name;
+            if (name == "." || name == "..")
+            {
+                continue;
+            }
+            struct stat status;
+            if (stat((directory + "/" + name).c_str(), &status) != 0)
+            {
+                continue;
+            }
+            if (S_ISDIR(status.st_mode))
+            {
+                collectFiles(rootDirectory, prefix + name, rFilepaths);
+            }
+            else if (S_ISREG(status.st_mode))
+            {
+                rFilepaths.push_back(prefix + name);
+            }
+        }
+        closedir(pDirectory);
+#endif
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Print usage
+    if (argc != 3)
+    {
+        std::cout
+            << "Usage: eyeGUIPacker <root directory> <archive filepath>\n"
+            << "Packs all files below root directory into asset archive.\n";
+        return argc == 1 ? 0 : 1;
+    }
+    std::string rootDirectory = argv[1];
+    std::string archiveFilepath = argv[2];
+
+    // Collect files, without archive itself when written into root directory
+    std::vector<std::string> filepaths;
+    collectFiles(rootDirectory, "", filepaths);
+    std::string archiveName = archiveFilepath.substr(archiveFilepath.find_last_of("/\\") + 1);
+    for (auto it = filepaths.begin(); it != filepaths.end(); it++)
+    {
+        if (rootDirectory + "/" + *it == archiveFilepath || (*it == archiveName && archiveFilepath == archiveName))
+        {
+            filepaths.erase(it);
+            break;
+        }
+    }
+
+    // Write archive
+    if (!eyegui::AssetArchive::write(rootDirectory, filepaths, archiveFilepath))
+    {
+        std::cerr << "Failed to write asset archive " << archiveFilepath << std::endl;
+        return 1;
+    }
+
+    // Check it by mapping it
+    eyegui::AssetArchive archive(archiveFilepath);
+    if (filepaths.size() > 0 && !archive.isUsable())
+    {
+        std::cerr << "Written asset archive " << archiveFilepath << " is not readable" << std::endl;
+        return 1;
+    }
+    std::cout << "Packed " << archive.getFileCount() << " files into " << archiveFilepath << std::endl;
+    return 0;
+}